@@ -4,8 +4,13 @@ layout(location = 0) in vec3 in_position;
 
 out vec3 vert_local_pos;
 
-uniform mat4 projection;
-uniform mat4 view;
+// Per frame uniforms (written once per frame by the renderer).
+layout(std140) uniform FrameUniforms {
+    mat4 projection;
+    mat4 view;
+    mat4 environment_model;
+    float time_s;
+};
 uniform mat4 model;
 
 void main() {
@@ -0,0 +1,22 @@
+#version 330 core
+
+// World box of the node.
+uniform vec3 box_min;
+uniform vec3 box_max;
+uniform mat4 view_projection;
+
+// The 12 triangles of a box (the bits of a corner index select min or max on each axis).
+const int corners[36] = int[36](
+	0, 2, 1, 1, 2, 3,
+	4, 5, 6, 5, 7, 6,
+	0, 1, 4, 1, 5, 4,
+	2, 6, 3, 3, 6, 7,
+	0, 4, 2, 2, 4, 6,
+	1, 3, 5, 3, 7, 5);
+
+void main()
+{
+	int corner = corners[gl_VertexID];
+	vec3 weight = vec3(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+	gl_Position = view_projection * vec4(mix(box_min, box_max, weight), 1.0);
+}
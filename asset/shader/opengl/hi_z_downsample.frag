@@ -0,0 +1,40 @@
+#version 330 core
+
+// Previous level of the pyramid (the only level visible so lod 0 is that level).
+uniform sampler2D Depth;
+// Size of the previous level in texels.
+uniform vec2 previous_size;
+
+float FetchDepth(ivec2 texel)
+{
+	// A level of 1 texel wide (or high) has nothing on the other side.
+	return texelFetch(Depth, min(texel, ivec2(previous_size) - 1), 0).r;
+}
+
+void main()
+{
+	ivec2 texel = ivec2(gl_FragCoord.xy) * 2;
+	ivec2 size = ivec2(previous_size);
+	float depth = max(
+		max(FetchDepth(texel), FetchDepth(texel + ivec2(1, 0))),
+		max(FetchDepth(texel + ivec2(0, 1)), FetchDepth(texel + ivec2(1, 1))));
+	// With an odd size the last texel also covers the extra column or row.
+	bool extra_x = (size.x & 1) != 0 && texel.x == size.x - 3;
+	bool extra_y = (size.y & 1) != 0 && texel.y == size.y - 3;
+	if (extra_x)
+	{
+		depth = max(depth, max(
+			FetchDepth(texel + ivec2(2, 0)), FetchDepth(texel + ivec2(2, 1))));
+	}
+	if (extra_y)
+	{
+		depth = max(depth, max(
+			FetchDepth(texel + ivec2(0, 2)), FetchDepth(texel + ivec2(1, 2))));
+	}
+	if (extra_x && extra_y)
+	{
+		depth = max(depth, FetchDepth(texel + ivec2(2, 2)));
+	}
+	// Keep the farthest depth so a box behind it is hidden everywhere under the texel.
+	gl_FragDepth = depth;
+}
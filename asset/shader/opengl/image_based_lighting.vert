@@ -9,8 +9,13 @@ out vec3 fragNormal;
 out vec2 fragTexCoord;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+// Per frame uniforms (written once per frame by the renderer).
+layout(std140) uniform FrameUniforms {
+    mat4 projection;
+    mat4 view;
+    mat4 environment_model;
+    float time_s;
+};
 
 void main()
 {
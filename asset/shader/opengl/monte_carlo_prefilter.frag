@@ -6,19 +6,22 @@ out vec4 frag_color;
 
 uniform samplerCube Environment;
 
+// Roughness of the mip level being rendered.
 uniform float roughness;
+// Resolution of the source cube map (per face) and the number of mip levels it has.
+uniform float source_resolution;
+uniform float source_mip_count;
+// Number of samples per texel, the source is read from its mip levels (filtered importance
+// sampling) so a few dozen samples are enough.
+uniform int sample_count;
 
 const float PI = 3.14159265359;
-// resolution of source cubemap (per face)
-const vec2 resolution = vec2(512.0, 512.0);
-const uint SAMPLE_COUNT = 1024u;
 
 // ----------------------------------------------------------------------------
-float DistributionGGX(vec3 N, vec3 H, float roughness)
+float DistributionGGX(float NdotH, float roughness)
 {
     float a = roughness * roughness;
     float a2 = a * a;
-    float NdotH = max(dot(N, H), 0.0);
     float NdotH2 = NdotH * NdotH;
 
     float nom   = a2;
@@ -48,34 +51,8 @@ vec2 Hammersley(uint i, uint N)
 }
 
 // ----------------------------------------------------------------------------
-float VanDerCorpus(uint n, uint base)
-{
-    float invBase = 1.0 / float(base);
-    float denom   = 1.0;
-    float result  = 0.0;
-
-    for(uint i = 0u; i < 32u; ++i)
-    {
-        if(n > 0u)
-        {
-            denom   = mod(float(n), 2.0);
-            result += denom * invBase;
-            invBase = invBase / 2.0;
-            n       = uint(float(n) / 2.0);
-        }
-    }
-
-    return result;
-}
-
-// ----------------------------------------------------------------------------
-vec2 HammersleyNoBitOps(uint i, uint N)
-{
-    return vec2(float(i)/float(N), VanDerCorpus(i, 2u));
-}
-
-// ----------------------------------------------------------------------------
-vec3 ImportanceSampleGGX(vec2 Xi, vec3 N, float roughness)
+// Half vector in tangent space (z is the normal).
+vec3 ImportanceSampleGGX(vec2 Xi, float roughness)
 {
 	float a = roughness * roughness;
 	
@@ -83,67 +60,64 @@ vec3 ImportanceSampleGGX(vec2 Xi, vec3 N, float roughness)
 	float cosTheta = sqrt((1.0 - Xi.y) / (1.0 + (a * a - 1.0) * Xi.y));
 	float sinTheta = sqrt(1.0 - cosTheta * cosTheta);
 	
-	// from spherical coordinates to cartesian coordinates - halfway vector
-	vec3 H;
-	H.x = cos(phi) * sinTheta;
-	H.y = sin(phi) * sinTheta;
-	H.z = cosTheta;
-	
-	// from tangent-space H vector to world-space sample vector
-	vec3 up        = (abs(N.z) < 0.999) ? 
-        vec3(0.0, 0.0, 1.0) : 
-        vec3(1.0, 0.0, 0.0);
-	vec3 tangent   = normalize(cross(up, N));
-	vec3 bitangent = cross(N, tangent);
-	
-	vec3 sampleVec = tangent * H.x + bitangent * H.y + N * H.z;
-	return normalize(sampleVec);
+	return vec3(cos(phi) * sinTheta, sin(phi) * sinTheta, cosTheta);
 }
 
 // ----------------------------------------------------------------------------
 void main()
 {		
-    vec3 N = normalize(vert_world_position);
-    
+    // Same orientation as the irradiance map (see irradiance_cubemap.frag).
+    vec3 N = normalize(vec3(vert_world_position.x, -vert_world_position.y, vert_world_position.z));
+
+    // A perfect mirror is a copy of the source.
+    if (roughness == 0.0)
+    {
+        frag_color = vec4(textureLod(Environment, N, 0.0).rgb, 1.0);
+        return;
+    }
+
     // make the simplyfying assumption that V equals R equals the normal 
     vec3 R = N;
     vec3 V = R;
 
+    // Tangent frame computed once per texel.
+    vec3 up        = (abs(N.z) < 0.999) ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent   = normalize(cross(up, N));
+    vec3 bitangent = cross(N, tangent);
+
+    // Solid angle of a texel of the source.
+    float saTexel = 4.0 * PI / (6.0 * source_resolution * source_resolution);
+    float maxLod  = source_mip_count - 1.0;
+
     vec3 prefilteredColor = vec3(0.0);
     float totalWeight = 0.0;
+    uint sampleCount = uint(sample_count);
     
-    for (uint i = 0u; i < SAMPLE_COUNT; ++i)
+    for (uint i = 0u; i < sampleCount; ++i)
     {
         // generates a sample vector that's biased towards the preferred
         // alignment direction (importance sampling).
-#if 0
-        vec2 Xi = Hammersley(i, SAMPLE_COUNT);
-#else
-        vec2 Xi = HammersleyNoBitOps(i, SAMPLE_COUNT);
-#endif
-        vec3 H  = ImportanceSampleGGX(Xi, N, roughness);
+        vec2 Xi = Hammersley(i, sampleCount);
+        vec3 Ht = ImportanceSampleGGX(Xi, roughness);
+        vec3 H  = tangent * Ht.x + bitangent * Ht.y + N * Ht.z;
         vec3 L  = normalize(2.0 * dot(V, H) * H - V);
 
-        float NdotL = max(dot(N, L), 0.0);
+        float NdotL = dot(N, L);
         if(NdotL > 0.0)
         {
-            // sample from the environment's mip level based on roughness/pdf
-            float D     = DistributionGGX(N, H, roughness);
-            float NdotH = max(dot(N, H), 0.0);
-            float HdotV = max(dot(H, V), 0.0);
-            float pdf   = D * NdotH / (4.0 * HdotV) + 0.0001; 
-
-            float saTexel  = 4.0 * PI / (6.0 * resolution.x * resolution.y);
-            float saSample = 1.0 / (float(SAMPLE_COUNT) * pdf + 0.0001);
-
-            float mipLevel = (roughness == 0.0) ? 
-                0.0 : 
-                0.5 * log2(saSample / saTexel); 
+            // sample from the environment's mip level based on roughness/pdf (N = V so
+            // NdotH = HdotV and the pdf is D / 4).
+            float NdotH = max(Ht.z, 0.0);
+            float pdf   = DistributionGGX(NdotH, roughness) * 0.25 + 0.0001; 
+
+            float saSample = 1.0 / (float(sampleCount) * pdf + 0.0001);
+            // One more level to cover the gaps between the samples.
+            float mipLevel = clamp(0.5 * log2(saSample / saTexel) + 1.0, 0.0, maxLod);
             
             prefilteredColor += textureLod(Environment, L, mipLevel).rgb * NdotL;
             totalWeight      += NdotL;
         }
     }
-    prefilteredColor = prefilteredColor / totalWeight;
+    prefilteredColor = prefilteredColor / max(totalWeight, 0.0001);
     frag_color = vec4(prefilteredColor, 1.0);
 }
@@ -8,8 +8,13 @@ out vec3 vert_world_position;
 out vec3 vert_normal;
 out vec2 vert_texcoord;
 
-uniform mat4 projection;
-uniform mat4 view;
+// Per frame uniforms (written once per frame by the renderer).
+layout(std140) uniform FrameUniforms {
+	mat4 projection;
+	mat4 view;
+	mat4 environment_model;
+	float time_s;
+};
 uniform mat4 model;
 
 void main()
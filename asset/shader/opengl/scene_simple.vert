@@ -3,20 +3,28 @@
 layout(location = 0) in vec3 in_position;
 layout(location = 1) in vec3 in_normal;
 layout(location = 2) in vec2 in_texcoord;
+// Per instance model (set to identity when not drawn instanced).
+layout(location = 8) in mat4 in_instance_model;
 
 out vec3 vert_normal;
 out vec3 vert_position;
 out vec2 vert_texcoord;
 
-uniform mat4 projection;
-uniform mat4 view;
+// Per frame uniforms (written once per frame by the renderer).
+layout(std140) uniform FrameUniforms {
+	mat4 projection;
+	mat4 view;
+	mat4 environment_model;
+	float time_s;
+};
 uniform mat4 model;
 
 void main()
 {
-	vert_normal = normalize(vec3(model * vec4(in_normal, 1.0)));
+	mat4 instance_model = model * in_instance_model;
+	vert_normal = normalize(vec3(instance_model * vec4(in_normal, 1.0)));
 	vert_texcoord = in_texcoord;
-	mat4 pvm = projection * view * model;
+	mat4 pvm = projection * view * instance_model;
 	vert_position = (pvm * vec4(in_position, 1.0)).xyz;
 	gl_Position = pvm * vec4(in_position, 1.0);
 }
@@ -10,8 +10,13 @@ out vec3 vert_normal;
 
 uniform bool inverted_normals;
 
-uniform mat4 projection;
-uniform mat4 view;
+// Per frame uniforms (written once per frame by the renderer).
+layout(std140) uniform FrameUniforms {
+    mat4 projection;
+    mat4 view;
+    mat4 environment_model;
+    float time_s;
+};
 uniform mat4 model;
 
 void main()
@@ -1,7 +1,10 @@
 #include <absl/flags/flag.h>
 #include <absl/flags/parse.h>
 
+#include <cstdint>
+#include <filesystem>
 #include <iostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -14,6 +17,7 @@
 #include "frame/common/application.h"
 #include "frame/file/file_system.h"
 #include "frame/file/image_stb.h"
+#include "frame/file/point_cloud_octree.h"
 #include "frame/gui/draw_gui_factory.h"
 #include "frame/gui/input_factory.h"
 #include "frame/gui/window_camera.h"
@@ -22,10 +26,14 @@
 #include "frame/json/parse_json.h"
 #include "frame/json/parse_level.h"
 #include "frame/json/proto.h"
+#include "frame/opengl/point_cloud_stream.h"
 #include "frame/window_factory.h"
 
 ABSL_FLAG(float, move_mult, 1.0f, "Move multiplication factor.");
 ABSL_FLAG(float, zoom_mult, 1.0f, "Zoom multiplication factor.");
+ABSL_FLAG(std::string, stream_ply, "",
+          "PLY point cloud streamed from an octree (converted next to the file on the first run).");
+ABSL_FLAG(std::uint64_t, point_budget, 5000000, "Maximum number of streamed points per frame.");
 
 // From: https://sourceforge.net/p/predef/wiki/OperatingSystems/
 #if defined(_WIN32) || defined(_WIN64)
@@ -69,6 +77,15 @@ int main(int ac, char** av) try {
     bool do_once      = true;
     bool create_proto = true;
     frame::proto::Level proto_level;
+    std::filesystem::path octree_file;
+    if (!absl::GetFlag(FLAGS_stream_ply).empty()) {
+        const std::filesystem::path ply_file = absl::GetFlag(FLAGS_stream_ply);
+        octree_file                          = ply_file;
+        octree_file.replace_extension(".fpco");
+        if (!std::filesystem::exists(octree_file)) {
+            frame::file::BuildPointCloudOctree(ply_file, octree_file);
+        }
+    }
     do {
         if (std::exchange(create_proto, false)) {
             proto_level = frame::proto::LoadProtoFromJsonFile<frame::proto::Level>(
@@ -82,6 +99,12 @@ int main(int ac, char** av) try {
             level->GetDefaultCamera().operator=(ptr_window_camera->GetSavedCamera());
         }
         ptr_window_camera->SetCameraPtr(&level->GetDefaultCamera());
+        if (!octree_file.empty()) {
+            frame::opengl::PointCloudStreamParameter parameter = {};
+            parameter.point_budget                             = absl::GetFlag(FLAGS_point_budget);
+            device.AddPlugin(std::make_unique<frame::opengl::PointCloudStream>(
+                *level, octree_file, "StreamedPointCloud", "PointCloudMaterial", parameter));
+        }
         app.Startup(std::move(level));
         app.Run();
         app.Resize(ptr_window_resolution->GetSize(), ptr_window_resolution->GetFullScreen());
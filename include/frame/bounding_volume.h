@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <limits>
+#include <vector>
+
+namespace frame {
+
+/**
+ * @class BoundingVolume
+ * @brief Axis aligned box and sphere around a mesh (in mesh or in world space), the default volume
+ * is empty and an empty volume is never culled.
+ */
+struct BoundingVolume {
+    //! @brief Minimum corner of the box.
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    //! @brief Maximum corner of the box.
+    glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+    //! @brief Center of the sphere.
+    glm::vec3 center = glm::vec3(0.0f);
+    //! @brief Radius of the sphere.
+    float radius = 0.0f;
+    /**
+     * @brief Check if the volume contains at least a point.
+     * @return True if the box is not empty.
+     */
+    bool IsValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+};
+
+/**
+ * @brief Compute the bounding volume of a list of points.
+ * @param points: Points as consecutive x, y, z floats.
+ * @return The box and the sphere (centered on the box) around the points.
+ */
+BoundingVolume ComputeBoundingVolume(const std::vector<float>& points);
+/**
+ * @brief Compute the bounding volume of an interleaved vertex buffer, the position has to be the
+ * first attribute (3 floats at offset 0, see InterleaveVertices).
+ * @param vertices: Interleaved vertex data.
+ * @param vertex_size: Size of the vertex data in bytes.
+ * @param vertex_stride: Size of a vertex in bytes.
+ * @return The box and the sphere (centered on the box) around the positions.
+ */
+BoundingVolume ComputeBoundingVolume(const std::uint8_t* vertices, std::size_t vertex_size,
+                                     std::uint32_t vertex_stride);
+/**
+ * @brief Transform a bounding volume (from mesh to world space for example), the box is the box
+ * around the transformed box so it stays conservative.
+ * @param bounding_volume: Volume to be transformed.
+ * @param model: Transformation matrix.
+ * @return The transformed volume (empty if the input is empty).
+ */
+BoundingVolume TransformBoundingVolume(const BoundingVolume& bounding_volume,
+                                       const glm::mat4& model);
+/**
+ * @brief Compute the volume that contains two volumes.
+ * @param left: First volume (can be empty).
+ * @param right: Second volume (can be empty).
+ * @return The volume around both.
+ */
+BoundingVolume MergeBoundingVolume(const BoundingVolume& left, const BoundingVolume& right);
+/**
+ * @brief Compute the projected size of a volume (used to select a level of detail).
+ * @param bounding_volume: Volume in world space.
+ * @param projection: Projection matrix of the camera (perspective or orthographic).
+ * @param view: View matrix of the camera.
+ * @return Fraction of the screen height covered by the sphere of the volume (can be above 1, 0 if
+ * the volume is empty).
+ */
+float ComputeScreenSize(const BoundingVolume& bounding_volume, const glm::mat4& projection,
+                        const glm::mat4& view);
+
+}  // End namespace frame.
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "frame/bounding_volume.h"
+#include "frame/entity_id.h"
+#include "frame/frustum.h"
+
+namespace frame {
+
+/**
+ * @class Bvh
+ * @brief Bounding volume hierarchy over a set of boxes (one per entity). The tree is built top down
+ * with a binned surface area heuristic, and then refitted in place when a box moves so the queries
+ * (frustum, box and ray) stay logarithmic without rebuilding every frame.
+ */
+class Bvh {
+   public:
+    //! @brief Result of a ray cast.
+    struct Hit {
+        //! @brief Entity whose box was hit (NullId in case of a miss).
+        EntityId id = NullId;
+        //! @brief Distance along the ray to the entry point of the box.
+        float distance = 0.0f;
+    };
+
+   public:
+    /**
+     * @brief Build the tree from scratch (replace the previous content).
+     * @param items: Vector of (entity id, volume), the empty volumes are skipped.
+     */
+    void Build(const std::vector<std::pair<EntityId, BoundingVolume>>& items);
+    /**
+     * @brief Move the box of an entity and refit its parents (stop as soon as a parent box does not
+     * change).
+     * @param id: Entity id (throw if not in the tree).
+     * @param bounding_volume: New volume of the entity.
+     */
+    void Update(EntityId id, const BoundingVolume& bounding_volume);
+    /**
+     * @brief Check if an entity is in the tree.
+     * @param id: Entity id.
+     * @return True if the entity has a leaf.
+     */
+    bool Contains(EntityId id) const { return leaf_indices_.count(id) != 0; }
+    /**
+     * @brief Get the entities whose box touches the frustum.
+     * @param frustum: Frustum in the same space as the boxes.
+     * @return The entity ids (in no particular order).
+     */
+    std::vector<EntityId> QueryFrustum(const Frustum& frustum) const;
+    /**
+     * @brief Get the entities whose box overlaps a box (range query).
+     * @param min: Minimum corner of the box.
+     * @param max: Maximum corner of the box.
+     * @return The entity ids (in no particular order).
+     */
+    std::vector<EntityId> QueryBox(glm::vec3 min, glm::vec3 max) const;
+    /**
+     * @brief Find the closest box along a ray.
+     * @param origin: Origin of the ray.
+     * @param direction: Direction of the ray (does not have to be normalized, the distance is then
+     * in direction units).
+     * @return The closest hit (id is NullId if nothing was hit), a ray starting inside a box hits
+     * it at distance 0.
+     */
+    Hit Raycast(glm::vec3 origin, glm::vec3 direction) const;
+    /**
+     * @brief Get the number of entities in the tree.
+     * @return Number of leaves.
+     */
+    std::size_t GetSize() const { return leaf_indices_.size(); }
+    /**
+     * @brief Get the depth of the tree (for debugging the builder).
+     * @return Number of levels (0 if empty).
+     */
+    std::size_t GetDepth() const;
+
+   protected:
+    // A node is a leaf when its left index is invalid (one entity per leaf so a refit only touches
+    // the path to the root).
+    struct Node {
+        glm::vec3 min        = glm::vec3(0.0f);
+        glm::vec3 max        = glm::vec3(0.0f);
+        std::uint32_t parent = 0xffffffff;
+        std::uint32_t left   = 0xffffffff;
+        std::uint32_t right  = 0xffffffff;
+        EntityId id          = NullId;
+    };
+    struct BuildItem {
+        EntityId id;
+        glm::vec3 min;
+        glm::vec3 max;
+        glm::vec3 centroid;
+    };
+    /**
+     * @brief Recursively build the nodes for a range of items.
+     * @param items: Items to be partitioned in place.
+     * @param begin: First item of the range.
+     * @param end: One past the last item of the range.
+     * @param parent: Index of the parent node.
+     * @return Index of the created node.
+     */
+    std::uint32_t BuildNode(std::vector<BuildItem>& items, std::size_t begin, std::size_t end,
+                            std::uint32_t parent);
+    /**
+     * @brief Walk the tree and collect the leaves whose box pass a test (the children of a node
+     * that fails the test are skipped).
+     * @param test: Callable taking (min, max) of a box and returning true to go down.
+     * @return The entity ids of the leaves that passed.
+     */
+    template <typename Test>
+    std::vector<EntityId> Collect(Test test) const;
+
+   private:
+    static constexpr std::uint32_t invalid_index_             = 0xffffffff;
+    static constexpr std::size_t bin_count_                   = 16;
+    std::vector<Node> nodes_                                  = {};
+    std::uint32_t root_                                       = invalid_index_;
+    std::unordered_map<EntityId, std::uint32_t> leaf_indices_ = {};
+};
+
+}  // End namespace frame.
@@ -70,6 +70,14 @@ class Camera {
      * @return A mat4 of the projection matrix.
      */
     glm::mat4 ComputeProjection(float fov_rad, float aspect_ratio) const;
+    /**
+     * @brief Compute the direction of the ray going from the camera through a point of the screen
+     * (for picking with the mouse position).
+     * @param screen_position: Position on the screen in pixels (origin top left).
+     * @param screen_size: Size of the screen in pixels.
+     * @return The normalized direction in world space (the ray starts at the camera position).
+     */
+    glm::vec3 ComputeRayDirection(glm::vec2 screen_position, glm::vec2 screen_size) const;
 
     /**
      * @brief Update the front vector (normalized) and update the whole camera accordingly.
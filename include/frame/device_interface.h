@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "frame/api.h"
 #include "frame/buffer_interface.h"
@@ -86,6 +89,30 @@ class DeviceInterface {
      * @param file: File name to write the screenshot to (*.png).
      */
     virtual void ScreenShot(const std::string& file) const = 0;
+    /**
+     * @brief Make a screenshot of the current frame without stalling, the pixels are read back
+     * asynchronously (at the next Display calls) and the file is encoded on a worker thread.
+     * @param file: File name to write the screenshot to (*.png).
+     * @return A future that is ready once the file is written.
+     */
+    virtual std::future<void> ScreenShotAsync(const std::string& file) = 0;
+    /**
+     * @brief Start to capture every Nth frame to an image sequence (see ScreenShotAsync), frames
+     * are dropped instead of slowing down the rendering if the encoding is late.
+     * @param file_pattern: Pattern of the file names, formatted with the frame number (for
+     * example "capture_{:06}.png").
+     * @param every_n_frames: Capture one frame every N frames.
+     */
+    virtual void StartCapture(const std::string& file_pattern,
+                              std::uint32_t every_n_frames = 1) = 0;
+    //! @brief Stop the capture started with StartCapture.
+    virtual void StopCapture() = 0;
+    /**
+     * @brief Read the pixels of a texture without stalling (they are converted to bytes).
+     * @param texture_id: Id of the texture to be read (should be a 2D texture).
+     * @return A future to the pixels, ready at one of the next Display calls.
+     */
+    virtual std::future<std::vector<std::uint8_t>> ReadTextureAsync(EntityId texture_id) = 0;
     /**
      * @brief Set the stereo mode (by default this is NONE), interocular distance and focus point.
      * @param stereo_enum: Set the mode the stereo will use.
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <glm/glm.hpp>
+
+#include "frame/bounding_volume.h"
+
+namespace frame {
+
+/**
+ * @class Frustum
+ * @brief The 6 planes of a view frustum (pointing inside) extracted from a view projection matrix,
+ * used to reject the volumes that cannot be seen before they are submitted.
+ */
+class Frustum {
+   public:
+    /**
+     * @brief Constructor extract the planes from the matrix (Gribb and Hartmann).
+     * @param view_projection: Projection times view (times model for a frustum in model space).
+     */
+    explicit Frustum(const glm::mat4& view_projection);
+
+   public:
+    /**
+     * @brief Get a plane of the frustum.
+     * @param index: Plane index (left, right, bottom, top, near, far).
+     * @return The normalized plane (normal, distance).
+     */
+    glm::vec4 GetPlane(int index) const;
+    /**
+     * @brief Test a volume against the frustum (sphere then box), this is conservative: a volume
+     * that is reported visible may still be outside near the corners.
+     * @param bounding_volume: Volume in the same space as the frustum (empty is always visible).
+     * @return False if the volume is completely outside of one of the planes.
+     */
+    bool IsVisible(const BoundingVolume& bounding_volume) const;
+    /**
+     * @brief Test a box against the frustum.
+     * @param min: Minimum corner of the box.
+     * @param max: Maximum corner of the box.
+     * @return False if the box is completely outside of one of the planes.
+     */
+    bool IsBoxVisible(glm::vec3 min, glm::vec3 max) const;
+
+   private:
+    // Planes stored as a structure of arrays (padded to 8 with planes that accept everything), so
+    // the tests are straight loops the compiler turns into SIMD operations.
+    static constexpr std::size_t plane_count_ = 8;
+    alignas(32) std::array<float, plane_count_> normal_x_ = {};
+    alignas(32) std::array<float, plane_count_> normal_y_ = {};
+    alignas(32) std::array<float, plane_count_> normal_z_ = {};
+    alignas(32) std::array<float, plane_count_> distance_ = {};
+};
+
+}  // End namespace frame.
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/bounding_volume.h"
+
+namespace frame {
+
+/**
+ * @class HiZPyramid
+ * @brief Hierarchical depth buffer on the CPU: every level keeps the farthest depth of the texels
+ * it covers in the level below, so a box whose nearest depth is behind the farthest depth under
+ * its screen rectangle is hidden. The depth is the window depth ([0, 1], 1 is the far plane).
+ */
+class HiZPyramid {
+   public:
+    /**
+     * @brief Build the pyramid from a depth image (as read from GL: first row at the bottom), the
+     * coarser levels are computed down to 1 x 1.
+     * @param depths: Depth of every texel (size.x * size.y).
+     * @param size: Size of the image.
+     */
+    void Build(std::vector<float> depths, glm::uvec2 size);
+    /**
+     * @brief Check if there is a pyramid to test against.
+     * @return True after a successful build.
+     */
+    bool IsValid() const { return !levels_.empty(); }
+    /**
+     * @brief Test a world volume against the pyramid, the test is conservative: a volume crossing
+     * the near plane or outside of the screen is never reported as occluded.
+     * @param bounding_volume: Volume in world space.
+     * @param view_projection: Projection times view of the camera.
+     * @return True if the box is behind the depth of the pyramid everywhere it covers.
+     */
+    bool IsOccluded(const BoundingVolume& bounding_volume, const glm::mat4& view_projection) const;
+    /**
+     * @brief Get the number of levels.
+     * @return Number of levels (0 if not built).
+     */
+    std::size_t GetLevelCount() const { return levels_.size(); }
+    /**
+     * @brief Get the size of a level.
+     * @param level: Level (0 is the image).
+     * @return Size of the level in texels.
+     */
+    glm::uvec2 GetLevelSize(std::size_t level) const { return levels_.at(level).size; }
+    /**
+     * @brief Get the depth of a texel.
+     * @param level: Level (0 is the image).
+     * @param texel: Position of the texel in the level.
+     * @return The farthest depth covered by the texel.
+     */
+    float GetDepth(std::size_t level, glm::uvec2 texel) const;
+
+   private:
+    struct Level {
+        glm::uvec2 size           = glm::uvec2(0);
+        std::vector<float> depths = {};
+    };
+    std::vector<Level> levels_ = {};
+};
+
+}  // End namespace frame.
@@ -2,11 +2,15 @@
 
 #include <cinttypes>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
+#include "frame/bvh.h"
 #include "frame/device_interface.h"
 #include "frame/level_interface.h"
 #include "frame/logger.h"
+#include "frame/scene_graph.h"
+#include "frame/slot_map.h"
 
 namespace frame {
 
@@ -38,13 +42,18 @@ class Level : public LevelInterface {
      * @param model: The default environment model matrix.
      */
     void SetDefaultEnvironmentModel(const glm::mat4& model) final { environment_model_ = model; }
+    /**
+     * @brief Enable or disable the frame graph.
+     * @param enable: Should the frame graph schedule the passes.
+     */
+    void SetFrameGraphEnabled(bool enable) final { frame_graph_enabled_ = enable; }
     /**
      * @brief Will get the scene node from an id.
      * @param id: The id to get the scene node from.
      * @return A pointer to the node or null.
      */
     NodeInterface& GetSceneNodeFromId(EntityId id) const override {
-        return *id_scene_node_map_.at(id).get();
+        return *scene_nodes_.At(id).get();
     }
     /**
      * @brief Will get the texture from an id.
@@ -52,7 +61,7 @@ class Level : public LevelInterface {
      * @return A pointer to the texture or null.
      */
     TextureInterface& GetTextureFromId(EntityId id) const override {
-        return *id_texture_map_.at(id).get();
+        return *textures_.At(id).get();
     }
     /**
      * @brief Will get the program from an id.
@@ -60,7 +69,7 @@ class Level : public LevelInterface {
      * @return A pointer to the program or null.
      */
     ProgramInterface& GetProgramFromId(EntityId id) const override {
-        return *id_program_map_.at(id).get();
+        return *programs_.At(id).get();
     }
     /**
      * @brief Will get a material from an id.
@@ -68,7 +77,7 @@ class Level : public LevelInterface {
      * @return A pointer to a material or null.
      */
     MaterialInterface& GetMaterialFromId(EntityId id) const override {
-        return *id_material_map_.at(id).get();
+        return *materials_.At(id).get();
     }
     /**
      * @brief Will get a buffer from an id.
@@ -76,7 +85,7 @@ class Level : public LevelInterface {
      * @return A pointer to a buffer or null.
      */
     BufferInterface& GetBufferFromId(EntityId id) const override {
-        return *id_buffer_map_.at(id).get();
+        return *buffers_.At(id).get();
     }
     /**
      * @brief Will get a static mesh from an id.
@@ -84,7 +93,7 @@ class Level : public LevelInterface {
      * @return A pointer to a static mesh or null.
      */
     StaticMeshInterface& GetStaticMeshFromId(EntityId id) const override {
-        return *id_static_mesh_map_.at(id).get();
+        return *static_meshes_.At(id).get();
     }
     /**
      * @brief Get a vector of static mesh id and corresponding material id.
@@ -146,7 +155,7 @@ class Level : public LevelInterface {
      * @param id: Id to be returned.
      * @return An enum type.
      */
-    EntityTypeEnum GetEnumTypeFromId(EntityId id) const override { return id_enum_map_.at(id); }
+    EntityTypeEnum GetEnumTypeFromId(EntityId id) const override { return entity_types_.At(id); }
     /**
      * @brief Get name.
      * @return Name.
@@ -174,6 +183,11 @@ class Level : public LevelInterface {
      * @return The default environment model matrix.
      */
     glm::mat4 GetDefaultEnvironmentModel() const final;
+    /**
+     * @brief Check if the passes are scheduled by the frame graph.
+     * @return True if the frame graph is enabled.
+     */
+    bool IsFrameGraphEnabled() const final { return frame_graph_enabled_; }
     /**
      * @brief Get the id of an element from a name string.
      * @param name: The name string of the element.
@@ -239,6 +253,44 @@ class Level : public LevelInterface {
      * @return Parent node id.
      */
     EntityId GetParentId(EntityId id) const override;
+    /**
+     * @brief Update the world models of all the scene nodes at dt time (single pass over the flat
+     * scene graph).
+     * @param dt: Delta time from the beginning of the software running in seconds.
+     */
+    void UpdateWorldModels(double dt) override;
+    /**
+     * @brief Get the world model of a scene node computed by the last UpdateWorldModels.
+     * @param id: Id of the scene node.
+     * @return The world model of the node.
+     */
+    glm::mat4 GetWorldModelFromId(EntityId id) const override;
+    /**
+     * @brief Get the world volume of a scene node computed by the last UpdateWorldModels.
+     * @param id: Id of the scene node.
+     * @return The world volume (empty if the node has no mesh or the mesh no volume).
+     */
+    BoundingVolume GetWorldBoundingVolumeFromId(EntityId id) const override;
+    /**
+     * @brief Get the scene nodes whose world volume touches a frustum.
+     * @param frustum: Frustum in world space.
+     * @return The ids of the scene nodes.
+     */
+    std::vector<EntityId> GetNodesInFrustum(const Frustum& frustum) const override;
+    /**
+     * @brief Get the scene nodes whose world volume overlaps a box.
+     * @param min: Minimum corner of the box in world space.
+     * @param max: Maximum corner of the box in world space.
+     * @return The ids of the scene nodes.
+     */
+    std::vector<EntityId> GetNodesInBox(glm::vec3 min, glm::vec3 max) const override;
+    /**
+     * @brief Get the scene node whose world volume is the closest along a ray.
+     * @param origin: Origin of the ray in world space.
+     * @param direction: Direction of the ray in world space.
+     * @return The id of the closest scene node or NullId.
+     */
+    EntityId PickNode(glm::vec3 origin, glm::vec3 direction) const override;
     /**
      * @brief Get all texture from the level.
      * @return A vector of texture ids.
@@ -274,60 +326,86 @@ class Level : public LevelInterface {
 
    protected:
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
+     */
+    EntityId GetTextureNewId() const { return id_allocator_.Allocate(); }
+    /**
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
+     */
+    EntityId GetProgramNewId() const { return id_allocator_.Allocate(); }
+    /**
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
+     */
+    EntityId GetMaterialNewId() const { return id_allocator_.Allocate(); }
+    /**
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
      */
-    EntityId GetTextureNewId() const { return ++next_id_maker_; }
+    EntityId GetBufferNewId() const { return id_allocator_.Allocate(); }
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
      */
-    EntityId GetProgramNewId() const { return ++next_id_maker_; }
+    EntityId GetStaticMeshNewId() const { return id_allocator_.Allocate(); }
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Allocate a new id (a freed slot can be reused with a new generation).
+     * @return New entity id.
      */
-    EntityId GetMaterialNewId() const { return ++next_id_maker_; }
+    EntityId GetSceneNodeNewId() const { return id_allocator_.Allocate(); }
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Get the scene graph, (re)build it in case scene nodes were added since the last call.
+     * @return The flat scene graph.
      */
-    EntityId GetBufferNewId() const { return ++next_id_maker_; }
+    const SceneGraph& GetSceneGraph() const;
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Get the hierarchy over the world volumes of the scene nodes, (re)build it in case the
+     * scene graph or the meshes changed since the last call.
+     * @return The bounding volume hierarchy.
      */
-    EntityId GetStaticMeshNewId() const { return ++next_id_maker_; }
+    const Bvh& GetBvh() const;
     /**
-     * @brief Increase the internal counter and return the value.
-     * @return Current counter + 1.
+     * @brief Compute the world volume of a scene node from its mesh and its world model.
+     * @param id: Id of the scene node.
+     * @return The world volume (empty if the node has no mesh or the mesh no volume).
      */
-    EntityId GetSceneNodeNewId() const { return ++next_id_maker_; }
+    BoundingVolume ComputeWorldBoundingVolume(EntityId id) const;
 
    protected:
-    Logger& logger_                 = Logger::GetInstance();
-    mutable EntityId next_id_maker_ = NullId;
-    EntityId quad_id_               = 0;
-    EntityId cube_id_               = 0;
+    Logger& logger_                         = Logger::GetInstance();
+    mutable EntityIdAllocator id_allocator_ = {};
+    EntityId quad_id_                       = 0;
+    EntityId cube_id_                       = 0;
     std::string name_;
     std::string default_texture_name_;
     std::string default_root_scene_node_name_;
     std::string default_camera_name_;
     glm::mat4 environment_model_ = glm::mat4(1.0f);
-    // These are storage so unique ptr interface.
-    std::map<EntityId, std::unique_ptr<NodeInterface>> id_scene_node_map_        = {};
-    std::map<EntityId, std::unique_ptr<TextureInterface>> id_texture_map_        = {};
-    std::map<EntityId, std::unique_ptr<ProgramInterface>> id_program_map_        = {};
-    std::map<EntityId, std::unique_ptr<MaterialInterface>> id_material_map_      = {};
-    std::map<EntityId, std::unique_ptr<BufferInterface>> id_buffer_map_          = {};
-    std::map<EntityId, std::unique_ptr<StaticMeshInterface>> id_static_mesh_map_ = {};
+    bool frame_graph_enabled_    = false;
+    // These are storage so unique ptr interface (dense slot maps indexed by id).
+    SlotMap<std::unique_ptr<NodeInterface>> scene_nodes_         = {};
+    SlotMap<std::unique_ptr<TextureInterface>> textures_         = {};
+    SlotMap<std::unique_ptr<ProgramInterface>> programs_         = {};
+    SlotMap<std::unique_ptr<MaterialInterface>> materials_       = {};
+    SlotMap<std::unique_ptr<BufferInterface>> buffers_           = {};
+    SlotMap<std::unique_ptr<StaticMeshInterface>> static_meshes_ = {};
     // These are storage specifiers.
-    std::set<std::string> string_set_               = {};
-    std::map<std::string, EntityId> name_id_map_    = {};
-    std::map<EntityId, std::string> id_name_map_    = {};
-    std::map<EntityId, EntityTypeEnum> id_enum_map_ = {};
+    std::set<std::string> string_set_                      = {};
+    std::unordered_map<std::string, EntityId> name_id_map_ = {};
+    SlotMap<std::string> entity_names_                     = {};
+    SlotMap<EntityTypeEnum> entity_types_                  = {};
     std::vector<std::pair<EntityId, std::tuple<EntityId, proto::SceneStaticMesh::RenderTimeEnum>>>
         mesh_material_ids_ = {};
+    // Flat scene graph, built lazily as the parent of a node can be added after it.
+    mutable SceneGraph scene_graph_      = {};
+    mutable bool scene_graph_need_build_ = true;
+    double latest_update_time_           = 0.0;
+    // Hierarchy over the world volumes of the nodes with a mesh, refitted with the world models.
+    mutable Bvh bvh_                                                             = {};
+    mutable std::unordered_map<EntityId, BoundingVolume> world_bounding_volumes_ = {};
+    mutable bool bvh_need_build_                                                 = true;
 };
 
 }  // End namespace frame.
@@ -7,6 +7,7 @@
 #include "frame/buffer_interface.h"
 #include "frame/camera.h"
 #include "frame/entity_id.h"
+#include "frame/frustum.h"
 #include "frame/material_interface.h"
 #include "frame/node_interface.h"
 #include "frame/program_interface.h"
@@ -123,6 +124,47 @@ class LevelInterface : public NameInterface {
      * @return Parent node id.
      */
     virtual EntityId GetParentId(EntityId id) const = 0;
+    /**
+     * @brief Update the world models of all the scene nodes at dt time (should be called once per
+     * frame before rendering).
+     * @param dt: Delta time from the beginning of the software running in seconds.
+     */
+    virtual void UpdateWorldModels(double dt) = 0;
+    /**
+     * @brief Get the world model of a scene node computed by the last UpdateWorldModels.
+     * @param id: Id of the scene node.
+     * @return The world model of the node.
+     */
+    virtual glm::mat4 GetWorldModelFromId(EntityId id) const = 0;
+    /**
+     * @brief Get the world volume of a scene node (the volume of its mesh moved by its world model
+     * and by each of its instances) computed by the last UpdateWorldModels.
+     * @param id: Id of the scene node.
+     * @return The world volume (empty if the node has no mesh or the mesh no volume).
+     */
+    virtual BoundingVolume GetWorldBoundingVolumeFromId(EntityId id) const = 0;
+    /**
+     * @brief Get the scene nodes whose world volume touches a frustum (through the hierarchy of
+     * world volumes, the nodes without volume are never returned).
+     * @param frustum: Frustum in world space.
+     * @return The ids of the scene nodes.
+     */
+    virtual std::vector<EntityId> GetNodesInFrustum(const Frustum& frustum) const = 0;
+    /**
+     * @brief Get the scene nodes whose world volume overlaps a box (range query).
+     * @param min: Minimum corner of the box in world space.
+     * @param max: Maximum corner of the box in world space.
+     * @return The ids of the scene nodes.
+     */
+    virtual std::vector<EntityId> GetNodesInBox(glm::vec3 min, glm::vec3 max) const = 0;
+    /**
+     * @brief Get the scene node whose world volume is the closest along a ray (see
+     * Camera::ComputeRayDirection to pick from the mouse position).
+     * @param origin: Origin of the ray in world space.
+     * @param direction: Direction of the ray in world space.
+     * @return The id of the closest scene node or NullId.
+     */
+    virtual EntityId PickNode(glm::vec3 origin, glm::vec3 direction) const = 0;
     /**
      * @brief Get the default quad static mesh id.
      * @return The id of the quad static mesh id or error.
@@ -153,6 +195,17 @@ class LevelInterface : public NameInterface {
      * @param model: The default environment model matrix.
      */
     virtual void SetDefaultEnvironmentModel(const glm::mat4& model) = 0;
+    /**
+     * @brief Check if the passes are scheduled by the frame graph (ordered from the textures they
+     * read and write, culled and sharing the memory of the transient textures).
+     * @return True if the frame graph is enabled.
+     */
+    virtual bool IsFrameGraphEnabled() const = 0;
+    /**
+     * @brief Enable or disable the frame graph.
+     * @param enable: Should the frame graph schedule the passes.
+     */
+    virtual void SetFrameGraphEnabled(bool enable) = 0;
     /**
      * @brief Add scene node to the scene tree.
      * @param scene_node: Move a scene node to the scene tree.
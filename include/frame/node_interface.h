@@ -33,6 +33,13 @@ struct NodeInterface : public NameInterface {
      * @return A mat4 representing the local model matrix.
      */
     virtual glm::mat4 GetLocalModel(double dt) const = 0;
+    /**
+     * @brief Compute the transform of current node relative to its parent (without walking up the
+     * tree), this is what the scene graph uses to compute the world models.
+     * @param dt: Delta time from the beginning of the software running in seconds.
+     * @return A mat4 representing the transform relative to the parent.
+     */
+    virtual glm::mat4 GetLocalTransform(double dt) const { return glm::mat4(1.0f); }
 
    public:
     /**
@@ -190,6 +190,7 @@ class Level final :
     kNameFieldNumber = 1,
     kDefaultTextureNameFieldNumber = 2,
     kSceneTreeFieldNumber = 7,
+    kFrameGraphFieldNumber = 9,
   };
   // repeated .frame.proto.Texture textures = 5;
   int textures_size() const;
@@ -291,6 +292,15 @@ class Level final :
       ::frame::proto::SceneTree* scene_tree);
   ::frame::proto::SceneTree* unsafe_arena_release_scene_tree();
 
+  // bool frame_graph = 9;
+  void clear_frame_graph();
+  bool frame_graph() const;
+  void set_frame_graph(bool value);
+  private:
+  bool _internal_frame_graph() const;
+  void _internal_set_frame_graph(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:frame.proto.Level)
  private:
   class _Internal;
@@ -305,6 +315,7 @@ class Level final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr default_texture_name_;
     ::frame::proto::SceneTree* scene_tree_;
+    bool frame_graph_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -617,6 +628,26 @@ Level::materials() const {
   return _impl_.materials_;
 }
 
+// bool frame_graph = 9;
+inline void Level::clear_frame_graph() {
+  _impl_.frame_graph_ = false;
+}
+inline bool Level::_internal_frame_graph() const {
+  return _impl_.frame_graph_;
+}
+inline bool Level::frame_graph() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Level.frame_graph)
+  return _internal_frame_graph();
+}
+inline void Level::_internal_set_frame_graph(bool value) {
+  
+  _impl_.frame_graph_ = value;
+}
+inline void Level::set_frame_graph(bool value) {
+  _internal_set_frame_graph(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Level.frame_graph)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -616,16 +616,62 @@ class SceneStaticMesh final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kInstanceMatricesFieldNumber = 12,
+    kLodScreenSizesFieldNumber = 17,
     kNameFieldNumber = 1,
     kParentFieldNumber = 2,
     kMaterialNameFieldNumber = 5,
     kRenderPrimitiveEnumFieldNumber = 8,
     kRenderTimeEnumFieldNumber = 11,
+    kInterleavedFieldNumber = 13,
+    kOptimizeFieldNumber = 14,
+    kCompiledFieldNumber = 15,
+    kLodCountFieldNumber = 16,
     kCleanBufferFieldNumber = 7,
     kMeshEnumFieldNumber = 6,
     kFileNameFieldNumber = 3,
     kMultiPluginFieldNumber = 10,
   };
+  // repeated .frame.proto.UniformMatrix4 instance_matrices = 12;
+  int instance_matrices_size() const;
+  private:
+  int _internal_instance_matrices_size() const;
+  public:
+  void clear_instance_matrices();
+  ::frame::proto::UniformMatrix4* mutable_instance_matrices(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::frame::proto::UniformMatrix4 >*
+      mutable_instance_matrices();
+  private:
+  const ::frame::proto::UniformMatrix4& _internal_instance_matrices(int index) const;
+  ::frame::proto::UniformMatrix4* _internal_add_instance_matrices();
+  public:
+  const ::frame::proto::UniformMatrix4& instance_matrices(int index) const;
+  ::frame::proto::UniformMatrix4* add_instance_matrices();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::frame::proto::UniformMatrix4 >&
+      instance_matrices() const;
+
+  // repeated float lod_screen_sizes = 17;
+  int lod_screen_sizes_size() const;
+  private:
+  int _internal_lod_screen_sizes_size() const;
+  public:
+  void clear_lod_screen_sizes();
+  private:
+  float _internal_lod_screen_sizes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_lod_screen_sizes() const;
+  void _internal_add_lod_screen_sizes(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_lod_screen_sizes();
+  public:
+  float lod_screen_sizes(int index) const;
+  void set_lod_screen_sizes(int index, float value);
+  void add_lod_screen_sizes(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      lod_screen_sizes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_lod_screen_sizes();
+
   // string name = 1;
   void clear_name();
   const std::string& name() const;
@@ -686,6 +732,42 @@ class SceneStaticMesh final :
   void _internal_set_render_time_enum(::frame::proto::SceneStaticMesh_RenderTimeEnum value);
   public:
 
+  // bool interleaved = 13;
+  void clear_interleaved();
+  bool interleaved() const;
+  void set_interleaved(bool value);
+  private:
+  bool _internal_interleaved() const;
+  void _internal_set_interleaved(bool value);
+  public:
+
+  // bool optimize = 14;
+  void clear_optimize();
+  bool optimize() const;
+  void set_optimize(bool value);
+  private:
+  bool _internal_optimize() const;
+  void _internal_set_optimize(bool value);
+  public:
+
+  // bool compiled = 15;
+  void clear_compiled();
+  bool compiled() const;
+  void set_compiled(bool value);
+  private:
+  bool _internal_compiled() const;
+  void _internal_set_compiled(bool value);
+  public:
+
+  // uint32 lod_count = 16;
+  void clear_lod_count();
+  uint32_t lod_count() const;
+  void set_lod_count(uint32_t value);
+  private:
+  uint32_t _internal_lod_count() const;
+  void _internal_set_lod_count(uint32_t value);
+  public:
+
   // .frame.proto.CleanBuffer clean_buffer = 7;
   bool has_clean_buffer() const;
   private:
@@ -770,11 +852,17 @@ class SceneStaticMesh final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::frame::proto::UniformMatrix4 > instance_matrices_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > lod_screen_sizes_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr material_name_;
     int render_primitive_enum_;
     int render_time_enum_;
+    bool interleaved_;
+    bool optimize_;
+    bool compiled_;
+    uint32_t lod_count_;
     union MeshOneofUnion {
       constexpr MeshOneofUnion() : _constinit_{} {}
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
@@ -2332,6 +2420,170 @@ inline void SceneStaticMesh::set_render_time_enum(::frame::proto::SceneStaticMes
   // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.render_time_enum)
 }
 
+// repeated .frame.proto.UniformMatrix4 instance_matrices = 12;
+inline int SceneStaticMesh::_internal_instance_matrices_size() const {
+  return _impl_.instance_matrices_.size();
+}
+inline int SceneStaticMesh::instance_matrices_size() const {
+  return _internal_instance_matrices_size();
+}
+inline ::frame::proto::UniformMatrix4* SceneStaticMesh::mutable_instance_matrices(int index) {
+  // @@protoc_insertion_point(field_mutable:frame.proto.SceneStaticMesh.instance_matrices)
+  return _impl_.instance_matrices_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::frame::proto::UniformMatrix4 >*
+SceneStaticMesh::mutable_instance_matrices() {
+  // @@protoc_insertion_point(field_mutable_list:frame.proto.SceneStaticMesh.instance_matrices)
+  return &_impl_.instance_matrices_;
+}
+inline const ::frame::proto::UniformMatrix4& SceneStaticMesh::_internal_instance_matrices(int index) const {
+  return _impl_.instance_matrices_.Get(index);
+}
+inline const ::frame::proto::UniformMatrix4& SceneStaticMesh::instance_matrices(int index) const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.instance_matrices)
+  return _internal_instance_matrices(index);
+}
+inline ::frame::proto::UniformMatrix4* SceneStaticMesh::_internal_add_instance_matrices() {
+  return _impl_.instance_matrices_.Add();
+}
+inline ::frame::proto::UniformMatrix4* SceneStaticMesh::add_instance_matrices() {
+  ::frame::proto::UniformMatrix4* _add = _internal_add_instance_matrices();
+  // @@protoc_insertion_point(field_add:frame.proto.SceneStaticMesh.instance_matrices)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::frame::proto::UniformMatrix4 >&
+SceneStaticMesh::instance_matrices() const {
+  // @@protoc_insertion_point(field_list:frame.proto.SceneStaticMesh.instance_matrices)
+  return _impl_.instance_matrices_;
+}
+
+// bool interleaved = 13;
+inline void SceneStaticMesh::clear_interleaved() {
+  _impl_.interleaved_ = false;
+}
+inline bool SceneStaticMesh::_internal_interleaved() const {
+  return _impl_.interleaved_;
+}
+inline bool SceneStaticMesh::interleaved() const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.interleaved)
+  return _internal_interleaved();
+}
+inline void SceneStaticMesh::_internal_set_interleaved(bool value) {
+  
+  _impl_.interleaved_ = value;
+}
+inline void SceneStaticMesh::set_interleaved(bool value) {
+  _internal_set_interleaved(value);
+  // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.interleaved)
+}
+
+// bool optimize = 14;
+inline void SceneStaticMesh::clear_optimize() {
+  _impl_.optimize_ = false;
+}
+inline bool SceneStaticMesh::_internal_optimize() const {
+  return _impl_.optimize_;
+}
+inline bool SceneStaticMesh::optimize() const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.optimize)
+  return _internal_optimize();
+}
+inline void SceneStaticMesh::_internal_set_optimize(bool value) {
+  
+  _impl_.optimize_ = value;
+}
+inline void SceneStaticMesh::set_optimize(bool value) {
+  _internal_set_optimize(value);
+  // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.optimize)
+}
+
+// bool compiled = 15;
+inline void SceneStaticMesh::clear_compiled() {
+  _impl_.compiled_ = false;
+}
+inline bool SceneStaticMesh::_internal_compiled() const {
+  return _impl_.compiled_;
+}
+inline bool SceneStaticMesh::compiled() const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.compiled)
+  return _internal_compiled();
+}
+inline void SceneStaticMesh::_internal_set_compiled(bool value) {
+  
+  _impl_.compiled_ = value;
+}
+inline void SceneStaticMesh::set_compiled(bool value) {
+  _internal_set_compiled(value);
+  // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.compiled)
+}
+
+// uint32 lod_count = 16;
+inline void SceneStaticMesh::clear_lod_count() {
+  _impl_.lod_count_ = 0u;
+}
+inline uint32_t SceneStaticMesh::_internal_lod_count() const {
+  return _impl_.lod_count_;
+}
+inline uint32_t SceneStaticMesh::lod_count() const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.lod_count)
+  return _internal_lod_count();
+}
+inline void SceneStaticMesh::_internal_set_lod_count(uint32_t value) {
+  
+  _impl_.lod_count_ = value;
+}
+inline void SceneStaticMesh::set_lod_count(uint32_t value) {
+  _internal_set_lod_count(value);
+  // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.lod_count)
+}
+
+// repeated float lod_screen_sizes = 17;
+inline int SceneStaticMesh::_internal_lod_screen_sizes_size() const {
+  return _impl_.lod_screen_sizes_.size();
+}
+inline int SceneStaticMesh::lod_screen_sizes_size() const {
+  return _internal_lod_screen_sizes_size();
+}
+inline void SceneStaticMesh::clear_lod_screen_sizes() {
+  _impl_.lod_screen_sizes_.Clear();
+}
+inline float SceneStaticMesh::_internal_lod_screen_sizes(int index) const {
+  return _impl_.lod_screen_sizes_.Get(index);
+}
+inline float SceneStaticMesh::lod_screen_sizes(int index) const {
+  // @@protoc_insertion_point(field_get:frame.proto.SceneStaticMesh.lod_screen_sizes)
+  return _internal_lod_screen_sizes(index);
+}
+inline void SceneStaticMesh::set_lod_screen_sizes(int index, float value) {
+  _impl_.lod_screen_sizes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:frame.proto.SceneStaticMesh.lod_screen_sizes)
+}
+inline void SceneStaticMesh::_internal_add_lod_screen_sizes(float value) {
+  _impl_.lod_screen_sizes_.Add(value);
+}
+inline void SceneStaticMesh::add_lod_screen_sizes(float value) {
+  _internal_add_lod_screen_sizes(value);
+  // @@protoc_insertion_point(field_add:frame.proto.SceneStaticMesh.lod_screen_sizes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SceneStaticMesh::_internal_lod_screen_sizes() const {
+  return _impl_.lod_screen_sizes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SceneStaticMesh::lod_screen_sizes() const {
+  // @@protoc_insertion_point(field_list:frame.proto.SceneStaticMesh.lod_screen_sizes)
+  return _internal_lod_screen_sizes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SceneStaticMesh::_internal_mutable_lod_screen_sizes() {
+  return &_impl_.lod_screen_sizes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SceneStaticMesh::mutable_lod_screen_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:frame.proto.SceneStaticMesh.lod_screen_sizes)
+  return _internal_mutable_lod_screen_sizes();
+}
+
 inline bool SceneStaticMesh::has_mesh_oneof() const {
   return mesh_oneof_case() != MESH_ONEOF_NOT_SET;
 }
@@ -53,6 +53,12 @@ namespace proto {
 class CubeMapFiles;
 struct CubeMapFilesDefaultTypeInternal;
 extern CubeMapFilesDefaultTypeInternal _CubeMapFiles_default_instance_;
+class MipmapFilter;
+struct MipmapFilterDefaultTypeInternal;
+extern MipmapFilterDefaultTypeInternal _MipmapFilter_default_instance_;
+class Prefilter;
+struct PrefilterDefaultTypeInternal;
+extern PrefilterDefaultTypeInternal _Prefilter_default_instance_;
 class Texture;
 struct TextureDefaultTypeInternal;
 extern TextureDefaultTypeInternal _Texture_default_instance_;
@@ -66,6 +72,8 @@ extern TextureFrameDefaultTypeInternal _TextureFrame_default_instance_;
 }  // namespace frame
 PROTOBUF_NAMESPACE_OPEN
 template<> ::frame::proto::CubeMapFiles* Arena::CreateMaybeMessage<::frame::proto::CubeMapFiles>(Arena*);
+template<> ::frame::proto::MipmapFilter* Arena::CreateMaybeMessage<::frame::proto::MipmapFilter>(Arena*);
+template<> ::frame::proto::Prefilter* Arena::CreateMaybeMessage<::frame::proto::Prefilter>(Arena*);
 template<> ::frame::proto::Texture* Arena::CreateMaybeMessage<::frame::proto::Texture>(Arena*);
 template<> ::frame::proto::TextureFilter* Arena::CreateMaybeMessage<::frame::proto::TextureFilter>(Arena*);
 template<> ::frame::proto::TextureFrame* Arena::CreateMaybeMessage<::frame::proto::TextureFrame>(Arena*);
@@ -138,6 +146,33 @@ inline bool TextureFrame_Enum_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TextureFrame_Enum>(
     TextureFrame_Enum_descriptor(), name, value);
 }
+enum MipmapFilter_Enum : int {
+  MipmapFilter_Enum_GPU = 0,
+  MipmapFilter_Enum_BOX = 1,
+  MipmapFilter_Enum_SRGB = 2,
+  MipmapFilter_Enum_NORMAL = 3,
+  MipmapFilter_Enum_MipmapFilter_Enum_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MipmapFilter_Enum_MipmapFilter_Enum_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MipmapFilter_Enum_IsValid(int value);
+constexpr MipmapFilter_Enum MipmapFilter_Enum_Enum_MIN = MipmapFilter_Enum_GPU;
+constexpr MipmapFilter_Enum MipmapFilter_Enum_Enum_MAX = MipmapFilter_Enum_NORMAL;
+constexpr int MipmapFilter_Enum_Enum_ARRAYSIZE = MipmapFilter_Enum_Enum_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MipmapFilter_Enum_descriptor();
+template<typename T>
+inline const std::string& MipmapFilter_Enum_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MipmapFilter_Enum>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MipmapFilter_Enum_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MipmapFilter_Enum_descriptor(), enum_t_value);
+}
+inline bool MipmapFilter_Enum_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MipmapFilter_Enum* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MipmapFilter_Enum>(
+    MipmapFilter_Enum_descriptor(), name, value);
+}
 // ===================================================================
 
 class TextureFilter final :
@@ -526,6 +561,188 @@ class TextureFrame final :
 };
 // -------------------------------------------------------------------
 
+class MipmapFilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:frame.proto.MipmapFilter) */ {
+ public:
+  inline MipmapFilter() : MipmapFilter(nullptr) {}
+  ~MipmapFilter() override;
+  explicit PROTOBUF_CONSTEXPR MipmapFilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MipmapFilter(const MipmapFilter& from);
+  MipmapFilter(MipmapFilter&& from) noexcept
+    : MipmapFilter() {
+    *this = ::std::move(from);
+  }
+
+  inline MipmapFilter& operator=(const MipmapFilter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MipmapFilter& operator=(MipmapFilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MipmapFilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MipmapFilter* internal_default_instance() {
+    return reinterpret_cast<const MipmapFilter*>(
+               &_MipmapFilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MipmapFilter& a, MipmapFilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MipmapFilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MipmapFilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MipmapFilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MipmapFilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MipmapFilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MipmapFilter& from) {
+    MipmapFilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MipmapFilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "frame.proto.MipmapFilter";
+  }
+  protected:
+  explicit MipmapFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef MipmapFilter_Enum Enum;
+  static constexpr Enum GPU =
+    MipmapFilter_Enum_GPU;
+  static constexpr Enum BOX =
+    MipmapFilter_Enum_BOX;
+  static constexpr Enum SRGB =
+    MipmapFilter_Enum_SRGB;
+  static constexpr Enum NORMAL =
+    MipmapFilter_Enum_NORMAL;
+  static inline bool Enum_IsValid(int value) {
+    return MipmapFilter_Enum_IsValid(value);
+  }
+  static constexpr Enum Enum_MIN =
+    MipmapFilter_Enum_Enum_MIN;
+  static constexpr Enum Enum_MAX =
+    MipmapFilter_Enum_Enum_MAX;
+  static constexpr int Enum_ARRAYSIZE =
+    MipmapFilter_Enum_Enum_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Enum_descriptor() {
+    return MipmapFilter_Enum_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Enum_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Enum>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Enum_Name.");
+    return MipmapFilter_Enum_Name(enum_t_value);
+  }
+  static inline bool Enum_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Enum* value) {
+    return MipmapFilter_Enum_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // .frame.proto.MipmapFilter.Enum value = 1;
+  void clear_value();
+  ::frame::proto::MipmapFilter_Enum value() const;
+  void set_value(::frame::proto::MipmapFilter_Enum value);
+  private:
+  ::frame::proto::MipmapFilter_Enum _internal_value() const;
+  void _internal_set_value(::frame::proto::MipmapFilter_Enum value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:frame.proto.MipmapFilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_texture_2eproto;
+};
+// -------------------------------------------------------------------
+
 class CubeMapFiles final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:frame.proto.CubeMapFiles) */ {
  public:
@@ -574,7 +791,7 @@ class CubeMapFiles final :
                &_CubeMapFiles_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(CubeMapFiles& a, CubeMapFiles& b) {
     a.Swap(&b);
@@ -759,6 +976,181 @@ class CubeMapFiles final :
 };
 // -------------------------------------------------------------------
 
+class Prefilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:frame.proto.Prefilter) */ {
+ public:
+  inline Prefilter() : Prefilter(nullptr) {}
+  ~Prefilter() override;
+  explicit PROTOBUF_CONSTEXPR Prefilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Prefilter(const Prefilter& from);
+  Prefilter(Prefilter&& from) noexcept
+    : Prefilter() {
+    *this = ::std::move(from);
+  }
+
+  inline Prefilter& operator=(const Prefilter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Prefilter& operator=(Prefilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Prefilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Prefilter* internal_default_instance() {
+    return reinterpret_cast<const Prefilter*>(
+               &_Prefilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Prefilter& a, Prefilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Prefilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Prefilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Prefilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Prefilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Prefilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Prefilter& from) {
+    Prefilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Prefilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "frame.proto.Prefilter";
+  }
+  protected:
+  explicit Prefilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kMipCountFieldNumber = 2,
+    kSampleCountFieldNumber = 3,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint32 mip_count = 2;
+  void clear_mip_count();
+  uint32_t mip_count() const;
+  void set_mip_count(uint32_t value);
+  private:
+  uint32_t _internal_mip_count() const;
+  void _internal_set_mip_count(uint32_t value);
+  public:
+
+  // uint32 sample_count = 3;
+  void clear_sample_count();
+  uint32_t sample_count() const;
+  void set_sample_count(uint32_t value);
+  private:
+  uint32_t _internal_sample_count() const;
+  void _internal_set_sample_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:frame.proto.Prefilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t mip_count_;
+    uint32_t sample_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_texture_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Texture final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:frame.proto.Texture) */ {
  public:
@@ -815,7 +1207,7 @@ class Texture final :
                &_Texture_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
   friend void swap(Texture& a, Texture& b) {
     a.Swap(&b);
@@ -897,10 +1289,15 @@ class Texture final :
     kMagFilterFieldNumber = 10,
     kWrapSFieldNumber = 11,
     kWrapTFieldNumber = 12,
+    kPrefilterFieldNumber = 20,
+    kMipmapFilterFieldNumber = 21,
     kClearZFieldNumber = 3,
     kClearColorFieldNumber = 16,
     kMipmapFieldNumber = 4,
+    kImmutableFieldNumber = 23,
     kCubemapFieldNumber = 5,
+    kTransientFieldNumber = 19,
+    kMaxAnisotropyFieldNumber = 22,
     kPixelsFieldNumber = 14,
     kFileNameFieldNumber = 15,
     kPluginFieldNumber = 17,
@@ -1060,6 +1457,42 @@ class Texture final :
       ::frame::proto::TextureFilter* wrap_t);
   ::frame::proto::TextureFilter* unsafe_arena_release_wrap_t();
 
+  // .frame.proto.Prefilter prefilter = 20;
+  bool has_prefilter() const;
+  private:
+  bool _internal_has_prefilter() const;
+  public:
+  void clear_prefilter();
+  const ::frame::proto::Prefilter& prefilter() const;
+  PROTOBUF_NODISCARD ::frame::proto::Prefilter* release_prefilter();
+  ::frame::proto::Prefilter* mutable_prefilter();
+  void set_allocated_prefilter(::frame::proto::Prefilter* prefilter);
+  private:
+  const ::frame::proto::Prefilter& _internal_prefilter() const;
+  ::frame::proto::Prefilter* _internal_mutable_prefilter();
+  public:
+  void unsafe_arena_set_allocated_prefilter(
+      ::frame::proto::Prefilter* prefilter);
+  ::frame::proto::Prefilter* unsafe_arena_release_prefilter();
+
+  // .frame.proto.MipmapFilter mipmap_filter = 21;
+  bool has_mipmap_filter() const;
+  private:
+  bool _internal_has_mipmap_filter() const;
+  public:
+  void clear_mipmap_filter();
+  const ::frame::proto::MipmapFilter& mipmap_filter() const;
+  PROTOBUF_NODISCARD ::frame::proto::MipmapFilter* release_mipmap_filter();
+  ::frame::proto::MipmapFilter* mutable_mipmap_filter();
+  void set_allocated_mipmap_filter(::frame::proto::MipmapFilter* mipmap_filter);
+  private:
+  const ::frame::proto::MipmapFilter& _internal_mipmap_filter() const;
+  ::frame::proto::MipmapFilter* _internal_mutable_mipmap_filter();
+  public:
+  void unsafe_arena_set_allocated_mipmap_filter(
+      ::frame::proto::MipmapFilter* mipmap_filter);
+  ::frame::proto::MipmapFilter* unsafe_arena_release_mipmap_filter();
+
   // bool clear_z = 3;
   void clear_clear_z();
   bool clear_z() const;
@@ -1087,6 +1520,15 @@ class Texture final :
   void _internal_set_mipmap(bool value);
   public:
 
+  // bool immutable = 23;
+  void clear_immutable();
+  bool immutable() const;
+  void set_immutable(bool value);
+  private:
+  bool _internal_immutable() const;
+  void _internal_set_immutable(bool value);
+  public:
+
   // bool cubemap = 5;
   void clear_cubemap();
   bool cubemap() const;
@@ -1096,6 +1538,24 @@ class Texture final :
   void _internal_set_cubemap(bool value);
   public:
 
+  // bool transient = 19;
+  void clear_transient();
+  bool transient() const;
+  void set_transient(bool value);
+  private:
+  bool _internal_transient() const;
+  void _internal_set_transient(bool value);
+  public:
+
+  // float max_anisotropy = 22;
+  void clear_max_anisotropy();
+  float max_anisotropy() const;
+  void set_max_anisotropy(float value);
+  private:
+  float _internal_max_anisotropy() const;
+  void _internal_set_max_anisotropy(float value);
+  public:
+
   // bytes pixels = 14;
   bool has_pixels() const;
   private:
@@ -1194,10 +1654,15 @@ class Texture final :
     ::frame::proto::TextureFilter* mag_filter_;
     ::frame::proto::TextureFilter* wrap_s_;
     ::frame::proto::TextureFilter* wrap_t_;
+    ::frame::proto::Prefilter* prefilter_;
+    ::frame::proto::MipmapFilter* mipmap_filter_;
     bool clear_z_;
     bool clear_color_;
     bool mipmap_;
+    bool immutable_;
     bool cubemap_;
+    bool transient_;
+    float max_anisotropy_;
     union TextureOneofUnion {
       constexpr TextureOneofUnion() : _constinit_{} {}
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
@@ -1270,6 +1735,30 @@ inline void TextureFrame::set_value(::frame::proto::TextureFrame_Enum value) {
 
 // -------------------------------------------------------------------
 
+// MipmapFilter
+
+// .frame.proto.MipmapFilter.Enum value = 1;
+inline void MipmapFilter::clear_value() {
+  _impl_.value_ = 0;
+}
+inline ::frame::proto::MipmapFilter_Enum MipmapFilter::_internal_value() const {
+  return static_cast< ::frame::proto::MipmapFilter_Enum >(_impl_.value_);
+}
+inline ::frame::proto::MipmapFilter_Enum MipmapFilter::value() const {
+  // @@protoc_insertion_point(field_get:frame.proto.MipmapFilter.value)
+  return _internal_value();
+}
+inline void MipmapFilter::_internal_set_value(::frame::proto::MipmapFilter_Enum value) {
+  
+  _impl_.value_ = value;
+}
+inline void MipmapFilter::set_value(::frame::proto::MipmapFilter_Enum value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:frame.proto.MipmapFilter.value)
+}
+
+// -------------------------------------------------------------------
+
 // CubeMapFiles
 
 // string positive_x = 1;
@@ -1574,6 +2063,100 @@ inline void CubeMapFiles::set_allocated_negative_z(std::string* negative_z) {
 
 // -------------------------------------------------------------------
 
+// Prefilter
+
+// string name = 1;
+inline void Prefilter::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Prefilter::name() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Prefilter.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Prefilter::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:frame.proto.Prefilter.name)
+}
+inline std::string* Prefilter::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:frame.proto.Prefilter.name)
+  return _s;
+}
+inline const std::string& Prefilter::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Prefilter::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Prefilter::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Prefilter::release_name() {
+  // @@protoc_insertion_point(field_release:frame.proto.Prefilter.name)
+  return _impl_.name_.Release();
+}
+inline void Prefilter::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:frame.proto.Prefilter.name)
+}
+
+// uint32 mip_count = 2;
+inline void Prefilter::clear_mip_count() {
+  _impl_.mip_count_ = 0u;
+}
+inline uint32_t Prefilter::_internal_mip_count() const {
+  return _impl_.mip_count_;
+}
+inline uint32_t Prefilter::mip_count() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Prefilter.mip_count)
+  return _internal_mip_count();
+}
+inline void Prefilter::_internal_set_mip_count(uint32_t value) {
+  
+  _impl_.mip_count_ = value;
+}
+inline void Prefilter::set_mip_count(uint32_t value) {
+  _internal_set_mip_count(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Prefilter.mip_count)
+}
+
+// uint32 sample_count = 3;
+inline void Prefilter::clear_sample_count() {
+  _impl_.sample_count_ = 0u;
+}
+inline uint32_t Prefilter::_internal_sample_count() const {
+  return _impl_.sample_count_;
+}
+inline uint32_t Prefilter::sample_count() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Prefilter.sample_count)
+  return _internal_sample_count();
+}
+inline void Prefilter::_internal_set_sample_count(uint32_t value) {
+  
+  _impl_.sample_count_ = value;
+}
+inline void Prefilter::set_sample_count(uint32_t value) {
+  _internal_set_sample_count(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Prefilter.sample_count)
+}
+
+// -------------------------------------------------------------------
+
 // Texture
 
 // string name = 1;
@@ -1771,6 +2354,136 @@ inline void Texture::set_mipmap(bool value) {
   // @@protoc_insertion_point(field_set:frame.proto.Texture.mipmap)
 }
 
+// .frame.proto.MipmapFilter mipmap_filter = 21;
+inline bool Texture::_internal_has_mipmap_filter() const {
+  return this != internal_default_instance() && _impl_.mipmap_filter_ != nullptr;
+}
+inline bool Texture::has_mipmap_filter() const {
+  return _internal_has_mipmap_filter();
+}
+inline void Texture::clear_mipmap_filter() {
+  if (GetArenaForAllocation() == nullptr && _impl_.mipmap_filter_ != nullptr) {
+    delete _impl_.mipmap_filter_;
+  }
+  _impl_.mipmap_filter_ = nullptr;
+}
+inline const ::frame::proto::MipmapFilter& Texture::_internal_mipmap_filter() const {
+  const ::frame::proto::MipmapFilter* p = _impl_.mipmap_filter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::frame::proto::MipmapFilter&>(
+      ::frame::proto::_MipmapFilter_default_instance_);
+}
+inline const ::frame::proto::MipmapFilter& Texture::mipmap_filter() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Texture.mipmap_filter)
+  return _internal_mipmap_filter();
+}
+inline void Texture::unsafe_arena_set_allocated_mipmap_filter(
+    ::frame::proto::MipmapFilter* mipmap_filter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mipmap_filter_);
+  }
+  _impl_.mipmap_filter_ = mipmap_filter;
+  if (mipmap_filter) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:frame.proto.Texture.mipmap_filter)
+}
+inline ::frame::proto::MipmapFilter* Texture::release_mipmap_filter() {
+  
+  ::frame::proto::MipmapFilter* temp = _impl_.mipmap_filter_;
+  _impl_.mipmap_filter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::frame::proto::MipmapFilter* Texture::unsafe_arena_release_mipmap_filter() {
+  // @@protoc_insertion_point(field_release:frame.proto.Texture.mipmap_filter)
+  
+  ::frame::proto::MipmapFilter* temp = _impl_.mipmap_filter_;
+  _impl_.mipmap_filter_ = nullptr;
+  return temp;
+}
+inline ::frame::proto::MipmapFilter* Texture::_internal_mutable_mipmap_filter() {
+  
+  if (_impl_.mipmap_filter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::frame::proto::MipmapFilter>(GetArenaForAllocation());
+    _impl_.mipmap_filter_ = p;
+  }
+  return _impl_.mipmap_filter_;
+}
+inline ::frame::proto::MipmapFilter* Texture::mutable_mipmap_filter() {
+  ::frame::proto::MipmapFilter* _msg = _internal_mutable_mipmap_filter();
+  // @@protoc_insertion_point(field_mutable:frame.proto.Texture.mipmap_filter)
+  return _msg;
+}
+inline void Texture::set_allocated_mipmap_filter(::frame::proto::MipmapFilter* mipmap_filter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mipmap_filter_;
+  }
+  if (mipmap_filter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mipmap_filter);
+    if (message_arena != submessage_arena) {
+      mipmap_filter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mipmap_filter, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.mipmap_filter_ = mipmap_filter;
+  // @@protoc_insertion_point(field_set_allocated:frame.proto.Texture.mipmap_filter)
+}
+
+// float max_anisotropy = 22;
+inline void Texture::clear_max_anisotropy() {
+  _impl_.max_anisotropy_ = 0;
+}
+inline float Texture::_internal_max_anisotropy() const {
+  return _impl_.max_anisotropy_;
+}
+inline float Texture::max_anisotropy() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Texture.max_anisotropy)
+  return _internal_max_anisotropy();
+}
+inline void Texture::_internal_set_max_anisotropy(float value) {
+  
+  _impl_.max_anisotropy_ = value;
+}
+inline void Texture::set_max_anisotropy(float value) {
+  _internal_set_max_anisotropy(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Texture.max_anisotropy)
+}
+
+// bool immutable = 23;
+inline void Texture::clear_immutable() {
+  _impl_.immutable_ = false;
+}
+inline bool Texture::_internal_immutable() const {
+  return _impl_.immutable_;
+}
+inline bool Texture::immutable() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Texture.immutable)
+  return _internal_immutable();
+}
+inline void Texture::_internal_set_immutable(bool value) {
+  
+  _impl_.immutable_ = value;
+}
+inline void Texture::set_immutable(bool value) {
+  _internal_set_immutable(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Texture.immutable)
+}
+
 // bool cubemap = 5;
 inline void Texture::clear_cubemap() {
   _impl_.cubemap_ = false;
@@ -1841,6 +2554,96 @@ inline void Texture::set_allocated_irradiance(std::string* irradiance) {
   // @@protoc_insertion_point(field_set_allocated:frame.proto.Texture.irradiance)
 }
 
+// .frame.proto.Prefilter prefilter = 20;
+inline bool Texture::_internal_has_prefilter() const {
+  return this != internal_default_instance() && _impl_.prefilter_ != nullptr;
+}
+inline bool Texture::has_prefilter() const {
+  return _internal_has_prefilter();
+}
+inline void Texture::clear_prefilter() {
+  if (GetArenaForAllocation() == nullptr && _impl_.prefilter_ != nullptr) {
+    delete _impl_.prefilter_;
+  }
+  _impl_.prefilter_ = nullptr;
+}
+inline const ::frame::proto::Prefilter& Texture::_internal_prefilter() const {
+  const ::frame::proto::Prefilter* p = _impl_.prefilter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::frame::proto::Prefilter&>(
+      ::frame::proto::_Prefilter_default_instance_);
+}
+inline const ::frame::proto::Prefilter& Texture::prefilter() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Texture.prefilter)
+  return _internal_prefilter();
+}
+inline void Texture::unsafe_arena_set_allocated_prefilter(
+    ::frame::proto::Prefilter* prefilter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.prefilter_);
+  }
+  _impl_.prefilter_ = prefilter;
+  if (prefilter) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:frame.proto.Texture.prefilter)
+}
+inline ::frame::proto::Prefilter* Texture::release_prefilter() {
+  
+  ::frame::proto::Prefilter* temp = _impl_.prefilter_;
+  _impl_.prefilter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::frame::proto::Prefilter* Texture::unsafe_arena_release_prefilter() {
+  // @@protoc_insertion_point(field_release:frame.proto.Texture.prefilter)
+  
+  ::frame::proto::Prefilter* temp = _impl_.prefilter_;
+  _impl_.prefilter_ = nullptr;
+  return temp;
+}
+inline ::frame::proto::Prefilter* Texture::_internal_mutable_prefilter() {
+  
+  if (_impl_.prefilter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::frame::proto::Prefilter>(GetArenaForAllocation());
+    _impl_.prefilter_ = p;
+  }
+  return _impl_.prefilter_;
+}
+inline ::frame::proto::Prefilter* Texture::mutable_prefilter() {
+  ::frame::proto::Prefilter* _msg = _internal_mutable_prefilter();
+  // @@protoc_insertion_point(field_mutable:frame.proto.Texture.prefilter)
+  return _msg;
+}
+inline void Texture::set_allocated_prefilter(::frame::proto::Prefilter* prefilter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.prefilter_;
+  }
+  if (prefilter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prefilter);
+    if (message_arena != submessage_arena) {
+      prefilter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prefilter, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.prefilter_ = prefilter;
+  // @@protoc_insertion_point(field_set_allocated:frame.proto.Texture.prefilter)
+}
+
 // .frame.proto.PixelElementSize pixel_element_size = 7;
 inline bool Texture::_internal_has_pixel_element_size() const {
   return this != internal_default_instance() && _impl_.pixel_element_size_ != nullptr;
@@ -2371,6 +3174,26 @@ inline void Texture::set_allocated_wrap_t(::frame::proto::TextureFilter* wrap_t)
   // @@protoc_insertion_point(field_set_allocated:frame.proto.Texture.wrap_t)
 }
 
+// bool transient = 19;
+inline void Texture::clear_transient() {
+  _impl_.transient_ = false;
+}
+inline bool Texture::_internal_transient() const {
+  return _impl_.transient_;
+}
+inline bool Texture::transient() const {
+  // @@protoc_insertion_point(field_get:frame.proto.Texture.transient)
+  return _internal_transient();
+}
+inline void Texture::_internal_set_transient(bool value) {
+  
+  _impl_.transient_ = value;
+}
+inline void Texture::set_transient(bool value) {
+  _internal_set_transient(value);
+  // @@protoc_insertion_point(field_set:frame.proto.Texture.transient)
+}
+
 // bytes pixels = 14;
 inline bool Texture::_internal_has_pixels() const {
   return texture_oneof_case() == kPixels;
@@ -2683,6 +3506,10 @@ inline Texture::TextureOneofCase Texture::texture_oneof_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -2701,6 +3528,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::frame::proto::TextureFrame_Enum>() {
   return ::frame::proto::TextureFrame_Enum_descriptor();
 }
+template <> struct is_proto_enum< ::frame::proto::MipmapFilter_Enum> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::frame::proto::MipmapFilter_Enum>() {
+  return ::frame::proto::MipmapFilter_Enum_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
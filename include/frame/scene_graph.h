@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "frame/entity_id.h"
+#include "frame/node_interface.h"
+
+namespace frame {
+
+/**
+ * @class SceneGraph
+ * @brief Flat version of the scene tree. The parents are resolved once when the graph is built and
+ * the nodes are stored in breadth first order in contiguous arrays (a parent always comes before
+ * its children and the children of a node are next to each other). The world models are then
+ * computed in a single linear pass, only for the nodes whose transform (or parent) changed.
+ */
+class SceneGraph {
+   public:
+    /**
+     * @brief Build the flat graph from a list of nodes (this invalidate all the world models).
+     * @param nodes: Vector of (node id, parent id (NullId for a root), node), the node pointers
+     * should stay valid as long as the graph is used.
+     */
+    void Build(const std::vector<std::tuple<EntityId, EntityId, const NodeInterface*>>& nodes);
+    /**
+     * @brief Update the world models at dt time.
+     * @param dt: Delta time from the beginning of the software running in seconds.
+     * @return The number of world models that were recomputed.
+     */
+    std::size_t Update(double dt);
+    /**
+     * @brief Get the world model computed by the last update.
+     * @param id: Id of the node.
+     * @return The world model of the node.
+     */
+    const glm::mat4& GetWorldModel(EntityId id) const;
+    /**
+     * @brief Get the nodes whose world model was recomputed by the last update.
+     * @return The ids of the updated nodes (parents before children).
+     */
+    const std::vector<EntityId>& GetUpdatedIds() const { return updated_ids_; }
+    /**
+     * @brief Get the list of children of a node.
+     * @param id: Id of the node.
+     * @return The ids of the children.
+     */
+    std::vector<EntityId> GetChildList(EntityId id) const;
+    /**
+     * @brief Get the parent of a node.
+     * @param id: Id of the node.
+     * @return The id of the parent or NullId for a root.
+     */
+    EntityId GetParentId(EntityId id) const;
+    /**
+     * @brief Check if a node is in the graph.
+     * @param id: Id of the node.
+     * @return True if the node is in the graph.
+     */
+    bool HasNode(EntityId id) const { return id_index_map_.count(id) != 0; }
+    /**
+     * @brief Get the number of nodes in the graph.
+     * @return Number of nodes.
+     */
+    std::size_t GetSize() const { return ids_.size(); }
+
+   protected:
+    /**
+     * @brief Get the index of a node in the arrays.
+     * @param id: Id of the node.
+     * @return The index of the node (throw if not found).
+     */
+    std::uint32_t GetIndex(EntityId id) const;
+
+   private:
+    // Value of the parent index of a root.
+    static constexpr std::uint32_t no_parent_                 = 0xffffffff;
+    std::vector<EntityId> ids_                                = {};
+    std::vector<const NodeInterface*> nodes_                  = {};
+    std::vector<std::uint32_t> parent_indices_                = {};
+    std::vector<std::uint32_t> first_child_indices_           = {};
+    std::vector<std::uint32_t> child_counts_                  = {};
+    std::vector<glm::mat4> local_models_                      = {};
+    std::vector<glm::mat4> world_models_                      = {};
+    std::vector<std::uint8_t> dirty_flags_                    = {};
+    std::unordered_map<EntityId, std::uint32_t> id_index_map_ = {};
+    std::vector<EntityId> updated_ids_                        = {};
+    bool needs_full_update_                                   = true;
+};
+
+}  // End namespace frame.
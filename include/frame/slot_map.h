@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "frame/entity_id.h"
+
+namespace frame {
+
+/**
+ * @brief Get the slot index of an entity id (the lower 32 bits minus one as 0 is the NullId).
+ * @param id: Entity id.
+ * @return Slot index (0xffffffff for NullId).
+ */
+constexpr std::uint32_t GetEntityIndex(EntityId id) {
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(id) & 0xffffffff) - 1;
+}
+/**
+ * @brief Get the generation of an entity id (the upper 32 bits).
+ * @param id: Entity id.
+ * @return Generation of the slot when the id was created.
+ */
+constexpr std::uint32_t GetEntityGeneration(EntityId id) {
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(id) >> 32);
+}
+/**
+ * @brief Make an entity id from a slot index and a generation, the first generation of a slot
+ * give the same id as a simple counter would (1, 2, 3, ...).
+ * @param index: Slot index.
+ * @param generation: Generation of the slot.
+ * @return The entity id.
+ */
+constexpr EntityId MakeEntityId(std::uint32_t index, std::uint32_t generation) {
+    return static_cast<EntityId>((static_cast<std::uint64_t>(generation) << 32) |
+                                 (static_cast<std::uint64_t>(index) + 1));
+}
+
+/**
+ * @class EntityIdAllocator
+ * @brief Allocate generational entity ids, a freed slot is reused with the next generation so any
+ * id that was kept after the entity was removed is detected as stale.
+ */
+class EntityIdAllocator {
+   public:
+    /**
+     * @brief Allocate a new id (reuse a free slot if there is one).
+     * @return New entity id.
+     */
+    EntityId Allocate() {
+        if (free_indices_.empty()) {
+            generations_.push_back(0);
+            return MakeEntityId(static_cast<std::uint32_t>(generations_.size() - 1), 0);
+        }
+        const std::uint32_t index = free_indices_.back();
+        free_indices_.pop_back();
+        return MakeEntityId(index, generations_[index]);
+    }
+    /**
+     * @brief Free an id, the slot generation is increased so the id become stale.
+     * @param id: Id to be freed.
+     */
+    void Free(EntityId id) {
+        if (!IsAlive(id)) {
+            throw std::out_of_range("Freeing an invalid entity id #" + std::to_string(id) + ".");
+        }
+        const std::uint32_t index = GetEntityIndex(id);
+        // Keep the generation positive so the id stay positive.
+        generations_[index] = (generations_[index] + 1) & 0x7fffffff;
+        free_indices_.push_back(index);
+    }
+    /**
+     * @brief Check if an id is alive (allocated and not freed since).
+     * @param id: Id to be checked.
+     * @return True if the id is alive.
+     */
+    bool IsAlive(EntityId id) const {
+        const std::uint32_t index = GetEntityIndex(id);
+        // A freed slot already has the next generation, so its old ids are not alive.
+        return index < generations_.size() && generations_[index] == GetEntityGeneration(id);
+    }
+
+   private:
+    std::vector<std::uint32_t> generations_  = {};
+    std::vector<std::uint32_t> free_indices_ = {};
+};
+
+/**
+ * @class SlotMap
+ * @brief Sparse set of values indexed by entity id, the lookup is O(1) (an indirection through the
+ * sparse array) and the values are stored contiguously (iteration is over the dense arrays). The
+ * full id is stored next to the value so a stale id (same slot, older generation) is rejected.
+ * @warning Erase move the last value in place of the erased one, so the order of the dense arrays
+ * is not stable.
+ */
+template <typename T>
+class SlotMap {
+   public:
+    /**
+     * @brief Insert a value for an id.
+     * @param id: Id of the value (should not already be present).
+     * @param value: Value to be moved in.
+     * @return A reference to the inserted value.
+     */
+    T& Insert(EntityId id, T value) {
+        const std::uint32_t index = GetEntityIndex(id);
+        if (id == NullId) throw std::runtime_error("Inserting a null id.");
+        if (index >= sparse_.size()) sparse_.resize(static_cast<std::size_t>(index) + 1, npos_);
+        if (sparse_[index] != npos_) {
+            throw std::runtime_error("Slot of id #" + std::to_string(id) + " is already in use.");
+        }
+        sparse_[index] = static_cast<std::uint32_t>(dense_ids_.size());
+        dense_ids_.push_back(id);
+        dense_values_.push_back(std::move(value));
+        return dense_values_.back();
+    }
+    /**
+     * @brief Check if there is a value for this id (with the same generation).
+     * @param id: Id to be checked.
+     * @return True if the id is present.
+     */
+    bool Contains(EntityId id) const {
+        const std::uint32_t index = GetEntityIndex(id);
+        return index < sparse_.size() && sparse_[index] != npos_ &&
+               dense_ids_[sparse_[index]] == id;
+    }
+    /**
+     * @brief Get the value for an id.
+     * @param id: Id of the value.
+     * @return A reference to the value (throw std::out_of_range if the id is absent or stale).
+     */
+    T& At(EntityId id) { return dense_values_[GetDenseIndex(id)]; }
+    /**
+     * @brief Get the value for an id (const version).
+     * @param id: Id of the value.
+     * @return A const reference to the value (throw std::out_of_range if the id is absent or
+     * stale).
+     */
+    const T& At(EntityId id) const { return dense_values_[GetDenseIndex(id)]; }
+    /**
+     * @brief Remove the value of an id (the last value is moved in its place).
+     * @param id: Id of the value to be removed.
+     */
+    void Erase(EntityId id) {
+        const std::uint32_t dense_index = GetDenseIndex(id);
+        const std::uint32_t last_index  = static_cast<std::uint32_t>(dense_ids_.size() - 1);
+        if (dense_index != last_index) {
+            dense_ids_[dense_index]                          = dense_ids_[last_index];
+            dense_values_[dense_index]                       = std::move(dense_values_[last_index]);
+            sparse_[GetEntityIndex(dense_ids_[dense_index])] = dense_index;
+        }
+        sparse_[GetEntityIndex(id)] = npos_;
+        dense_ids_.pop_back();
+        dense_values_.pop_back();
+    }
+    //! @brief Remove all the values.
+    void Clear() {
+        dense_values_.clear();
+        dense_ids_.clear();
+        sparse_.clear();
+    }
+    /**
+     * @brief Get the number of values.
+     * @return Number of values.
+     */
+    std::size_t Size() const { return dense_ids_.size(); }
+    /**
+     * @brief Get the ids in dense order (same order as GetValues).
+     * @return Vector of ids.
+     */
+    const std::vector<EntityId>& GetIds() const { return dense_ids_; }
+    /**
+     * @brief Get the values in dense order (same order as GetIds).
+     * @return Vector of values.
+     */
+    const std::vector<T>& GetValues() const { return dense_values_; }
+
+   protected:
+    /**
+     * @brief Get the position of an id in the dense arrays.
+     * @param id: Id to be found.
+     * @return Position in the dense arrays (throw std::out_of_range if the id is absent or stale).
+     */
+    std::uint32_t GetDenseIndex(EntityId id) const {
+        if (!Contains(id)) {
+            throw std::out_of_range("No entity with id #" + std::to_string(id) + ".");
+        }
+        return sparse_[GetEntityIndex(id)];
+    }
+
+   private:
+    // Value of an empty slot in the sparse array.
+    static constexpr std::uint32_t npos_ = 0xffffffff;
+    std::vector<std::uint32_t> sparse_   = {};
+    std::vector<EntityId> dense_ids_     = {};
+    std::vector<T> dense_values_         = {};
+};
+
+}  // End namespace frame.
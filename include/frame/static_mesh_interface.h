@@ -1,13 +1,48 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "frame/bounding_volume.h"
 #include "frame/entity_id.h"
 #include "frame/json/proto.h"
 #include "frame/name_interface.h"
 
 namespace frame {
 
+/**
+ * @brief Format of a vertex attribute inside an interleaved vertex buffer.
+ */
+enum class VertexAttributeFormatEnum : std::uint8_t {
+    //! @brief 32 bit floats (size components).
+    FLOAT = 0,
+    //! @brief 16 bit floats (size components).
+    HALF_FLOAT = 1,
+    //! @brief Signed 10:10:10:2 packed in 32 bit (size should be 4).
+    INT_2_10_10_10_REV = 2,
+    //! @brief 8 bit unsigned integers (size components, usually normalized colors).
+    UNSIGNED_BYTE = 3,
+};
+
+/**
+ * @class VertexAttribute
+ * @brief Description of an attribute inside an interleaved vertex buffer.
+ */
+struct VertexAttribute {
+    //! @brief Location of the attribute in the shader.
+    std::uint32_t location = 0;
+    //! @brief Number of components of the attribute.
+    std::uint32_t size = 3;
+    //! @brief Format of the components.
+    VertexAttributeFormatEnum format = VertexAttributeFormatEnum::FLOAT;
+    //! @brief Are the components normalized (for integer formats)?
+    bool normalized = false;
+    //! @brief Offset of the attribute from the start of the vertex in bytes.
+    std::uint32_t offset = 0;
+};
+
 /**
  * @class Mesh parameter
  * @brief This class is there to pass entity id of buffer and a config parameter.
@@ -29,8 +64,20 @@ struct StaticMeshParameter {
     EntityId texture_buffer_id = NullId;
     //! @brief Texture coordinates size (should be 2).
     std::uint32_t texture_buffer_size = 2;
+    //! @brief Interleaved vertex buffer, if present it replaces the point, color, normal and
+    //! texture buffers (all the attributes are in this buffer).
+    EntityId vertex_buffer_id = NullId;
+    //! @brief Size of a vertex in the interleaved buffer in bytes.
+    std::uint32_t vertex_stride = 0;
+    //! @brief Description of the attributes in the interleaved buffer.
+    std::vector<VertexAttribute> vertex_attributes = {};
     //! @brief Index of the points 3 per triangle 2 per line and 1 per point.
     EntityId index_buffer_id = NullId;
+    //! @brief Size of an index in bytes (2 or 4).
+    std::uint32_t index_element_size = sizeof(std::uint32_t);
+    //! @brief Offset (in indices) of every level of detail in the index buffer, the full resolution
+    //! level first (empty if the index buffer has a single level).
+    std::vector<std::uint32_t> level_of_detail_offsets = {};
     //! @brief The kind of draw that the mesh is.
     proto::SceneStaticMesh::RenderPrimitiveEnum render_primitive_enum =
         proto::SceneStaticMesh::TRIANGLE;
@@ -78,12 +125,23 @@ class StaticMeshInterface : public NameInterface {
      * @return Current index buffer id.
      */
     virtual EntityId GetIndexBufferId() const = 0;
+    /**
+     * @brief Get the interleaved vertex buffer id.
+     * @return Current interleaved vertex buffer id (NullId if the attributes are in separate
+     * buffers).
+     */
+    virtual EntityId GetVertexBufferId() const = 0;
     /**
      * @brief This is the size in bytes! so if you need the element size just divide this number by
-     * the sizeof(std::int32_t).
+     * the GetIndexElementSize().
      * @return Size of the index buffer in bytes!
      */
     virtual std::size_t GetIndexSize() const = 0;
+    /**
+     * @brief Get the size of an index in bytes.
+     * @return Size of an index (2 or 4).
+     */
+    virtual std::uint32_t GetIndexElementSize() const = 0;
     /**
      * @brief Update the index size for streams.
      * @param level: The level corresponding to this mesh.
@@ -104,6 +162,41 @@ class StaticMeshInterface : public NameInterface {
      * @return Get the render primitive.
      */
     virtual proto::SceneStaticMesh::RenderPrimitiveEnum GetRenderPrimitive() const = 0;
+    /**
+     * @brief Get the bounding volume of the mesh (in mesh space).
+     * @return The bounding volume (empty if it was never computed, so never culled).
+     */
+    virtual const BoundingVolume& GetBoundingVolume() const = 0;
+    /**
+     * @brief Set the bounding volume of the mesh (computed at import time).
+     * @param bounding_volume: Volume around the points of the mesh (in mesh space).
+     */
+    virtual void SetBoundingVolume(const BoundingVolume& bounding_volume) = 0;
+    /**
+     * @brief Get the number of levels of detail in the index buffer.
+     * @return Number of levels (1 if the mesh has no level of detail).
+     */
+    virtual std::uint32_t GetLevelOfDetailCount() const = 0;
+    /**
+     * @brief Get the part of the index buffer used by a level of detail.
+     * @param level_of_detail: Level (0 is the full resolution).
+     * @return First index and number of indices of the level.
+     */
+    virtual std::pair<std::size_t, std::size_t> GetLevelOfDetailIndexRange(
+        std::uint32_t level_of_detail) const = 0;
+    /**
+     * @brief Set the projected screen size under which each level of detail (after the full
+     * resolution one) is used, the levels without a size are never used. If it is never set
+     * every level halves the size of the previous one (0.5, 0.25, ...).
+     * @param screen_sizes: Decreasing fractions of the screen height (see ComputeScreenSize).
+     */
+    virtual void SetLevelOfDetailScreenSizes(std::vector<float> screen_sizes) = 0;
+    /**
+     * @brief Select the level of detail for a projected screen size.
+     * @param screen_size: Fraction of the screen height covered by the mesh.
+     * @return The coarsest level whose screen size is above the one of the mesh (0 if none).
+     */
+    virtual std::uint32_t SelectLevelOfDetail(float screen_size) const = 0;
 };
 
 }  // End namespace frame.
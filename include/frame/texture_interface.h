@@ -5,6 +5,7 @@
 #include <cinttypes>
 #include <glm/glm.hpp>
 #include <utility>
+#include <vector>
 
 #include "frame/json/parse_pixel.h"
 #include "frame/json/proto.h"
@@ -25,7 +26,6 @@ enum class TextureTypeEnum {
 /**
  * @class TextureParameter
  * @brief This is the parameters needed to create a new texture.
- * @note TODO(anirul): Change cubemap to a enum and add a parameter for mip map.
  */
 struct TextureParameter {
     //! @brief Pixel element size, this should be the same as sizeof(T).
@@ -41,6 +41,17 @@ struct TextureParameter {
     std::array<void*, 6> array_data_ptr = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
     //! @brief Is it a cube map or a normal 2d texture.
     TextureTypeEnum map_type = TextureTypeEnum::TEXTURE_2D;
+    //! @brief Only valid inside a frame, the frame graph can share its memory (2d texture only).
+    bool transient = false;
+    //! @brief Allocate the full mip chain, it is filled from mip_data_ptrs or on the GPU from
+    //! data_ptr (2d texture only).
+    bool mipmap = false;
+    //! @brief Levels 1 and up built on the CPU (same layout as data_ptr), empty to use the GPU.
+    std::vector<const void*> mip_data_ptrs = {};
+    //! @brief Maximum anisotropy (1 is isotropic), clamped to the one supported by the driver.
+    float max_anisotropy = 1.0f;
+    //! @brief Allocate an immutable storage, the texture cannot be resized (2d texture only).
+    bool immutable = false;
 };
 
 /**
@@ -110,6 +121,16 @@ struct TextureInterface : public NameInterface {
      * @return The way the texture is wrap could be any of (REPEAT, CLAMP_TO_EDGE, MIRRORED_REPEAT).
      */
     virtual proto::TextureFilter::Enum GetWrapT() const = 0;
+    /**
+     * @brief Set the maximum anisotropy used when sampling at a grazing angle.
+     * @param max_anisotropy: From 1 (isotropic) to the maximum supported (usually 16).
+     */
+    virtual void SetMaxAnisotropy(float max_anisotropy) = 0;
+    /**
+     * @brief Get the maximum anisotropy.
+     * @return The maximum anisotropy (1 if not supported).
+     */
+    virtual float GetMaxAnisotropy() const = 0;
     /**
      * @brief Clear the texture (this is highly inefficient).
      * @param color: Color to paint the texture to.
@@ -0,0 +1,108 @@
+#include "frame/bounding_volume.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace frame {
+
+namespace {
+
+// Box first then the sphere centered on the box (the farthest point gives the radius).
+template <typename GetPoint>
+BoundingVolume ComputeBoundingVolume(std::size_t point_count, GetPoint get_point) {
+    BoundingVolume bounding_volume = {};
+    for (std::size_t i = 0; i < point_count; ++i) {
+        const glm::vec3 point = get_point(i);
+        bounding_volume.min   = glm::min(bounding_volume.min, point);
+        bounding_volume.max   = glm::max(bounding_volume.max, point);
+    }
+    if (!bounding_volume.IsValid()) return bounding_volume;
+    bounding_volume.center = (bounding_volume.min + bounding_volume.max) * 0.5f;
+    float squared_radius   = 0.0f;
+    for (std::size_t i = 0; i < point_count; ++i) {
+        const glm::vec3 offset = get_point(i) - bounding_volume.center;
+        squared_radius         = std::max(squared_radius, glm::dot(offset, offset));
+    }
+    bounding_volume.radius = std::sqrt(squared_radius);
+    return bounding_volume;
+}
+
+}  // End namespace.
+
+BoundingVolume ComputeBoundingVolume(const std::vector<float>& points) {
+    return ComputeBoundingVolume(points.size() / 3, [&points](std::size_t i) {
+        return glm::vec3(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]);
+    });
+}
+
+BoundingVolume ComputeBoundingVolume(const std::uint8_t* vertices, std::size_t vertex_size,
+                                     std::uint32_t vertex_stride) {
+    if (!vertex_stride) return {};
+    return ComputeBoundingVolume(vertex_size / vertex_stride, [=](std::size_t i) {
+        float position[3];
+        std::memcpy(position, vertices + i * vertex_stride, sizeof(position));
+        return glm::vec3(position[0], position[1], position[2]);
+    });
+}
+
+BoundingVolume TransformBoundingVolume(const BoundingVolume& bounding_volume,
+                                       const glm::mat4& model) {
+    if (!bounding_volume.IsValid()) return {};
+    BoundingVolume result        = {};
+    const glm::vec3 box_center   = (bounding_volume.min + bounding_volume.max) * 0.5f;
+    const glm::vec3 half_size    = (bounding_volume.max - bounding_volume.min) * 0.5f;
+    const glm::vec3 world_center = glm::vec3(model * glm::vec4(box_center, 1.0f));
+    // Extent of the transformed box projected on each axis.
+    glm::vec3 extent(0.0f);
+    float max_scale = 0.0f;
+    for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+            extent[i] += std::abs(model[j][i]) * half_size[j];
+        }
+        max_scale = std::max(max_scale, glm::length(glm::vec3(model[j])));
+    }
+    result.min    = world_center - extent;
+    result.max    = world_center + extent;
+    result.center = glm::vec3(model * glm::vec4(bounding_volume.center, 1.0f));
+    result.radius = bounding_volume.radius * max_scale;
+    return result;
+}
+
+BoundingVolume MergeBoundingVolume(const BoundingVolume& left, const BoundingVolume& right) {
+    if (!left.IsValid()) return right;
+    if (!right.IsValid()) return left;
+    BoundingVolume result  = {};
+    result.min             = glm::min(left.min, right.min);
+    result.max             = glm::max(left.max, right.max);
+    const glm::vec3 offset = right.center - left.center;
+    const float distance   = glm::length(offset);
+    // One of the spheres already contains the other.
+    if (distance + right.radius <= left.radius) {
+        result.center = left.center;
+        result.radius = left.radius;
+    } else if (distance + left.radius <= right.radius) {
+        result.center = right.center;
+        result.radius = right.radius;
+    } else {
+        result.radius = (distance + left.radius + right.radius) * 0.5f;
+        result.center = left.center + offset * ((result.radius - left.radius) / distance);
+    }
+    return result;
+}
+
+float ComputeScreenSize(const BoundingVolume& bounding_volume, const glm::mat4& projection,
+                        const glm::mat4& view) {
+    if (!bounding_volume.IsValid()) return 0.0f;
+    // The projected radius in normalized device coordinates (2 is the screen height).
+    const float scale = projection[1][1] * bounding_volume.radius;
+    // Orthographic projection, the distance doesn't matter.
+    if (projection[3][3] == 1.0f) return scale;
+    const glm::vec3 center = glm::vec3(view * glm::vec4(bounding_volume.center, 1.0f));
+    const float distance   = glm::length(center);
+    // The camera is inside the sphere.
+    if (distance <= bounding_volume.radius) return std::numeric_limits<float>::max();
+    return scale / distance;
+}
+
+}  // End namespace frame.
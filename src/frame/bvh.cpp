@@ -0,0 +1,251 @@
+#include "frame/bvh.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace frame {
+
+namespace {
+
+// Half of the surface of a box (the factor 2 does not change the heuristic).
+float GetHalfArea(glm::vec3 min, glm::vec3 max) {
+    const glm::vec3 extent = max - min;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+// Distance to the entry point of the box along the ray (slab test), infinity if missed.
+float IntersectBox(glm::vec3 origin, glm::vec3 inverse_direction, glm::vec3 min, glm::vec3 max) {
+    float enter = 0.0f;
+    float exit  = std::numeric_limits<float>::infinity();
+    for (int i = 0; i < 3; ++i) {
+        float t0 = (min[i] - origin[i]) * inverse_direction[i];
+        float t1 = (max[i] - origin[i]) * inverse_direction[i];
+        if (t0 > t1) std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        exit  = std::min(exit, t1);
+    }
+    return (enter <= exit) ? enter : std::numeric_limits<float>::infinity();
+}
+
+}  // End namespace.
+
+void Bvh::Build(const std::vector<std::pair<EntityId, BoundingVolume>>& items) {
+    nodes_.clear();
+    leaf_indices_.clear();
+    root_ = invalid_index_;
+    std::vector<BuildItem> build_items;
+    build_items.reserve(items.size());
+    for (const auto& [id, bounding_volume] : items) {
+        if (!bounding_volume.IsValid()) continue;
+        build_items.push_back({ id, bounding_volume.min, bounding_volume.max,
+                                (bounding_volume.min + bounding_volume.max) * 0.5f });
+    }
+    if (build_items.empty()) return;
+    // A binary tree with one item per leaf.
+    nodes_.reserve(build_items.size() * 2 - 1);
+    leaf_indices_.reserve(build_items.size());
+    root_ = BuildNode(build_items, 0, build_items.size(), invalid_index_);
+}
+
+std::uint32_t Bvh::BuildNode(std::vector<BuildItem>& items, std::size_t begin, std::size_t end,
+                             std::uint32_t parent) {
+    const auto index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back({});
+    glm::vec3 min          = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max          = glm::vec3(std::numeric_limits<float>::lowest());
+    glm::vec3 centroid_min = min;
+    glm::vec3 centroid_max = max;
+    for (std::size_t i = begin; i < end; ++i) {
+        min          = glm::min(min, items[i].min);
+        max          = glm::max(max, items[i].max);
+        centroid_min = glm::min(centroid_min, items[i].centroid);
+        centroid_max = glm::max(centroid_max, items[i].centroid);
+    }
+    nodes_[index].min    = min;
+    nodes_[index].max    = max;
+    nodes_[index].parent = parent;
+    if (end - begin == 1) {
+        nodes_[index].id = items[begin].id;
+        leaf_indices_.insert({ items[begin].id, index });
+        return index;
+    }
+    // Split along the largest extent of the centroids.
+    const glm::vec3 extent = centroid_max - centroid_min;
+    int axis               = 0;
+    if (extent.y > extent[axis]) axis = 1;
+    if (extent.z > extent[axis]) axis = 2;
+    std::size_t middle = begin;
+    if (extent[axis] > 0.0f) {
+        const float scale = static_cast<float>(bin_count_) / extent[axis];
+        auto get_bin      = [&](const BuildItem& item) {
+            const auto bin =
+                static_cast<std::size_t>((item.centroid[axis] - centroid_min[axis]) * scale);
+            return std::min(bin, bin_count_ - 1);
+        };
+        struct Bin {
+            glm::vec3 min     = glm::vec3(std::numeric_limits<float>::max());
+            glm::vec3 max     = glm::vec3(std::numeric_limits<float>::lowest());
+            std::size_t count = 0;
+        };
+        std::array<Bin, bin_count_> bins = {};
+        for (std::size_t i = begin; i < end; ++i) {
+            auto& bin = bins[get_bin(items[i])];
+            bin.min   = glm::min(bin.min, items[i].min);
+            bin.max   = glm::max(bin.max, items[i].max);
+            ++bin.count;
+        }
+        // Sweep from the right to get the area and count at the right of each split plane, then
+        // from the left to evaluate the cost of each plane.
+        std::array<float, bin_count_> right_areas        = {};
+        std::array<std::size_t, bin_count_> right_counts = {};
+        Bin right                                        = {};
+        for (std::size_t i = bin_count_ - 1; i > 0; --i) {
+            right.min = glm::min(right.min, bins[i].min);
+            right.max = glm::max(right.max, bins[i].max);
+            right.count += bins[i].count;
+            right_areas[i]  = right.count ? GetHalfArea(right.min, right.max) : 0.0f;
+            right_counts[i] = right.count;
+        }
+        Bin left               = {};
+        float best_cost        = std::numeric_limits<float>::max();
+        std::size_t best_split = 0;
+        for (std::size_t i = 0; i < bin_count_ - 1; ++i) {
+            left.min = glm::min(left.min, bins[i].min);
+            left.max = glm::max(left.max, bins[i].max);
+            left.count += bins[i].count;
+            if (!left.count || !right_counts[i + 1]) continue;
+            const float cost = GetHalfArea(left.min, left.max) * left.count +
+                               right_areas[i + 1] * right_counts[i + 1];
+            if (cost < best_cost) {
+                best_cost  = cost;
+                best_split = i;
+            }
+        }
+        auto it = std::partition(
+            items.begin() + begin, items.begin() + end,
+            [&](const BuildItem& item) { return get_bin(item) <= best_split; });
+        middle  = static_cast<std::size_t>(it - items.begin());
+    }
+    // All the centroids in the same bin, fall back to a median split.
+    if (middle == begin || middle == end) {
+        middle = begin + (end - begin) / 2;
+        std::nth_element(items.begin() + begin, items.begin() + middle, items.begin() + end,
+                         [axis](const BuildItem& left, const BuildItem& right) {
+                             return left.centroid[axis] < right.centroid[axis];
+                         });
+    }
+    // Do not keep a reference to the node as the vector grows during the recursion.
+    const std::uint32_t left_index  = BuildNode(items, begin, middle, index);
+    const std::uint32_t right_index = BuildNode(items, middle, end, index);
+    nodes_[index].left              = left_index;
+    nodes_[index].right             = right_index;
+    return index;
+}
+
+void Bvh::Update(EntityId id, const BoundingVolume& bounding_volume) {
+    auto it = leaf_indices_.find(id);
+    if (it == leaf_indices_.end()) {
+        throw std::runtime_error(fmt::format("No entity #{} in the hierarchy.", id));
+    }
+    if (!bounding_volume.IsValid()) {
+        throw std::runtime_error(fmt::format("Empty volume for entity #{}.", id));
+    }
+    std::uint32_t index = it->second;
+    nodes_[index].min   = bounding_volume.min;
+    nodes_[index].max   = bounding_volume.max;
+    index               = nodes_[index].parent;
+    while (index != invalid_index_) {
+        auto& node          = nodes_[index];
+        const glm::vec3 min = glm::min(nodes_[node.left].min, nodes_[node.right].min);
+        const glm::vec3 max = glm::max(nodes_[node.left].max, nodes_[node.right].max);
+        // The rest of the path is already correct.
+        if (min == node.min && max == node.max) break;
+        node.min = min;
+        node.max = max;
+        index    = node.parent;
+    }
+}
+
+template <typename Test>
+std::vector<EntityId> Bvh::Collect(Test test) const {
+    std::vector<EntityId> ids;
+    if (root_ == invalid_index_) return ids;
+    std::vector<std::uint32_t> stack = { root_ };
+    while (!stack.empty()) {
+        const Node& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (!test(node.min, node.max)) continue;
+        if (node.left == invalid_index_) {
+            ids.push_back(node.id);
+            continue;
+        }
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+    }
+    return ids;
+}
+
+std::vector<EntityId> Bvh::QueryFrustum(const Frustum& frustum) const {
+    return Collect([&frustum](glm::vec3 min, glm::vec3 max) {
+        return frustum.IsBoxVisible(min, max);
+    });
+}
+
+std::vector<EntityId> Bvh::QueryBox(glm::vec3 min, glm::vec3 max) const {
+    return Collect([min, max](glm::vec3 node_min, glm::vec3 node_max) {
+        return node_min.x <= max.x && node_min.y <= max.y && node_min.z <= max.z &&
+               node_max.x >= min.x && node_max.y >= min.y && node_max.z >= min.z;
+    });
+}
+
+Bvh::Hit Bvh::Raycast(glm::vec3 origin, glm::vec3 direction) const {
+    Hit hit = {};
+    if (root_ == invalid_index_) return hit;
+    // Infinity for the axis the ray is parallel to.
+    const glm::vec3 inverse_direction(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    auto intersect = [&](std::uint32_t index) {
+        return IntersectBox(origin, inverse_direction, nodes_[index].min, nodes_[index].max);
+    };
+    float best_distance                                = std::numeric_limits<float>::infinity();
+    std::vector<std::pair<std::uint32_t, float>> stack = { { root_, intersect(root_) } };
+    while (!stack.empty()) {
+        const auto [index, distance] = stack.back();
+        stack.pop_back();
+        // A closer box was found since this one was pushed.
+        if (distance >= best_distance) continue;
+        const Node& node = nodes_[index];
+        if (node.left == invalid_index_) {
+            best_distance = distance;
+            hit           = { node.id, distance };
+            continue;
+        }
+        // Push the farthest child first so the closest is visited first.
+        std::pair<std::uint32_t, float> closest  = { node.left, intersect(node.left) };
+        std::pair<std::uint32_t, float> farthest = { node.right, intersect(node.right) };
+        if (farthest.second < closest.second) std::swap(closest, farthest);
+        if (farthest.second < best_distance) stack.push_back(farthest);
+        if (closest.second < best_distance) stack.push_back(closest);
+    }
+    return hit;
+}
+
+std::size_t Bvh::GetDepth() const {
+    if (root_ == invalid_index_) return 0;
+    std::size_t depth                                        = 0;
+    std::vector<std::pair<std::uint32_t, std::size_t>> stack = { { root_, 1 } };
+    while (!stack.empty()) {
+        const auto [index, level] = stack.back();
+        stack.pop_back();
+        depth = std::max(depth, level);
+        if (nodes_[index].left == invalid_index_) continue;
+        stack.push_back({ nodes_[index].left, level + 1 });
+        stack.push_back({ nodes_[index].right, level + 1 });
+    }
+    return depth;
+}
+
+}  // End namespace frame.
@@ -63,6 +63,15 @@ glm::mat4 Camera::ComputeProjection(float fov_rad, float aspect_ratio) const {
     return glm::perspective(fov_rad, aspect_ratio, near_clip_, far_clip_);
 }
 
+glm::vec3 Camera::ComputeRayDirection(glm::vec2 screen_position, glm::vec2 screen_size) const {
+    // Normalized device coordinates (y is going up).
+    const float x          = 2.0f * screen_position.x / screen_size.x - 1.0f;
+    const float y          = 1.0f - 2.0f * screen_position.y / screen_size.y;
+    const float tan_half_y = std::tan(fov_rad_ * 0.5f);
+    return glm::normalize(front_ + right_ * (x * tan_half_y * aspect_ratio_) +
+                          up_ * (y * tan_half_y));
+}
+
 void Camera::SetPosition(glm::vec3 vec) { position_ = vec; }
 
 bool Camera::SetFront(glm::vec3 vec) {
@@ -0,0 +1,321 @@
+#include "frame/file/block_compression.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "frame/file/mipmap.h"
+
+namespace frame::file {
+
+namespace {
+
+using Block = std::array<std::array<std::uint8_t, 4>, 16>;
+
+// Fetch the 4x4 texels of a block, the texels outside the image are clamped to the edge.
+Block FetchBlock(const std::uint8_t* rgba, glm::uvec2 size, std::uint32_t block_x,
+                 std::uint32_t block_y) {
+    Block block = {};
+    for (std::uint32_t y = 0; y < 4; ++y) {
+        for (std::uint32_t x = 0; x < 4; ++x) {
+            const std::uint32_t image_x = std::min(block_x * 4 + x, size.x - 1);
+            const std::uint32_t image_y = std::min(block_y * 4 + y, size.y - 1);
+            const std::uint8_t* texel   = rgba + (image_y * size.x + image_x) * 4;
+            std::copy(texel, texel + 4, block[y * 4 + x].begin());
+        }
+    }
+    return block;
+}
+
+void StoreBlock(const Block& block, std::uint8_t* rgba, glm::uvec2 size, std::uint32_t block_x,
+                std::uint32_t block_y) {
+    for (std::uint32_t y = 0; y < 4 && block_y * 4 + y < size.y; ++y) {
+        for (std::uint32_t x = 0; x < 4 && block_x * 4 + x < size.x; ++x) {
+            const std::uint32_t image_x = block_x * 4 + x;
+            const std::uint32_t image_y = block_y * 4 + y;
+            std::copy(block[y * 4 + x].begin(), block[y * 4 + x].end(),
+                      rgba + (image_y * size.x + image_x) * 4);
+        }
+    }
+}
+
+std::uint16_t Quantize(float value, float max_value) {
+    const float normalized = glm::clamp(value, 0.f, 255.f) / 255.f;
+    return static_cast<std::uint16_t>(std::lround(normalized * max_value));
+}
+
+std::uint16_t PackRGB565(const glm::vec3& color) {
+    return static_cast<std::uint16_t>(Quantize(color.x, 31.f) << 11 |
+                                      Quantize(color.y, 63.f) << 5 | Quantize(color.z, 31.f));
+}
+
+glm::ivec3 UnpackRGB565(std::uint16_t color) {
+    const int r = (color >> 11) & 0x1f;
+    const int g = (color >> 5) & 0x3f;
+    const int b = color & 0x1f;
+    return glm::ivec3(r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2);
+}
+
+std::array<glm::ivec3, 4> MakeBC1Palette(std::uint16_t c0, std::uint16_t c1, bool four_colors) {
+    std::array<glm::ivec3, 4> palette = { UnpackRGB565(c0), UnpackRGB565(c1) };
+    if (four_colors) {
+        palette[2] = (palette[0] * 2 + palette[1]) / 3;
+        palette[3] = (palette[0] + palette[1] * 2) / 3;
+    } else {
+        palette[2] = (palette[0] + palette[1]) / 2;
+        palette[3] = glm::ivec3(0);
+    }
+    return palette;
+}
+
+std::array<int, 8> MakeBC4Palette(int a0, int a1) {
+    std::array<int, 8> palette = { a0, a1 };
+    if (a0 > a1) {
+        for (int i = 2; i < 8; ++i) {
+            palette[i] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+        }
+    } else {
+        for (int i = 2; i < 6; ++i) {
+            palette[i] = ((6 - i) * a0 + (i - 1) * a1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    return palette;
+}
+
+// Range fit: the endpoints are the extremes of the texels along the principal axis.
+void EncodeBC1Block(const Block& block, std::uint8_t* out) {
+    glm::vec3 mean(0.f);
+    for (const auto& texel : block) {
+        mean += glm::vec3(texel[0], texel[1], texel[2]);
+    }
+    mean /= 16.f;
+    glm::mat3 covariance(0.f);
+    for (const auto& texel : block) {
+        const glm::vec3 delta = glm::vec3(texel[0], texel[1], texel[2]) - mean;
+        covariance += glm::outerProduct(delta, delta);
+    }
+    // Power iterations to get the principal axis.
+    glm::vec3 axis(1.f);
+    for (int i = 0; i < 8; ++i) {
+        const glm::vec3 next  = covariance * axis;
+        const float magnitude = glm::length(next);
+        if (magnitude < std::numeric_limits<float>::epsilon()) break;
+        axis = next / magnitude;
+    }
+    glm::vec3 min_color = mean;
+    glm::vec3 max_color = mean;
+    float min_distance  = std::numeric_limits<float>::max();
+    float max_distance  = std::numeric_limits<float>::lowest();
+    for (const auto& texel : block) {
+        const glm::vec3 color = glm::vec3(texel[0], texel[1], texel[2]);
+        const float distance  = glm::dot(color - mean, axis);
+        if (distance < min_distance) {
+            min_distance = distance;
+            min_color    = color;
+        }
+        if (distance > max_distance) {
+            max_distance = distance;
+            max_color    = color;
+        }
+    }
+    std::uint16_t c0 = PackRGB565(max_color);
+    std::uint16_t c1 = PackRGB565(min_color);
+    if (c0 < c1) std::swap(c0, c1);
+    std::uint32_t indices = 0;
+    // With c0 == c1 every texel use the first color (index 0).
+    if (c0 != c1) {
+        const auto palette = MakeBC1Palette(c0, c1, true);
+        for (int i = 0; i < 16; ++i) {
+            const glm::ivec3 color(block[i][0], block[i][1], block[i][2]);
+            int best_index    = 0;
+            int best_distance = std::numeric_limits<int>::max();
+            for (int j = 0; j < 4; ++j) {
+                const glm::ivec3 delta = color - palette[j];
+                const int distance     = delta.x * delta.x + delta.y * delta.y + delta.z * delta.z;
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_index    = j;
+                }
+            }
+            indices |= static_cast<std::uint32_t>(best_index) << (2 * i);
+        }
+    }
+    out[0] = static_cast<std::uint8_t>(c0);
+    out[1] = static_cast<std::uint8_t>(c0 >> 8);
+    out[2] = static_cast<std::uint8_t>(c1);
+    out[3] = static_cast<std::uint8_t>(c1 >> 8);
+    for (int i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<std::uint8_t>(indices >> (8 * i));
+    }
+}
+
+void EncodeBC4Block(const Block& block, int channel, std::uint8_t* out) {
+    int a0 = 0;
+    int a1 = 255;
+    for (const auto& texel : block) {
+        a0 = std::max<int>(a0, texel[channel]);
+        a1 = std::min<int>(a1, texel[channel]);
+    }
+    std::uint64_t indices = 0;
+    // With a0 == a1 every texel use the first value (index 0).
+    if (a0 != a1) {
+        const auto palette = MakeBC4Palette(a0, a1);
+        for (int i = 0; i < 16; ++i) {
+            int best_index    = 0;
+            int best_distance = std::numeric_limits<int>::max();
+            for (int j = 0; j < 8; ++j) {
+                const int distance = std::abs(block[i][channel] - palette[j]);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_index    = j;
+                }
+            }
+            indices |= static_cast<std::uint64_t>(best_index) << (3 * i);
+        }
+    }
+    out[0] = static_cast<std::uint8_t>(a0);
+    out[1] = static_cast<std::uint8_t>(a1);
+    for (int i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<std::uint8_t>(indices >> (8 * i));
+    }
+}
+
+void DecodeBC1Block(const std::uint8_t* in, bool force_four_colors, Block& block) {
+    const auto c0      = static_cast<std::uint16_t>(in[0] | in[1] << 8);
+    const auto c1      = static_cast<std::uint16_t>(in[2] | in[3] << 8);
+    const bool four    = force_four_colors || c0 > c1;
+    const auto palette = MakeBC1Palette(c0, c1, four);
+    for (int i = 0; i < 16; ++i) {
+        const int index   = (in[4 + i / 4] >> (2 * (i % 4))) & 0x3;
+        const auto& color = palette[index];
+        block[i]          = { static_cast<std::uint8_t>(color.x),
+                              static_cast<std::uint8_t>(color.y),
+                              static_cast<std::uint8_t>(color.z),
+                              static_cast<std::uint8_t>(!four && index == 3 ? 0 : 255) };
+    }
+}
+
+void DecodeBC4Block(const std::uint8_t* in, int channel, Block& block) {
+    const auto palette    = MakeBC4Palette(in[0], in[1]);
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i) {
+        indices |= static_cast<std::uint64_t>(in[2 + i]) << (8 * i);
+    }
+    for (int i = 0; i < 16; ++i) {
+        block[i][channel] = static_cast<std::uint8_t>(palette[(indices >> (3 * i)) & 0x7]);
+    }
+}
+
+void CheckEncodable(CompressedFormatEnum format) {
+    switch (format) {
+        case CompressedFormatEnum::BC1:
+        case CompressedFormatEnum::BC3:
+        case CompressedFormatEnum::BC4:
+        case CompressedFormatEnum::BC5:
+            return;
+        default:
+            throw std::runtime_error(fmt::format("Unsupported block compression format [{}].",
+                                                 static_cast<int>(format)));
+    }
+}
+
+}  // End namespace.
+
+std::vector<std::uint8_t> CompressImage(const std::uint8_t* rgba, glm::uvec2 size,
+                                        CompressedFormatEnum format) {
+    CheckEncodable(format);
+    const std::size_t block_size = GetCompressedBlockSize(format);
+    const std::uint32_t block_x  = (size.x + 3) / 4;
+    const std::uint32_t block_y  = (size.y + 3) / 4;
+    std::vector<std::uint8_t> blocks(GetCompressedImageSize(format, size));
+    for (std::uint32_t y = 0; y < block_y; ++y) {
+        for (std::uint32_t x = 0; x < block_x; ++x) {
+            const Block block = FetchBlock(rgba, size, x, y);
+            std::uint8_t* out = blocks.data() + (y * block_x + x) * block_size;
+            switch (format) {
+                case CompressedFormatEnum::BC1:
+                    EncodeBC1Block(block, out);
+                    break;
+                case CompressedFormatEnum::BC3:
+                    EncodeBC4Block(block, 3, out);
+                    EncodeBC1Block(block, out + 8);
+                    break;
+                case CompressedFormatEnum::BC4:
+                    EncodeBC4Block(block, 0, out);
+                    break;
+                case CompressedFormatEnum::BC5:
+                    EncodeBC4Block(block, 0, out);
+                    EncodeBC4Block(block, 1, out + 8);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return blocks;
+}
+
+std::vector<std::uint8_t> DecompressImage(const std::uint8_t* blocks, glm::uvec2 size,
+                                          CompressedFormatEnum format) {
+    CheckEncodable(format);
+    const std::size_t block_size = GetCompressedBlockSize(format);
+    const std::uint32_t block_x  = (size.x + 3) / 4;
+    const std::uint32_t block_y  = (size.y + 3) / 4;
+    std::vector<std::uint8_t> rgba(static_cast<std::size_t>(size.x) * size.y * 4);
+    for (std::uint32_t y = 0; y < block_y; ++y) {
+        for (std::uint32_t x = 0; x < block_x; ++x) {
+            const std::uint8_t* in = blocks + (y * block_x + x) * block_size;
+            Block block            = {};
+            for (auto& texel : block) {
+                texel = { 0, 0, 0, 255 };
+            }
+            switch (format) {
+                case CompressedFormatEnum::BC1:
+                    DecodeBC1Block(in, false, block);
+                    break;
+                case CompressedFormatEnum::BC3:
+                    DecodeBC1Block(in + 8, true, block);
+                    DecodeBC4Block(in, 3, block);
+                    break;
+                case CompressedFormatEnum::BC4:
+                    DecodeBC4Block(in, 0, block);
+                    break;
+                case CompressedFormatEnum::BC5:
+                    DecodeBC4Block(in, 0, block);
+                    DecodeBC4Block(in + 8, 1, block);
+                    break;
+                default:
+                    break;
+            }
+            StoreBlock(block, rgba.data(), size, x, y);
+        }
+    }
+    return rgba;
+}
+
+std::vector<std::uint8_t> DownsampleImage(const std::uint8_t* rgba, glm::uvec2 size) {
+    return DownsampleLevel(rgba, size, 4, proto::MipmapFilter::BOX);
+}
+
+CompressedImage CompressImageWithMipmaps(const std::uint8_t* rgba, glm::uvec2 size,
+                                         CompressedFormatEnum format) {
+    std::vector<std::vector<std::uint8_t>> levels;
+    std::vector<std::uint8_t> current(rgba, rgba + static_cast<std::size_t>(size.x) * size.y * 4);
+    glm::uvec2 current_size = size;
+    while (true) {
+        levels.push_back(CompressImage(current.data(), current_size, format));
+        if (current_size.x == 1 && current_size.y == 1) break;
+        current      = DownsampleImage(current.data(), current_size);
+        current_size =
+            glm::uvec2(std::max(current_size.x / 2, 1u), std::max(current_size.y / 2, 1u));
+    }
+    return CompressedImage(format, size, std::move(levels));
+}
+
+}  // End namespace frame::file.
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/file/compressed_image.h"
+
+namespace frame::file {
+
+/**
+ * @brief Compress an RGBA (8 bit per channel) image into 4x4 blocks, BC1 keeps RGB, BC3 keeps
+ * RGBA, BC4 keeps R and BC5 keeps RG (throw std::runtime_error for the other formats).
+ * @param rgba: Pixels of the image (size.x * size.y * 4 bytes, row major).
+ * @param size: Size of the image.
+ * @param format: Compressed format (BC1, BC3, BC4 or BC5).
+ * @return The compressed blocks (row major).
+ */
+std::vector<std::uint8_t> CompressImage(const std::uint8_t* rgba, glm::uvec2 size,
+                                        CompressedFormatEnum format);
+/**
+ * @brief Decompress BC1 to BC5 blocks into an RGBA (8 bit per channel) image, the missing channels
+ * are set like the GPU would (0 for G and B, 255 for A).
+ * @param blocks: Compressed blocks.
+ * @param size: Size of the image.
+ * @param format: Compressed format (BC1, BC3, BC4 or BC5).
+ * @return The pixels of the image (size.x * size.y * 4 bytes, row major).
+ */
+std::vector<std::uint8_t> DecompressImage(const std::uint8_t* blocks, glm::uvec2 size,
+                                          CompressedFormatEnum format);
+/**
+ * @brief Halve an RGBA (8 bit per channel) image with a box filter.
+ * @param rgba: Pixels of the image (size.x * size.y * 4 bytes, row major).
+ * @param size: Size of the image.
+ * @return The pixels of the next mip level (max(size / 2, 1)).
+ */
+std::vector<std::uint8_t> DownsampleImage(const std::uint8_t* rgba, glm::uvec2 size);
+/**
+ * @brief Compress an RGBA (8 bit per channel) image and its full mip chain.
+ * @param rgba: Pixels of the image (size.x * size.y * 4 bytes, row major).
+ * @param size: Size of the image.
+ * @param format: Compressed format (BC1, BC3, BC4 or BC5).
+ * @return The compressed image down to the 1x1 level.
+ */
+CompressedImage CompressImageWithMipmaps(const std::uint8_t* rgba, glm::uvec2 size,
+                                         CompressedFormatEnum format);
+
+}  // End namespace frame::file.
@@ -0,0 +1,101 @@
+#include "frame/file/cache_file.h"
+
+#include <fmt/core.h>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+
+namespace frame::file {
+
+namespace {
+
+// Directories set with SetCacheDirectory.
+std::mutex cache_directory_mutex;
+std::map<std::string, std::filesystem::path> cache_directories;
+
+}  // End namespace.
+
+std::uint64_t HashStrings(const std::vector<std::string_view>& values,
+                          std::uint64_t hash /* = hash_offset_basis*/) {
+    constexpr std::uint8_t separator = 0xff;
+    for (const auto value : values) {
+        hash = HashBytes(value.data(), value.size(), hash);
+        hash = HashBytes(&separator, sizeof(separator), hash);
+    }
+    return hash;
+}
+
+std::uint64_t HashFile(const std::filesystem::path& file_name, std::uint64_t seed /* = 0*/) {
+    std::ifstream ifs(file_name, std::ios::binary);
+    if (!ifs) {
+        throw std::runtime_error(fmt::format("Could not open file [{}].", file_name.string()));
+    }
+    std::uint64_t hash = hash_offset_basis ^ seed;
+    std::array<char, 64 * 1024> chunk;
+    while (ifs) {
+        ifs.read(chunk.data(), chunk.size());
+        hash = HashBytes(chunk.data(), static_cast<std::size_t>(ifs.gcount()), hash);
+    }
+    return hash;
+}
+
+std::filesystem::path GetCacheDirectory(const std::string& cache_name) {
+    std::lock_guard<std::mutex> lock(cache_directory_mutex);
+    const auto it = cache_directories.find(cache_name);
+    if (it != cache_directories.end()) return it->second;
+    std::error_code error_code;
+    const auto temporary_directory = std::filesystem::temp_directory_path(error_code);
+    if (error_code) return {};
+    return temporary_directory / fmt::format("frame_{}_cache", cache_name);
+}
+
+void SetCacheDirectory(const std::string& cache_name,
+                       const std::filesystem::path& cache_directory) {
+    std::lock_guard<std::mutex> lock(cache_directory_mutex);
+    cache_directories[cache_name] = cache_directory;
+}
+
+std::filesystem::path GetCachePath(const std::filesystem::path& cache_directory,
+                                   const std::string& name, std::uint64_t hash,
+                                   const std::string& extension) {
+    return cache_directory / fmt::format("{}.{:016x}{}", name, hash, extension);
+}
+
+bool OpenCacheFile(const std::filesystem::path& file_name, const CacheFileHeader& header,
+                   std::ifstream& ifs) {
+    ifs.open(file_name, std::ios::binary);
+    if (!ifs) return false;
+    CacheFileHeader file_header = {};
+    ifs.read(reinterpret_cast<char*>(&file_header), sizeof(file_header));
+    return ifs && file_header.magic == header.magic && file_header.version == header.version &&
+           file_header.hash == header.hash;
+}
+
+void WriteCacheFile(const std::filesystem::path& file_name, const CacheFileHeader& header,
+                    const std::vector<CacheBlob>& blobs) {
+    std::error_code error_code;
+    std::filesystem::create_directories(file_name.parent_path(), error_code);
+    auto temporary_file = file_name;
+    temporary_file += ".tmp";
+    {
+        std::ofstream ofs(temporary_file, std::ios::binary | std::ios::trunc);
+        if (!ofs) {
+            throw std::runtime_error(
+                fmt::format("Could not write file [{}].", temporary_file.string()));
+        }
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& blob : blobs) {
+            ofs.write(static_cast<const char*>(blob.data),
+                      static_cast<std::streamsize>(blob.size));
+        }
+        if (!ofs) {
+            throw std::runtime_error(
+                fmt::format("Could not write file [{}].", temporary_file.string()));
+        }
+    }
+    std::filesystem::rename(temporary_file, file_name);
+}
+
+}  // End namespace frame::file.
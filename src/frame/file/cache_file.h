@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace frame::file {
+
+//! @brief Initial value of the FNV-1a 64 bit hash.
+constexpr std::uint64_t hash_offset_basis = 14695981039346656037ull;
+
+/**
+ * @brief Continue a FNV-1a 64 bit hash with some bytes.
+ * @param data: Bytes to be hashed.
+ * @param size: Number of bytes.
+ * @param hash: Hash of what came before.
+ * @return Hash including the bytes.
+ */
+inline std::uint64_t HashBytes(const void* data, std::size_t size,
+                               std::uint64_t hash = hash_offset_basis) {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i) hash = (hash ^ bytes[i]) * 1099511628211ull;
+    return hash;
+}
+/**
+ * @brief Hash a list of strings (FNV-1a 64 bit), moving text from a string to the next change
+ * the hash.
+ * @param values: Strings to be hashed.
+ * @param hash: Hash of what came before (a file hash for example).
+ * @return Hash of the strings.
+ */
+std::uint64_t HashStrings(const std::vector<std::string_view>& values,
+                          std::uint64_t hash = hash_offset_basis);
+/**
+ * @brief Hash the content of a file (FNV-1a 64 bit).
+ * @param file_name: File to be hashed.
+ * @param seed: Seed of the hash (to mix in the import options).
+ * @return Hash of the file content.
+ */
+std::uint64_t HashFile(const std::filesystem::path& file_name, std::uint64_t seed = 0);
+
+/**
+ * @brief Get the directory of a cache.
+ * @param cache_name: Name of the cache (program, texture, ...).
+ * @return Directory of the cache, by default frame_<cache_name>_cache in the temporary directory
+ * (empty if the cache is disabled).
+ */
+std::filesystem::path GetCacheDirectory(const std::string& cache_name);
+/**
+ * @brief Set the directory of a cache.
+ * @param cache_name: Name of the cache (program, texture, ...).
+ * @param cache_directory: Directory of the cache, empty to disable the cache.
+ */
+void SetCacheDirectory(const std::string& cache_name,
+                       const std::filesystem::path& cache_directory);
+/**
+ * @brief Get the path of a file in a cache.
+ * @param cache_directory: Directory of the cache.
+ * @param name: Name of what is cached.
+ * @param hash: Hash of the sources of what is cached.
+ * @param extension: Extension of the file (with the dot).
+ * @return Path of the cached file.
+ */
+std::filesystem::path GetCachePath(const std::filesystem::path& cache_directory,
+                                   const std::string& name, std::uint64_t hash,
+                                   const std::string& extension);
+
+/**
+ * @class CacheFileHeader
+ * @brief Start of every cache file, a file is only used if all of them match.
+ */
+struct CacheFileHeader {
+    //! @brief Type of the file.
+    std::array<char, 4> magic = {};
+    //! @brief Version of the layout of the file.
+    std::uint32_t version = 0;
+    //! @brief Hash of the sources of the content.
+    std::uint64_t hash = 0;
+};
+static_assert(sizeof(CacheFileHeader) == 16, "CacheFileHeader is written as is.");
+
+/**
+ * @class CacheBlob
+ * @brief Bytes written in a cache file after the header.
+ */
+struct CacheBlob {
+    //! @brief First byte.
+    const void* data = nullptr;
+    //! @brief Number of bytes.
+    std::size_t size = 0;
+};
+
+/**
+ * @brief Open a cache file and check its header.
+ * @param file_name: Cached file.
+ * @param header: Expected header.
+ * @param ifs[out]: Stream positioned after the header.
+ * @return False if the file is missing or its header doesn't match.
+ */
+bool OpenCacheFile(const std::filesystem::path& file_name, const CacheFileHeader& header,
+                   std::ifstream& ifs);
+/**
+ * @brief Write a cache file, it is written to a temporary file first and renamed so a reader
+ * never see a partial file (throw std::runtime_error if it fails).
+ * @param file_name: Cached file (its directory is created).
+ * @param header: Header of the file.
+ * @param blobs: Content written after the header.
+ */
+void WriteCacheFile(const std::filesystem::path& file_name, const CacheFileHeader& header,
+                    const std::vector<CacheBlob>& blobs);
+
+}  // End namespace frame::file.
@@ -0,0 +1,426 @@
+#include "frame/file/compressed_image.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "frame/file/mipmap.h"
+#include "frame/logger.h"
+
+namespace frame::file {
+
+namespace {
+
+// DDS layout: "DDS " | DDS_HEADER (124 bytes) | optional DDS_HEADER_DXT10 (20 bytes) | levels.
+constexpr std::array<char, 4> dds_magic          = { 'D', 'D', 'S', ' ' };
+constexpr std::uint32_t dds_header_size          = 124;
+constexpr std::uint32_t dds_pixel_format_size    = 32;
+constexpr std::uint32_t dds_flags                = 0x1 | 0x2 | 0x4 | 0x1000 | 0x80000;
+constexpr std::uint32_t dds_flag_mipmap_count    = 0x20000;
+constexpr std::uint32_t dds_pixel_flag_four_cc   = 0x4;
+constexpr std::uint32_t dds_caps_texture         = 0x1000;
+constexpr std::uint32_t dds_caps_mipmap          = 0x8 | 0x400000;
+constexpr std::uint32_t dds_caps2_cubemap        = 0x200;
+constexpr std::uint32_t dxgi_dimension_texture2d = 3;
+
+// KTX 1.1 layout: identifier | 13 * uint32 | key value data | (image size | level | padding) *.
+constexpr std::array<std::uint8_t, 12> ktx_identifier = {
+    0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'
+};
+constexpr std::uint32_t ktx_endianness = 0x04030201;
+
+constexpr std::uint32_t MakeFourCC(char a, char b, char c, char d) {
+    return static_cast<std::uint32_t>(static_cast<std::uint8_t>(a)) |
+           static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) << 8 |
+           static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 16 |
+           static_cast<std::uint32_t>(static_cast<std::uint8_t>(d)) << 24;
+}
+
+std::uint32_t ReadUint32(const std::vector<std::uint8_t>& content, std::size_t offset) {
+    if (offset + sizeof(std::uint32_t) > content.size()) {
+        throw std::runtime_error("Truncated compressed image.");
+    }
+    std::uint32_t value = 0;
+    std::memcpy(&value, content.data() + offset, sizeof(value));
+    return value;
+}
+
+void WriteUint32(std::vector<std::uint8_t>& content, std::size_t offset, std::uint32_t value) {
+    std::memcpy(content.data() + offset, &value, sizeof(value));
+}
+
+CompressedFormatEnum DdsFourCCToFormat(std::uint32_t four_cc) {
+    switch (four_cc) {
+        case MakeFourCC('D', 'X', 'T', '1'):
+            return CompressedFormatEnum::BC1;
+        case MakeFourCC('D', 'X', 'T', '5'):
+            return CompressedFormatEnum::BC3;
+        case MakeFourCC('A', 'T', 'I', '1'):
+        case MakeFourCC('B', 'C', '4', 'U'):
+            return CompressedFormatEnum::BC4;
+        case MakeFourCC('A', 'T', 'I', '2'):
+        case MakeFourCC('B', 'C', '5', 'U'):
+            return CompressedFormatEnum::BC5;
+        default:
+            throw std::runtime_error(fmt::format("Unsupported DDS FourCC [{:#010x}].", four_cc));
+    }
+}
+
+CompressedFormatEnum DxgiToFormat(std::uint32_t dxgi_format) {
+    // The sRGB variants are loaded as linear, as for the other images.
+    switch (dxgi_format) {
+        case 71:  // DXGI_FORMAT_BC1_UNORM
+        case 72:  // DXGI_FORMAT_BC1_UNORM_SRGB
+            return CompressedFormatEnum::BC1;
+        case 77:  // DXGI_FORMAT_BC3_UNORM
+        case 78:  // DXGI_FORMAT_BC3_UNORM_SRGB
+            return CompressedFormatEnum::BC3;
+        case 80:  // DXGI_FORMAT_BC4_UNORM
+            return CompressedFormatEnum::BC4;
+        case 83:  // DXGI_FORMAT_BC5_UNORM
+            return CompressedFormatEnum::BC5;
+        case 98:  // DXGI_FORMAT_BC7_UNORM
+        case 99:  // DXGI_FORMAT_BC7_UNORM_SRGB
+            return CompressedFormatEnum::BC7;
+        default:
+            throw std::runtime_error(fmt::format("Unsupported DXGI format [{}].", dxgi_format));
+    }
+}
+
+CompressedFormatEnum GLInternalFormatToFormat(std::uint32_t internal_format) {
+    switch (internal_format) {
+        case 0x83F0:  // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case 0x83F1:  // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+        case 0x8C4C:  // GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+            return CompressedFormatEnum::BC1;
+        case 0x83F3:  // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+        case 0x8C4F:  // GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+            return CompressedFormatEnum::BC3;
+        case 0x8DBB:  // GL_COMPRESSED_RED_RGTC1
+            return CompressedFormatEnum::BC4;
+        case 0x8DBD:  // GL_COMPRESSED_RG_RGTC2
+            return CompressedFormatEnum::BC5;
+        case 0x8E8C:  // GL_COMPRESSED_RGBA_BPTC_UNORM
+        case 0x8E8D:  // GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+            return CompressedFormatEnum::BC7;
+        case 0x9274:  // GL_COMPRESSED_RGB8_ETC2
+        case 0x9275:  // GL_COMPRESSED_SRGB8_ETC2
+            return CompressedFormatEnum::ETC2_RGB;
+        case 0x9278:  // GL_COMPRESSED_RGBA8_ETC2_EAC
+        case 0x9279:  // GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+            return CompressedFormatEnum::ETC2_RGBA;
+        default:
+            throw std::runtime_error(
+                fmt::format("Unsupported KTX internal format [{:#06x}].", internal_format));
+    }
+}
+
+// Reverse the first row_count rows (2 bits per texel, one byte per row) of a BC1 color block.
+void FlipBC1Block(std::uint8_t* block, std::uint32_t row_count) {
+    std::reverse(block + 4, block + 4 + row_count);
+}
+
+// Reverse the first row_count rows (3 bits per texel, 12 bits per row) of a BC4 block.
+void FlipBC4Block(std::uint8_t* block, std::uint32_t row_count) {
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i) {
+        indices |= static_cast<std::uint64_t>(block[2 + i]) << (8 * i);
+    }
+    std::array<std::uint64_t, 4> rows = {};
+    for (std::uint32_t row = 0; row < 4; ++row) {
+        rows[row] = (indices >> (12 * row)) & 0xfff;
+    }
+    std::reverse(rows.begin(), rows.begin() + row_count);
+    indices = 0;
+    for (std::uint32_t row = 0; row < 4; ++row) {
+        indices |= rows[row] << (12 * row);
+    }
+    for (int i = 0; i < 6; ++i) {
+        block[2 + i] = static_cast<std::uint8_t>(indices >> (8 * i));
+    }
+}
+
+}  // End namespace.
+
+std::size_t GetCompressedBlockSize(CompressedFormatEnum format) {
+    switch (format) {
+        case CompressedFormatEnum::BC1:
+        case CompressedFormatEnum::BC4:
+        case CompressedFormatEnum::ETC2_RGB:
+            return 8;
+        case CompressedFormatEnum::BC3:
+        case CompressedFormatEnum::BC5:
+        case CompressedFormatEnum::BC7:
+        case CompressedFormatEnum::ETC2_RGBA:
+            return 16;
+    }
+    throw std::runtime_error(
+        fmt::format("Unknown compressed format [{}].", static_cast<int>(format)));
+}
+
+std::size_t GetCompressedImageSize(CompressedFormatEnum format, glm::uvec2 size) {
+    const std::size_t block_x = (std::max(size.x, 1u) + 3) / 4;
+    const std::size_t block_y = (std::max(size.y, 1u) + 3) / 4;
+    return block_x * block_y * GetCompressedBlockSize(format);
+}
+
+proto::PixelStructure GetCompressedPixelStructure(CompressedFormatEnum format) {
+    switch (format) {
+        case CompressedFormatEnum::BC4:
+            return proto::PixelStructure_GREY();
+        case CompressedFormatEnum::BC5:
+            return proto::PixelStructure_GREY_ALPHA();
+        case CompressedFormatEnum::BC1:
+        case CompressedFormatEnum::ETC2_RGB:
+            return proto::PixelStructure_RGB();
+        default:
+            return proto::PixelStructure_RGB_ALPHA();
+    }
+}
+
+bool IsCompressedImageFile(const std::filesystem::path& file) {
+    std::string extension = file.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".dds" || extension == ".ktx";
+}
+
+CompressedImage::CompressedImage(CompressedFormatEnum format, glm::uvec2 size,
+                                 std::vector<std::vector<std::uint8_t>> levels)
+    : format_(format), size_(size), levels_(std::move(levels)) {
+    for (int i = 0; i < GetMipCount(); ++i) {
+        if (levels_[i].size() != GetCompressedImageSize(format_, GetLevelSize(i))) {
+            throw std::runtime_error(fmt::format("Invalid size for compressed level [{}].", i));
+        }
+    }
+}
+
+CompressedImage::CompressedImage(const std::filesystem::path& file, bool vertical_flip) {
+    const auto& logger = frame::Logger::GetInstance();
+    logger->info("Openning compressed image: [{}].", file.string());
+    std::ifstream ifs(file, std::ios::binary);
+    if (!ifs) {
+        throw std::runtime_error(fmt::format("Could not open file [{}].", file.string()));
+    }
+    const std::vector<std::uint8_t> content{ std::istreambuf_iterator<char>(ifs),
+                                             std::istreambuf_iterator<char>() };
+    if (content.size() >= dds_magic.size() &&
+        std::equal(dds_magic.begin(), dds_magic.end(), content.begin())) {
+        LoadDds(content);
+    } else if (content.size() >= ktx_identifier.size() &&
+               std::equal(ktx_identifier.begin(), ktx_identifier.end(), content.begin())) {
+        LoadKtx(content);
+    } else {
+        throw std::runtime_error(
+            fmt::format("[{}] is neither a DDS nor a KTX file.", file.string()));
+    }
+    if (vertical_flip) {
+        if (CanFlipVertically()) {
+            FlipVertically();
+        } else {
+            logger->warn("Cannot flip [{}] vertically, it should be stored bottom up.",
+                         file.string());
+        }
+    }
+}
+
+glm::uvec2 CompressedImage::GetLevelSize(int level) const {
+    return glm::uvec2(std::max(size_.x >> level, 1u), std::max(size_.y >> level, 1u));
+}
+
+void CompressedImage::LoadDds(const std::vector<std::uint8_t>& content) {
+    if (ReadUint32(content, 4) != dds_header_size) {
+        throw std::runtime_error("Invalid DDS header size.");
+    }
+    size_.y                 = ReadUint32(content, 4 + 8);
+    size_.x                 = ReadUint32(content, 4 + 12);
+    const auto mip_count    = std::max(ReadUint32(content, 4 + 24), 1u);
+    const auto pixel_flags  = ReadUint32(content, 4 + 76);
+    const auto four_cc      = ReadUint32(content, 4 + 80);
+    const auto caps2        = ReadUint32(content, 4 + 108);
+    std::size_t data_offset = 4 + dds_header_size;
+    if (mip_count > GetMipmapCount(size_)) {
+        throw std::runtime_error(fmt::format("Invalid DDS mip count [{}].", mip_count));
+    }
+    if (!(pixel_flags & dds_pixel_flag_four_cc)) {
+        throw std::runtime_error("Only block compressed DDS files are supported.");
+    }
+    if (caps2 & dds_caps2_cubemap) {
+        throw std::runtime_error("DDS cube maps are not supported.");
+    }
+    if (four_cc == MakeFourCC('D', 'X', '1', '0')) {
+        format_ = DxgiToFormat(ReadUint32(content, data_offset));
+        if (ReadUint32(content, data_offset + 4) != dxgi_dimension_texture2d ||
+            ReadUint32(content, data_offset + 12) > 1) {
+            throw std::runtime_error("Only single 2D DDS textures are supported.");
+        }
+        data_offset += 20;
+    } else {
+        format_ = DdsFourCCToFormat(four_cc);
+    }
+    for (std::uint32_t i = 0; i < mip_count; ++i) {
+        const std::size_t level_size = GetCompressedImageSize(format_, GetLevelSize(i));
+        if (data_offset + level_size > content.size()) {
+            throw std::runtime_error("Truncated DDS file.");
+        }
+        levels_.emplace_back(content.begin() + data_offset,
+                             content.begin() + data_offset + level_size);
+        data_offset += level_size;
+    }
+}
+
+void CompressedImage::LoadKtx(const std::vector<std::uint8_t>& content) {
+    constexpr std::size_t header_offset = 12;
+    if (ReadUint32(content, header_offset) != ktx_endianness) {
+        throw std::runtime_error("Big endian KTX files are not supported.");
+    }
+    if (ReadUint32(content, header_offset + 4) != 0) {
+        throw std::runtime_error("Only compressed KTX files are supported.");
+    }
+    format_                   = GLInternalFormatToFormat(ReadUint32(content, header_offset + 16));
+    size_.x                   = ReadUint32(content, header_offset + 24);
+    size_.y                   = std::max(ReadUint32(content, header_offset + 28), 1u);
+    const auto depth          = ReadUint32(content, header_offset + 32);
+    const auto array_count    = ReadUint32(content, header_offset + 36);
+    const auto face_count     = ReadUint32(content, header_offset + 40);
+    const auto mip_count      = std::max(ReadUint32(content, header_offset + 44), 1u);
+    const auto key_value_size = ReadUint32(content, header_offset + 48);
+    if (depth > 1 || array_count > 1 || face_count != 1) {
+        throw std::runtime_error("Only single 2D KTX textures are supported.");
+    }
+    if (mip_count > GetMipmapCount(size_)) {
+        throw std::runtime_error(fmt::format("Invalid KTX mip count [{}].", mip_count));
+    }
+    std::size_t data_offset = header_offset + 13 * sizeof(std::uint32_t) + key_value_size;
+    for (std::uint32_t i = 0; i < mip_count; ++i) {
+        const std::size_t level_size = ReadUint32(content, data_offset);
+        data_offset += sizeof(std::uint32_t);
+        if (level_size != GetCompressedImageSize(format_, GetLevelSize(i)) ||
+            data_offset + level_size > content.size()) {
+            throw std::runtime_error(fmt::format("Invalid KTX level [{}].", i));
+        }
+        levels_.emplace_back(content.begin() + data_offset,
+                             content.begin() + data_offset + level_size);
+        // Levels are padded to 4 bytes.
+        data_offset += (level_size + 3) & ~std::size_t{ 3 };
+    }
+}
+
+bool CompressedImage::CanFlipVertically() const {
+    switch (format_) {
+        case CompressedFormatEnum::BC1:
+        case CompressedFormatEnum::BC3:
+        case CompressedFormatEnum::BC4:
+        case CompressedFormatEnum::BC5:
+            break;
+        default:
+            return false;
+    }
+    // A level taller than a block has to be made of whole blocks.
+    for (int i = 0; i < GetMipCount(); ++i) {
+        const std::uint32_t height = GetLevelSize(i).y;
+        if (height > 4 && height % 4 != 0) return false;
+    }
+    return true;
+}
+
+void CompressedImage::FlipVertically() {
+    if (!CanFlipVertically()) {
+        throw std::runtime_error("This compressed image cannot be flipped vertically.");
+    }
+    const std::size_t block_size = GetCompressedBlockSize(format_);
+    for (int i = 0; i < GetMipCount(); ++i) {
+        const glm::uvec2 level_size = GetLevelSize(i);
+        const std::size_t block_x   = (level_size.x + 3) / 4;
+        const std::size_t block_y   = (level_size.y + 3) / 4;
+        const std::size_t row_size  = block_x * block_size;
+        // Only the rows inside the image are flipped for level smaller than a block.
+        const std::uint32_t row_count = std::min(level_size.y, 4u);
+        auto& level                   = levels_[i];
+        for (std::size_t y = 0; y < block_y / 2; ++y) {
+            std::swap_ranges(level.begin() + y * row_size, level.begin() + (y + 1) * row_size,
+                             level.begin() + (block_y - 1 - y) * row_size);
+        }
+        for (std::size_t offset = 0; offset < level.size(); offset += block_size) {
+            std::uint8_t* block = level.data() + offset;
+            switch (format_) {
+                case CompressedFormatEnum::BC1:
+                    FlipBC1Block(block, row_count);
+                    break;
+                case CompressedFormatEnum::BC3:
+                    FlipBC4Block(block, row_count);
+                    FlipBC1Block(block + 8, row_count);
+                    break;
+                case CompressedFormatEnum::BC4:
+                    FlipBC4Block(block, row_count);
+                    break;
+                case CompressedFormatEnum::BC5:
+                    FlipBC4Block(block, row_count);
+                    FlipBC4Block(block + 8, row_count);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+void CompressedImage::SaveToDdsFile(const std::filesystem::path& file) const {
+    std::uint32_t four_cc = 0;
+    switch (format_) {
+        case CompressedFormatEnum::BC1:
+            four_cc = MakeFourCC('D', 'X', 'T', '1');
+            break;
+        case CompressedFormatEnum::BC3:
+            four_cc = MakeFourCC('D', 'X', 'T', '5');
+            break;
+        case CompressedFormatEnum::BC4:
+            four_cc = MakeFourCC('A', 'T', 'I', '1');
+            break;
+        case CompressedFormatEnum::BC5:
+            four_cc = MakeFourCC('A', 'T', 'I', '2');
+            break;
+        case CompressedFormatEnum::BC7:
+            four_cc = MakeFourCC('D', 'X', '1', '0');
+            break;
+        default:
+            throw std::runtime_error("ETC2 images cannot be saved to a DDS file.");
+    }
+    const bool has_dx10 = format_ == CompressedFormatEnum::BC7;
+    std::vector<std::uint8_t> header(4 + dds_header_size + (has_dx10 ? 20 : 0), 0);
+    std::copy(dds_magic.begin(), dds_magic.end(), header.begin());
+    WriteUint32(header, 4, dds_header_size);
+    WriteUint32(header, 4 + 4, dds_flags | (GetMipCount() > 1 ? dds_flag_mipmap_count : 0));
+    WriteUint32(header, 4 + 8, size_.y);
+    WriteUint32(header, 4 + 12, size_.x);
+    WriteUint32(header, 4 + 16, static_cast<std::uint32_t>(levels_.front().size()));
+    WriteUint32(header, 4 + 24, static_cast<std::uint32_t>(GetMipCount()));
+    WriteUint32(header, 4 + 72, dds_pixel_format_size);
+    WriteUint32(header, 4 + 76, dds_pixel_flag_four_cc);
+    WriteUint32(header, 4 + 80, four_cc);
+    WriteUint32(header, 4 + 104, dds_caps_texture | (GetMipCount() > 1 ? dds_caps_mipmap : 0));
+    if (has_dx10) {
+        WriteUint32(header, 4 + dds_header_size, 98);
+        WriteUint32(header, 4 + dds_header_size + 4, dxgi_dimension_texture2d);
+        WriteUint32(header, 4 + dds_header_size + 12, 1);
+    }
+    std::ofstream ofs(file, std::ios::binary);
+    if (!ofs) {
+        throw std::runtime_error(fmt::format("Could not open file [{}].", file.string()));
+    }
+    ofs.write(reinterpret_cast<const char*>(header.data()), header.size());
+    for (const auto& level : levels_) {
+        ofs.write(reinterpret_cast<const char*>(level.data()), level.size());
+    }
+    if (!ofs) {
+        throw std::runtime_error(fmt::format("Could not write file [{}].", file.string()));
+    }
+}
+
+}  // End namespace frame::file.
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/json/parse_pixel.h"
+
+namespace frame::file {
+
+/**
+ * @brief Block compressed formats, all of them are made of 4x4 texel blocks.
+ */
+enum class CompressedFormatEnum {
+    BC1,        //!< RGB 5:6:5 endpoints (DXT1), 8 bytes per block.
+    BC3,        //!< BC4 alpha followed by a BC1 color block (DXT5), 16 bytes per block.
+    BC4,        //!< Single channel (RGTC1), 8 bytes per block.
+    BC5,        //!< Two channels (RGTC2), 16 bytes per block.
+    BC7,        //!< RGBA (BPTC), 16 bytes per block.
+    ETC2_RGB,   //!< RGB (ETC2), 8 bytes per block.
+    ETC2_RGBA,  //!< RGBA (ETC2 + EAC alpha), 16 bytes per block.
+};
+
+/**
+ * @brief Get the size of a 4x4 block in bytes.
+ * @param format: Compressed format.
+ * @return Size of a block in bytes (8 or 16).
+ */
+std::size_t GetCompressedBlockSize(CompressedFormatEnum format);
+/**
+ * @brief Get the size of a compressed image (or mip level) in bytes.
+ * @param format: Compressed format.
+ * @param size: Size of the image in texels (rounded up to whole blocks).
+ * @return Size of the compressed data in bytes.
+ */
+std::size_t GetCompressedImageSize(CompressedFormatEnum format, glm::uvec2 size);
+/**
+ * @brief Get the pixel structure once decompressed (BC4 is R, BC5 is RG, ...).
+ * @param format: Compressed format.
+ * @return The proto pixel structure.
+ */
+proto::PixelStructure GetCompressedPixelStructure(CompressedFormatEnum format);
+/**
+ * @brief Check if the file is a compressed image container (DDS or KTX) from its extension.
+ * @param file: File to be checked.
+ * @return True if the file is a DDS or a KTX file.
+ */
+bool IsCompressedImageFile(const std::filesystem::path& file);
+
+/**
+ * @class CompressedImage
+ * @brief Block compressed image with its mip chain, loaded from (or saved to) a DDS or a KTX (1.1)
+ * file. The data is kept as is so it can be uploaded directly to the GPU.
+ */
+class CompressedImage {
+   public:
+    /**
+     * @brief Constructor from already compressed levels (used by the encoder).
+     * @param format: Compressed format of the levels.
+     * @param size: Size of the first level.
+     * @param levels: Compressed data of each mip level (largest first).
+     */
+    CompressedImage(CompressedFormatEnum format, glm::uvec2 size,
+                    std::vector<std::vector<std::uint8_t>> levels);
+    /**
+     * @brief Constructor load a DDS or KTX file (throw std::runtime_error if the file or the
+     * format isn't supported).
+     * @param file: DDS or KTX file.
+     * @param vertical_flip: If true the image will be flipped vertically (like the Image class),
+     * images that cannot be flipped (see CanFlipVertically) are loaded as is.
+     */
+    explicit CompressedImage(const std::filesystem::path& file, bool vertical_flip = true);
+
+   public:
+    /**
+     * @brief Get the compressed format.
+     * @return The compressed format.
+     */
+    CompressedFormatEnum GetFormat() const { return format_; }
+    /**
+     * @brief Get size of the image (first level).
+     * @return The size of the image.
+     */
+    glm::uvec2 GetSize() const { return size_; }
+    /**
+     * @brief Get the number of mip levels stored.
+     * @return The number of mip levels.
+     */
+    int GetMipCount() const { return static_cast<int>(levels_.size()); }
+    /**
+     * @brief Get the size of a mip level.
+     * @param level: Mip level.
+     * @return The size of the level in texels.
+     */
+    glm::uvec2 GetLevelSize(int level) const;
+    /**
+     * @brief Get the compressed data of a mip level.
+     * @param level: Mip level.
+     * @return The compressed blocks of the level.
+     */
+    const std::vector<std::uint8_t>& GetLevel(int level) const { return levels_.at(level); }
+
+   public:
+    /**
+     * @brief Check if the image can be flipped without decompressing it, this is the case for BC1
+     * to BC5 as long as every level taller than a block is a multiple of 4.
+     * @return True if the image can be flipped.
+     */
+    bool CanFlipVertically() const;
+    /**
+     * @brief Flip the image vertically without decompressing it (swap the block rows and the rows
+     * inside the blocks), throw std::runtime_error if it cannot be flipped.
+     */
+    void FlipVertically();
+    /**
+     * @brief Save the image to a DDS file (BC1 to BC5 as FourCC and BC7 with the DX10 header),
+     * throw std::runtime_error for ETC2 or if the file cannot be written.
+     * @param file: The file to save the image to.
+     */
+    void SaveToDdsFile(const std::filesystem::path& file) const;
+
+   protected:
+    void LoadDds(const std::vector<std::uint8_t>& content);
+    void LoadKtx(const std::vector<std::uint8_t>& content);
+
+   protected:
+    CompressedFormatEnum format_                   = CompressedFormatEnum::BC1;
+    glm::uvec2 size_                               = glm::uvec2(0, 0);
+    std::vector<std::vector<std::uint8_t>> levels_ = {};
+};
+
+}  // End namespace frame::file.
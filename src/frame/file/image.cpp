@@ -28,8 +28,9 @@ Image::Image(const std::filesystem::path& file,
     logger->info("Openning image: [{}].", file.string());
     int channels;
     int desired_channels = { static_cast<int>(pixel_structure.value()) };
-    // This is in the case of OpenGL (for now the only case).
-    stbi_set_flip_vertically_on_load(vertical_flip);
+    // This is in the case of OpenGL (for now the only case), per thread as images are decoded on
+    // the loading workers.
+    stbi_set_flip_vertically_on_load_thread(vertical_flip);
     glm::ivec2 size = glm::ivec2(0, 0);
     switch (pixel_element_size.value()) {
         case proto::PixelElementSize::BYTE: {
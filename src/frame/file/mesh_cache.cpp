@@ -0,0 +1,230 @@
+#include "frame/file/mesh_cache.h"
+
+#include <fmt/core.h>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace frame::file {
+
+namespace {
+
+// Layout of the file (little endian, all the blobs are aligned on 16 bytes):
+//   CacheFileHeader | FileHeader | MeshRecord * mesh_count | vertex and index blobs.
+constexpr std::array<char, 4> file_magic    = { 'F', 'R', 'M', 'C' };
+constexpr std::uint32_t file_version        = 1;
+constexpr std::uint32_t max_attribute_count = 4;
+constexpr std::uint64_t blob_alignment      = 16;
+
+struct FileHeader {
+    CacheFileHeader cache_header;
+    std::uint32_t mesh_count;
+    std::uint32_t reserved[3];
+};
+static_assert(sizeof(FileHeader) == 32, "FileHeader is written as is.");
+
+struct AttributeRecord {
+    std::uint32_t location;
+    std::uint32_t size;
+    std::uint32_t offset;
+    std::uint8_t format;
+    std::uint8_t normalized;
+    std::uint8_t reserved[2];
+};
+static_assert(sizeof(AttributeRecord) == 16, "AttributeRecord is written as is.");
+
+struct MeshRecord {
+    std::uint32_t vertex_stride;
+    std::uint32_t attribute_count;
+    std::uint32_t index_element_size;
+    std::uint32_t reserved;
+    std::uint64_t vertex_offset;
+    std::uint64_t vertex_size;
+    std::uint64_t index_offset;
+    std::uint64_t index_size;
+    AttributeRecord attributes[max_attribute_count];
+};
+static_assert(sizeof(MeshRecord) == 112, "MeshRecord is written as is.");
+
+std::uint64_t Align(std::uint64_t value) {
+    return (value + blob_alignment - 1) & ~(blob_alignment - 1);
+}
+
+}  // End namespace.
+
+#if defined(_WIN32) || defined(_WIN64)
+
+MappedFile::MappedFile(const std::filesystem::path& file_name) {
+    file_handle_ = CreateFileW(file_name.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE) {
+        file_handle_ = nullptr;
+        throw std::runtime_error(fmt::format("Could not open file [{}].", file_name.string()));
+    }
+    LARGE_INTEGER file_size = {};
+    GetFileSizeEx(file_handle_, &file_size);
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    if (size_ == 0) {
+        CloseHandle(file_handle_);
+        throw std::runtime_error(fmt::format("Empty file [{}].", file_name.string()));
+    }
+    mapping_handle_ = CreateFileMappingW(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_handle_) {
+        CloseHandle(file_handle_);
+        throw std::runtime_error(fmt::format("Could not map file [{}].", file_name.string()));
+    }
+    data_ = static_cast<const std::uint8_t*>(
+        MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        CloseHandle(mapping_handle_);
+        CloseHandle(file_handle_);
+        throw std::runtime_error(fmt::format("Could not map file [{}].", file_name.string()));
+    }
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_handle_);
+    CloseHandle(file_handle_);
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& file_name) {
+    const int file_descriptor = open(file_name.string().c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        throw std::runtime_error(fmt::format("Could not open file [{}].", file_name.string()));
+    }
+    struct stat file_stat = {};
+    if (fstat(file_descriptor, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(file_descriptor);
+        throw std::runtime_error(fmt::format("Empty file [{}].", file_name.string()));
+    }
+    size_         = static_cast<std::size_t>(file_stat.st_size);
+    void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // The mapping keep a reference to the file.
+    close(file_descriptor);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error(fmt::format("Could not map file [{}].", file_name.string()));
+    }
+    data_ = static_cast<const std::uint8_t*>(mapping);
+}
+
+MappedFile::~MappedFile() { munmap(const_cast<std::uint8_t*>(data_), size_); }
+
+#endif  // _WIN32 || _WIN64
+
+CompiledMeshFile::CompiledMeshFile(const std::filesystem::path& file_name)
+    : mapped_file_(file_name) {
+    const std::uint8_t* data = mapped_file_.GetData();
+    const std::size_t size   = mapped_file_.GetSize();
+    FileHeader header        = {};
+    if (size < sizeof(header)) {
+        throw std::runtime_error(fmt::format("File [{}] is too small.", file_name.string()));
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.cache_header.magic != file_magic || header.cache_header.version != file_version) {
+        throw std::runtime_error(
+            fmt::format("File [{}] is not a compiled mesh (version {}).", file_name.string(),
+                        file_version));
+    }
+    if (sizeof(header) + static_cast<std::uint64_t>(header.mesh_count) * sizeof(MeshRecord) >
+        size) {
+        throw std::runtime_error(fmt::format("File [{}] is truncated.", file_name.string()));
+    }
+    source_hash_ = header.cache_header.hash;
+    for (std::uint32_t i = 0; i < header.mesh_count; ++i) {
+        MeshRecord record = {};
+        std::memcpy(&record, data + sizeof(header) + i * sizeof(MeshRecord), sizeof(record));
+        if (record.attribute_count > max_attribute_count ||
+            record.vertex_offset + record.vertex_size > size ||
+            record.index_offset + record.index_size > size) {
+            throw std::runtime_error(
+                fmt::format("Invalid mesh {} in file [{}].", i, file_name.string()));
+        }
+        CompiledMesh mesh       = {};
+        mesh.vertex_stride      = record.vertex_stride;
+        mesh.index_element_size = record.index_element_size;
+        mesh.vertices           = data + record.vertex_offset;
+        mesh.vertex_size        = static_cast<std::size_t>(record.vertex_size);
+        mesh.indices            = data + record.index_offset;
+        mesh.index_size         = static_cast<std::size_t>(record.index_size);
+        for (std::uint32_t j = 0; j < record.attribute_count; ++j) {
+            const auto& attribute = record.attributes[j];
+            mesh.vertex_attributes.push_back(
+                { attribute.location, attribute.size,
+                  static_cast<VertexAttributeFormatEnum>(attribute.format),
+                  attribute.normalized != 0, attribute.offset });
+        }
+        meshes_.push_back(std::move(mesh));
+    }
+}
+
+std::filesystem::path GetCompiledMeshPath(const std::filesystem::path& source_file,
+                                          std::uint64_t hash,
+                                          const std::filesystem::path& cache_directory /* = {}*/) {
+    const auto directory = cache_directory.empty() ? source_file.parent_path() : cache_directory;
+    return directory / fmt::format("{}.{:016x}.fmesh", source_file.stem().string(), hash);
+}
+
+void WriteCompiledMeshFile(const std::filesystem::path& file_name, std::uint64_t source_hash,
+                           const std::vector<InterleavedVertices>& meshes) {
+    FileHeader header   = {};
+    header.cache_header = { file_magic, file_version, source_hash };
+    header.mesh_count   = static_cast<std::uint32_t>(meshes.size());
+    // Place the blobs after the records.
+    std::vector<MeshRecord> records(meshes.size());
+    std::uint64_t offset = sizeof(header) + meshes.size() * sizeof(MeshRecord);
+    for (std::size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh = meshes[i];
+        if (mesh.vertex_attributes.size() > max_attribute_count) {
+            throw std::runtime_error(
+                fmt::format("Too many vertex attributes ({}).", mesh.vertex_attributes.size()));
+        }
+        auto& record              = records[i];
+        record.vertex_stride      = mesh.vertex_stride;
+        record.attribute_count    = static_cast<std::uint32_t>(mesh.vertex_attributes.size());
+        record.index_element_size = mesh.index_element_size;
+        record.vertex_offset      = Align(offset);
+        record.vertex_size        = mesh.vertices.size();
+        record.index_offset       = Align(record.vertex_offset + record.vertex_size);
+        record.index_size         = mesh.indices.size();
+        offset                    = record.index_offset + record.index_size;
+        for (std::size_t j = 0; j < mesh.vertex_attributes.size(); ++j) {
+            const auto& attribute       = mesh.vertex_attributes[j];
+            auto& attribute_record      = record.attributes[j];
+            attribute_record.location   = attribute.location;
+            attribute_record.size       = attribute.size;
+            attribute_record.offset     = attribute.offset;
+            attribute_record.format     = static_cast<std::uint8_t>(attribute.format);
+            attribute_record.normalized = attribute.normalized ? 1 : 0;
+        }
+    }
+    std::vector<std::uint8_t> bytes(static_cast<std::size_t>(offset), 0);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + sizeof(header), records.data(),
+                records.size() * sizeof(MeshRecord));
+    for (std::size_t i = 0; i < meshes.size(); ++i) {
+        std::memcpy(bytes.data() + records[i].vertex_offset, meshes[i].vertices.data(),
+                    meshes[i].vertices.size());
+        std::memcpy(bytes.data() + records[i].index_offset, meshes[i].indices.data(),
+                    meshes[i].indices.size());
+    }
+    // The cache header is written by WriteCacheFile.
+    const std::size_t skipped = sizeof(CacheFileHeader);
+    WriteCacheFile(file_name, header.cache_header,
+                   { { bytes.data() + skipped, bytes.size() - skipped } });
+}
+
+}  // End namespace frame::file.
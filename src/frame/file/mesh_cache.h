@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "frame/file/cache_file.h"
+#include "frame/static_mesh_interface.h"
+#include "frame/vertex_packing.h"
+
+namespace frame::file {
+
+/**
+ * @class MappedFile
+ * @brief Read only memory mapping of a whole file, the mapping is released at destruction.
+ */
+class MappedFile {
+   public:
+    /**
+     * @brief Constructor map the file in memory (throw std::runtime_error if it fails).
+     * @param file_name: File to be mapped.
+     */
+    explicit MappedFile(const std::filesystem::path& file_name);
+    //! @brief Destructor unmap the file.
+    ~MappedFile();
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+   public:
+    /**
+     * @brief Get the mapped bytes.
+     * @return Pointer to the first byte of the file.
+     */
+    const std::uint8_t* GetData() const { return data_; }
+    /**
+     * @brief Get the size of the mapping.
+     * @return Size of the file in bytes.
+     */
+    std::size_t GetSize() const { return size_; }
+
+   protected:
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_         = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    void* file_handle_    = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+/**
+ * @class CompiledMesh
+ * @brief View of a mesh inside a compiled mesh file, the vertices and indices point directly into
+ * the mapping and are ready to be uploaded to the GPU.
+ */
+struct CompiledMesh {
+    //! @brief Size of a vertex in bytes.
+    std::uint32_t vertex_stride = 0;
+    //! @brief Attributes in the vertex.
+    std::vector<VertexAttribute> vertex_attributes = {};
+    //! @brief Size of an index in bytes (2 or 4).
+    std::uint32_t index_element_size = sizeof(std::uint32_t);
+    //! @brief Interleaved vertex data (inside the mapping).
+    const std::uint8_t* vertices = nullptr;
+    //! @brief Size of the vertex data in bytes.
+    std::size_t vertex_size = 0;
+    //! @brief Index data (inside the mapping).
+    const std::uint8_t* indices = nullptr;
+    //! @brief Size of the index data in bytes.
+    std::size_t index_size = 0;
+};
+
+/**
+ * @class CompiledMeshFile
+ * @brief A compiled mesh file (a small header followed by the GPU ready blobs) mapped in memory.
+ */
+class CompiledMeshFile {
+   public:
+    /**
+     * @brief Constructor map and validate a compiled mesh file (throw std::runtime_error if it is
+     * not a valid file).
+     * @param file_name: Compiled mesh file.
+     */
+    explicit CompiledMeshFile(const std::filesystem::path& file_name);
+
+   public:
+    /**
+     * @brief Get the hash of the source file the meshes were compiled from.
+     * @return Hash of the source file.
+     */
+    std::uint64_t GetSourceHash() const { return source_hash_; }
+    /**
+     * @brief Get the meshes, they are only valid as long as this object is alive.
+     * @return Views of the meshes in the file.
+     */
+    const std::vector<CompiledMesh>& GetMeshes() const { return meshes_; }
+
+   protected:
+    MappedFile mapped_file_;
+    std::uint64_t source_hash_        = 0;
+    std::vector<CompiledMesh> meshes_ = {};
+};
+
+/**
+ * @brief Get the path of the compiled mesh for a source file.
+ * @param source_file: Source file (OBJ or PLY).
+ * @param hash: Hash of the source file (see HashFile).
+ * @param cache_directory: Directory of the cache, if empty it is next to the source.
+ * @return Path of the compiled mesh file.
+ */
+std::filesystem::path GetCompiledMeshPath(const std::filesystem::path& source_file,
+                                          std::uint64_t hash,
+                                          const std::filesystem::path& cache_directory = {});
+/**
+ * @brief Write the meshes into a compiled mesh file (throw std::runtime_error if it fails).
+ * @param file_name: Compiled mesh file.
+ * @param source_hash: Hash of the source file.
+ * @param meshes: The interleaved meshes.
+ */
+void WriteCompiledMeshFile(const std::filesystem::path& file_name, std::uint64_t source_hash,
+                           const std::vector<InterleavedVertices>& meshes);
+
+}  // End namespace frame::file.
@@ -0,0 +1,231 @@
+#include "frame/file/mesh_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace frame::file {
+
+namespace {
+
+// Size of the cache used to score the vertices (bigger than the real one on purpose).
+constexpr std::size_t score_cache_size = 32;
+constexpr float cache_decay_power      = 1.5f;
+constexpr float last_triangle_score    = 0.75f;
+constexpr float valence_boost_scale    = 2.0f;
+constexpr float valence_boost_power    = 0.5f;
+constexpr std::uint32_t invalid_index  = 0xffffffff;
+
+// Score of a vertex from its position in the cache and the number of triangles left to draw.
+float VertexScore(int cache_position, std::uint32_t remaining_valence) {
+    // No triangle left, never pick it.
+    if (remaining_valence == 0) return -1.0f;
+    float score = 0.0f;
+    if (cache_position >= 0) {
+        if (cache_position < 3) {
+            // Used by the last triangle, fixed score so the strips don't go backward.
+            score = last_triangle_score;
+        } else {
+            const float scaler = 1.0f / static_cast<float>(score_cache_size - 3);
+            score              = 1.0f - static_cast<float>(cache_position - 3) * scaler;
+            score              = std::pow(score, cache_decay_power);
+        }
+    }
+    // Boost the vertices with few triangles left so they are finished quickly.
+    score += valence_boost_scale *
+             std::pow(static_cast<float>(remaining_valence), -valence_boost_power);
+    return score;
+}
+
+}  // End namespace.
+
+float ComputeAcmr(const std::vector<std::uint32_t>& indices, std::size_t vertex_count,
+                  std::size_t cache_size /* = 16*/) {
+    const std::size_t triangle_count = indices.size() / 3;
+    if (triangle_count == 0) return 0.0f;
+    // A vertex is in the FIFO if less than cache_size vertices were inserted after it.
+    std::vector<std::size_t> timestamps(vertex_count, 0);
+    std::size_t time   = cache_size + 1;
+    std::size_t misses = 0;
+    for (const auto index : indices) {
+        if (time - timestamps[index] > cache_size) {
+            timestamps[index] = time++;
+            misses++;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangle_count);
+}
+
+void OptimizeVertexCache(std::vector<std::uint32_t>& indices, std::size_t vertex_count) {
+    const std::size_t triangle_count = indices.size() / 3;
+    if (triangle_count == 0) return;
+    // Triangles adjacent to every vertex (the first valence ones are the remaining ones).
+    std::vector<std::uint32_t> valences(vertex_count, 0);
+    for (const auto index : indices) valences[index]++;
+    std::vector<std::uint32_t> offsets(vertex_count + 1, 0);
+    std::partial_sum(valences.begin(), valences.end(), offsets.begin() + 1);
+    std::vector<std::uint32_t> adjacency(indices.size());
+    {
+        std::vector<std::uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+        for (std::uint32_t i = 0; i < indices.size(); ++i) {
+            adjacency[cursors[indices[i]]++] = i / 3;
+        }
+    }
+    std::vector<int> cache_positions(vertex_count, -1);
+    std::vector<float> vertex_scores(vertex_count);
+    for (std::size_t i = 0; i < vertex_count; ++i) {
+        vertex_scores[i] = VertexScore(-1, valences[i]);
+    }
+    std::vector<float> triangle_scores(triangle_count);
+    std::vector<bool> triangle_added(triangle_count, false);
+    std::uint32_t best_triangle = 0;
+    for (std::uint32_t i = 0; i < triangle_count; ++i) {
+        triangle_scores[i] = vertex_scores[indices[i * 3]] + vertex_scores[indices[i * 3 + 1]] +
+                             vertex_scores[indices[i * 3 + 2]];
+        if (triangle_scores[i] > triangle_scores[best_triangle]) best_triangle = i;
+    }
+    std::vector<std::uint32_t> result;
+    result.reserve(indices.size());
+    std::vector<std::uint32_t> cache;
+    std::vector<std::uint32_t> new_cache;
+    std::uint32_t scan_cursor = 0;
+    while (result.size() < indices.size()) {
+        // Emit the best triangle and remove it from the adjacency of its vertices.
+        triangle_added[best_triangle] = true;
+        new_cache.clear();
+        for (std::uint32_t i = 0; i < 3; ++i) {
+            const auto vertex = indices[best_triangle * 3 + i];
+            result.push_back(vertex);
+            new_cache.push_back(vertex);
+            auto begin = adjacency.begin() + offsets[vertex];
+            auto end   = begin + valences[vertex];
+            std::iter_swap(std::find(begin, end, best_triangle), end - 1);
+            valences[vertex]--;
+        }
+        // The vertices of the triangle go to the front of the cache (LRU).
+        for (const auto vertex : cache) {
+            if (std::find(new_cache.begin(), new_cache.begin() + 3, vertex) ==
+                new_cache.begin() + 3) {
+                new_cache.push_back(vertex);
+            }
+        }
+        for (std::size_t i = score_cache_size; i < new_cache.size(); ++i) {
+            cache_positions[new_cache[i]] = -1;
+            vertex_scores[new_cache[i]]   = VertexScore(-1, valences[new_cache[i]]);
+        }
+        new_cache.resize(std::min(new_cache.size(), score_cache_size));
+        std::swap(cache, new_cache);
+        for (std::size_t i = 0; i < cache.size(); ++i) {
+            cache_positions[cache[i]] = static_cast<int>(i);
+            vertex_scores[cache[i]]   = VertexScore(static_cast<int>(i), valences[cache[i]]);
+        }
+        // Only the triangles touching the cache changed score.
+        float best_score = -1.0f;
+        best_triangle    = invalid_index;
+        for (const auto vertex : cache) {
+            for (std::uint32_t i = 0; i < valences[vertex]; ++i) {
+                const auto triangle = adjacency[offsets[vertex] + i];
+                const float score   = vertex_scores[indices[triangle * 3]] +
+                                    vertex_scores[indices[triangle * 3 + 1]] +
+                                    vertex_scores[indices[triangle * 3 + 2]];
+                triangle_scores[triangle] = score;
+                if (score > best_score) {
+                    best_score    = score;
+                    best_triangle = triangle;
+                }
+            }
+        }
+        // Nothing left around the cache, restart from the next triangle not yet emitted.
+        if (best_triangle == invalid_index) {
+            while (scan_cursor < triangle_count && triangle_added[scan_cursor]) scan_cursor++;
+            if (scan_cursor == triangle_count) break;
+            best_triangle = scan_cursor;
+        }
+    }
+    indices = std::move(result);
+}
+
+void OptimizeOverdraw(std::vector<std::uint32_t>& indices,
+                      const std::vector<glm::vec3>& positions, float threshold /* = 1.05f*/) {
+    const std::size_t triangle_count = indices.size() / 3;
+    if (triangle_count == 0) return;
+    // Cut the triangles in clusters where the cache is cold (all the vertices of a triangle miss).
+    constexpr std::size_t cache_size = 16;
+    std::vector<std::size_t> timestamps(positions.size(), 0);
+    std::size_t time = cache_size + 1;
+    std::vector<std::uint32_t> cluster_starts;
+    for (std::uint32_t i = 0; i < triangle_count; ++i) {
+        std::uint32_t misses = 0;
+        for (std::uint32_t j = 0; j < 3; ++j) {
+            const auto index = indices[i * 3 + j];
+            if (time - timestamps[index] > cache_size) {
+                timestamps[index] = time++;
+                misses++;
+            }
+        }
+        if (misses == 3) cluster_starts.push_back(i);
+    }
+    cluster_starts.push_back(static_cast<std::uint32_t>(triangle_count));
+    const std::size_t cluster_count = cluster_starts.size() - 1;
+    // Area weighted centroid and normal of every cluster.
+    std::vector<glm::vec3> cluster_centroids(cluster_count, glm::vec3(0.0f));
+    std::vector<glm::vec3> cluster_normals(cluster_count, glm::vec3(0.0f));
+    glm::vec3 mesh_centroid(0.0f);
+    float mesh_area = 0.0f;
+    for (std::size_t c = 0; c < cluster_count; ++c) {
+        float cluster_area = 0.0f;
+        for (std::uint32_t i = cluster_starts[c]; i < cluster_starts[c + 1]; ++i) {
+            const auto& a          = positions[indices[i * 3]];
+            const auto& b          = positions[indices[i * 3 + 1]];
+            const auto& c_vertex   = positions[indices[i * 3 + 2]];
+            const glm::vec3 normal = glm::cross(b - a, c_vertex - a);
+            const float area       = glm::length(normal) * 0.5f;
+            cluster_normals[c] += normal;
+            cluster_centroids[c] += (a + b + c_vertex) * (area / 3.0f);
+            cluster_area += area;
+        }
+        mesh_centroid += cluster_centroids[c];
+        mesh_area += cluster_area;
+        if (cluster_area > 0.0f) cluster_centroids[c] /= cluster_area;
+    }
+    if (mesh_area > 0.0f) mesh_centroid /= mesh_area;
+    // Clusters that face away from the center are more likely to occlude the others.
+    std::vector<float> sort_keys(cluster_count, 0.0f);
+    for (std::size_t c = 0; c < cluster_count; ++c) {
+        const float normal_length = glm::length(cluster_normals[c]);
+        if (normal_length > 0.0f) {
+            sort_keys[c] = glm::dot(cluster_centroids[c] - mesh_centroid,
+                                    cluster_normals[c] / normal_length);
+        }
+    }
+    std::vector<std::uint32_t> cluster_order(cluster_count);
+    std::iota(cluster_order.begin(), cluster_order.end(), 0);
+    std::stable_sort(cluster_order.begin(), cluster_order.end(),
+                     [&sort_keys](std::uint32_t left, std::uint32_t right) {
+                         return sort_keys[left] > sort_keys[right];
+                     });
+    std::vector<std::uint32_t> result;
+    result.reserve(indices.size());
+    for (const auto cluster : cluster_order) {
+        result.insert(result.end(), indices.begin() + cluster_starts[cluster] * 3,
+                      indices.begin() + cluster_starts[cluster + 1] * 3);
+    }
+    // Keep the cache order if the new one cost too much.
+    if (ComputeAcmr(result, positions.size()) <=
+        ComputeAcmr(indices, positions.size()) * threshold) {
+        indices = std::move(result);
+    }
+}
+
+std::vector<std::uint32_t> OptimizeVertexFetch(std::vector<std::uint32_t>& indices,
+                                               std::size_t vertex_count) {
+    std::vector<std::uint32_t> remap(vertex_count, invalid_index);
+    std::uint32_t next_vertex = 0;
+    for (auto& index : indices) {
+        if (remap[index] == invalid_index) remap[index] = next_vertex++;
+        index = remap[index];
+    }
+    return remap;
+}
+
+}  // End namespace frame::file.
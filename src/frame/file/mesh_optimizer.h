@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <glm/glm.hpp>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "frame/file/cache_file.h"
+
+namespace frame::file {
+
+/**
+ * @class MeshOptimizerStats
+ * @brief Statistics of a mesh before and after the optimization passes.
+ */
+struct MeshOptimizerStats {
+    //! @brief Number of vertices before welding.
+    std::size_t vertex_count_before = 0;
+    //! @brief Number of vertices after welding.
+    std::size_t vertex_count_after = 0;
+    //! @brief Average cache miss ratio (misses per triangle) before the reordering.
+    float acmr_before = 0.0f;
+    //! @brief Average cache miss ratio (misses per triangle) after the reordering.
+    float acmr_after = 0.0f;
+};
+
+/**
+ * @brief Weld the vertices that are bitwise identical, the index buffer is remapped in place.
+ * @param vertices: Vertices (should not have padding) replaced by the unique ones in order of
+ * first appearance.
+ * @param indices: Index buffer remapped in place.
+ */
+template <typename T>
+void WeldVertices(std::vector<T>& vertices, std::vector<std::uint32_t>& indices) {
+    static_assert(std::is_trivially_copyable_v<T>, "Vertices are compared as bytes.");
+    struct Hash {
+        std::size_t operator()(const T& vertex) const {
+            return static_cast<std::size_t>(HashBytes(&vertex, sizeof(T)));
+        }
+    };
+    struct Equal {
+        bool operator()(const T& left, const T& right) const {
+            return std::memcmp(&left, &right, sizeof(T)) == 0;
+        }
+    };
+    std::unordered_map<T, std::uint32_t, Hash, Equal> vertex_index_map;
+    vertex_index_map.reserve(vertices.size());
+    std::vector<T> welded_vertices;
+    std::vector<std::uint32_t> remap(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        auto [it, inserted] = vertex_index_map.insert(
+            { vertices[i], static_cast<std::uint32_t>(welded_vertices.size()) });
+        if (inserted) welded_vertices.push_back(vertices[i]);
+        remap[i] = it->second;
+    }
+    for (auto& index : indices) index = remap[index];
+    vertices = std::move(welded_vertices);
+}
+/**
+ * @brief Compute the average cache miss ratio of an index buffer by simulating a FIFO
+ * post-transform cache (3.0 is the worst, 0.5 is the best possible on a large regular grid).
+ * @param indices: Index buffer (3 indices per triangle).
+ * @param vertex_count: Number of vertices referenced by the index buffer.
+ * @param cache_size: Size of the simulated FIFO cache.
+ * @return Number of cache misses per triangle.
+ */
+float ComputeAcmr(const std::vector<std::uint32_t>& indices, std::size_t vertex_count,
+                  std::size_t cache_size = 16);
+/**
+ * @brief Reorder the triangles to maximize the post-transform cache hits (Forsyth's linear speed
+ * vertex cache optimization).
+ * @param indices: Index buffer (3 indices per triangle) reordered in place.
+ * @param vertex_count: Number of vertices referenced by the index buffer.
+ */
+void OptimizeVertexCache(std::vector<std::uint32_t>& indices, std::size_t vertex_count);
+/**
+ * @brief Reorder clusters of triangles (cut where the cache is flushed) so that the outward facing
+ * ones are drawn first, this reduce the overdraw without degrading the cache too much.
+ * @param indices: Index buffer (already optimized for the vertex cache) reordered in place.
+ * @param positions: Positions of the vertices.
+ * @param threshold: Maximum ACMR degradation allowed (1.05 allow 5% more misses).
+ */
+void OptimizeOverdraw(std::vector<std::uint32_t>& indices, const std::vector<glm::vec3>& positions,
+                      float threshold = 1.05f);
+/**
+ * @brief Compute a vertex remap so that vertices are in the order of their first use in the index
+ * buffer (the index buffer is remapped in place), unused vertices are dropped.
+ * @param indices: Index buffer remapped in place.
+ * @param vertex_count: Number of vertices referenced by the index buffer.
+ * @return For every old vertex its new position (0xffffffff if unused).
+ */
+std::vector<std::uint32_t> OptimizeVertexFetch(std::vector<std::uint32_t>& indices,
+                                               std::size_t vertex_count);
+/**
+ * @brief Apply a remap (from OptimizeVertexFetch) to a vertex array.
+ * @param vertices: Vertices to be reordered.
+ * @param remap: For every old vertex its new position (0xffffffff if unused).
+ * @return The reordered vertices.
+ */
+template <typename T>
+std::vector<T> RemapVertices(const std::vector<T>& vertices,
+                             const std::vector<std::uint32_t>& remap) {
+    std::size_t count = 0;
+    for (const auto index : remap) {
+        if (index != 0xffffffff) count++;
+    }
+    std::vector<T> result(count);
+    for (std::size_t i = 0; i < remap.size(); ++i) {
+        if (remap[i] != 0xffffffff) result[remap[i]] = vertices[i];
+    }
+    return result;
+}
+
+}  // End namespace frame::file.
@@ -0,0 +1,283 @@
+#include "frame/file/mesh_simplifier.h"
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+
+#include "frame/file/mesh_optimizer.h"
+
+namespace frame::file {
+
+namespace {
+
+// Weight of the planes added along the open borders (relative to the area of the triangles).
+constexpr double border_weight = 10.0;
+
+// Sum of squared distances to a set of planes, stored as the 10 coefficients of a symmetric 4 x 4
+// matrix (double as the distances are squared twice).
+struct Quadric {
+    double xx = 0.0;
+    double xy = 0.0;
+    double xz = 0.0;
+    double xw = 0.0;
+    double yy = 0.0;
+    double yz = 0.0;
+    double yw = 0.0;
+    double zz = 0.0;
+    double zw = 0.0;
+    double ww = 0.0;
+
+    // Add the plane (normal should be normalized) through a point.
+    void AddPlane(glm::vec3 normal, glm::vec3 point, double weight) {
+        const double a = normal.x;
+        const double b = normal.y;
+        const double c = normal.z;
+        const double d = -(a * point.x + b * point.y + c * point.z);
+        xx += weight * a * a;
+        xy += weight * a * b;
+        xz += weight * a * c;
+        xw += weight * a * d;
+        yy += weight * b * b;
+        yz += weight * b * c;
+        yw += weight * b * d;
+        zz += weight * c * c;
+        zw += weight * c * d;
+        ww += weight * d * d;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        xx += other.xx;
+        xy += other.xy;
+        xz += other.xz;
+        xw += other.xw;
+        yy += other.yy;
+        yz += other.yz;
+        yw += other.yw;
+        zz += other.zz;
+        zw += other.zw;
+        ww += other.ww;
+        return *this;
+    }
+
+    // Weighted sum of the squared distances from a point to the planes.
+    double Evaluate(glm::vec3 point) const {
+        const double x     = point.x;
+        const double y     = point.y;
+        const double z     = point.z;
+        const double error = xx * x * x + 2.0 * xy * x * y + 2.0 * xz * x * z + 2.0 * xw * x +
+                             yy * y * y + 2.0 * yz * y * z + 2.0 * yw * y + zz * z * z +
+                             2.0 * zw * z + ww;
+        // Rounding can make it slightly negative.
+        return std::max(error, 0.0);
+    }
+};
+
+// Collapse of a vertex on another, only valid if none of them changed since it was computed.
+struct Collapse {
+    double cost                = 0.0;
+    std::uint32_t from         = 0;
+    std::uint32_t to           = 0;
+    std::uint32_t from_version = 0;
+    std::uint32_t to_version   = 0;
+
+    bool operator>(const Collapse& other) const { return cost > other.cost; }
+};
+
+// For every vertex the first vertex at the same position.
+std::vector<std::uint32_t> ComputeCanonicalVertices(const std::vector<glm::vec3>& positions) {
+    std::vector<std::uint32_t> order(positions.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto less = [&positions](std::uint32_t left, std::uint32_t right) {
+        return std::tie(positions[left].x, positions[left].y, positions[left].z) <
+               std::tie(positions[right].x, positions[right].y, positions[right].z);
+    };
+    std::stable_sort(order.begin(), order.end(), less);
+    std::vector<std::uint32_t> canonical(positions.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const bool same = i > 0 && positions[order[i]] == positions[order[i - 1]];
+        canonical[order[i]] = same ? canonical[order[i - 1]] : order[i];
+    }
+    return canonical;
+}
+
+}  // End namespace.
+
+std::vector<std::uint32_t> SimplifyMesh(const std::vector<std::uint32_t>& indices,
+                                        const std::vector<glm::vec3>& positions,
+                                        std::size_t target_index_count) {
+    const std::size_t triangle_count = indices.size() / 3;
+    const std::size_t vertex_count   = positions.size();
+    const auto canonical             = ComputeCanonicalVertices(positions);
+    // The collapses work on the canonical vertices.
+    std::vector<std::uint32_t> corners(triangle_count * 3);
+    for (std::size_t i = 0; i < corners.size(); ++i) corners[i] = canonical[indices[i]];
+    std::vector<bool> triangle_alive(triangle_count, true);
+    std::size_t alive_count = triangle_count;
+    std::vector<std::vector<std::uint32_t>> vertex_triangles(vertex_count);
+    std::vector<Quadric> quadrics(vertex_count);
+    std::unordered_map<std::uint64_t, std::uint32_t> edge_counts;
+    auto edge_key = [](std::uint32_t a, std::uint32_t b) {
+        return (static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    };
+    auto triangle_normal = [&positions](std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+        return glm::cross(positions[b] - positions[a], positions[c] - positions[a]);
+    };
+    for (std::uint32_t t = 0; t < triangle_count; ++t) {
+        const std::uint32_t a = corners[t * 3];
+        const std::uint32_t b = corners[t * 3 + 1];
+        const std::uint32_t c = corners[t * 3 + 2];
+        if (a == b || b == c || c == a) {
+            triangle_alive[t] = false;
+            --alive_count;
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            vertex_triangles[corners[t * 3 + k]].push_back(t);
+            ++edge_counts[edge_key(corners[t * 3 + k], corners[t * 3 + (k + 1) % 3])];
+        }
+        // Area weighted plane of the triangle.
+        const glm::vec3 normal = triangle_normal(a, b, c);
+        const float length     = glm::length(normal);
+        if (length == 0.0f) continue;
+        for (int k = 0; k < 3; ++k) {
+            quadrics[corners[t * 3 + k]].AddPlane(normal / length, positions[a], length * 0.5);
+        }
+    }
+    // Plane perpendicular to the triangle along the open borders, so they stay in place.
+    for (std::uint32_t t = 0; t < triangle_count; ++t) {
+        if (!triangle_alive[t]) continue;
+        const glm::vec3 normal = triangle_normal(corners[t * 3], corners[t * 3 + 1],
+                                                 corners[t * 3 + 2]);
+        for (int k = 0; k < 3; ++k) {
+            const std::uint32_t a = corners[t * 3 + k];
+            const std::uint32_t b = corners[t * 3 + (k + 1) % 3];
+            if (edge_counts[edge_key(a, b)] != 1) continue;
+            const glm::vec3 edge        = positions[b] - positions[a];
+            const glm::vec3 edge_normal = glm::cross(edge, normal);
+            const float length          = glm::length(edge_normal);
+            if (length == 0.0f) continue;
+            const double weight = border_weight * glm::dot(edge, edge);
+            quadrics[a].AddPlane(edge_normal / length, positions[a], weight);
+            quadrics[b].AddPlane(edge_normal / length, positions[a], weight);
+        }
+    }
+    edge_counts.clear();
+    // A triangle of the vertex that doesn't collapse shouldn't flip.
+    auto is_collapse_valid = [&](std::uint32_t from, std::uint32_t to) {
+        for (const auto t : vertex_triangles[from]) {
+            if (!triangle_alive[t]) continue;
+            std::uint32_t moved[3] = { corners[t * 3], corners[t * 3 + 1], corners[t * 3 + 2] };
+            if (moved[0] == to || moved[1] == to || moved[2] == to) continue;
+            const glm::vec3 before = triangle_normal(moved[0], moved[1], moved[2]);
+            std::replace(std::begin(moved), std::end(moved), from, to);
+            if (glm::dot(before, triangle_normal(moved[0], moved[1], moved[2])) <= 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    };
+    std::vector<std::uint32_t> versions(vertex_count, 0);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+    // Only the cheapest direction of an edge is queued.
+    auto push_edge = [&](std::uint32_t a, std::uint32_t b) {
+        Quadric quadric = quadrics[a];
+        quadric += quadrics[b];
+        const double cost_ab = quadric.Evaluate(positions[b]);
+        const double cost_ba = quadric.Evaluate(positions[a]);
+        if (cost_ab <= cost_ba) {
+            collapses.push({ cost_ab, a, b, versions[a], versions[b] });
+        } else {
+            collapses.push({ cost_ba, b, a, versions[b], versions[a] });
+        }
+    };
+    for (std::uint32_t t = 0; t < triangle_count; ++t) {
+        if (!triangle_alive[t]) continue;
+        for (int k = 0; k < 3; ++k) push_edge(corners[t * 3 + k], corners[t * 3 + (k + 1) % 3]);
+    }
+    while (alive_count * 3 > target_index_count && !collapses.empty()) {
+        const Collapse collapse = collapses.top();
+        collapses.pop();
+        const std::uint32_t from = collapse.from;
+        const std::uint32_t to   = collapse.to;
+        if (versions[from] != collapse.from_version || versions[to] != collapse.to_version) {
+            continue;
+        }
+        if (!is_collapse_valid(from, to)) {
+            // Give the other direction a chance (it is more expensive or it would have been
+            // queued).
+            if (is_collapse_valid(to, from)) {
+                Quadric quadric = quadrics[from];
+                quadric += quadrics[to];
+                collapses.push(
+                    { quadric.Evaluate(positions[from]), to, from, versions[to], versions[from] });
+            }
+            continue;
+        }
+        quadrics[to] += quadrics[from];
+        ++versions[from];
+        ++versions[to];
+        for (const auto t : vertex_triangles[from]) {
+            if (!triangle_alive[t]) continue;
+            std::replace(corners.begin() + t * 3, corners.begin() + t * 3 + 3, from, to);
+            const std::uint32_t a = corners[t * 3];
+            const std::uint32_t b = corners[t * 3 + 1];
+            const std::uint32_t c = corners[t * 3 + 2];
+            if (a == b || b == c || c == a) {
+                triangle_alive[t] = false;
+                --alive_count;
+            } else {
+                vertex_triangles[to].push_back(t);
+            }
+        }
+        vertex_triangles[from] = {};
+        // Drop the dead triangles and queue the edges around the vertex with its new quadric.
+        auto& triangles = vertex_triangles[to];
+        triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                       [&triangle_alive](std::uint32_t t) {
+                                           return !triangle_alive[t];
+                                       }),
+                        triangles.end());
+        for (const auto t : triangles) {
+            for (int k = 0; k < 3; ++k) {
+                if (corners[t * 3 + k] != to) push_edge(to, corners[t * 3 + k]);
+            }
+        }
+    }
+    // Corners that didn't move keep their own vertex (and its attributes).
+    std::vector<std::uint32_t> result;
+    result.reserve(alive_count * 3);
+    for (std::size_t i = 0; i < corners.size(); ++i) {
+        if (!triangle_alive[i / 3]) continue;
+        result.push_back((corners[i] == canonical[indices[i]]) ? indices[i] : corners[i]);
+    }
+    return result;
+}
+
+LevelOfDetailIndices BuildLevelOfDetailIndices(const std::vector<std::uint32_t>& indices,
+                                               const std::vector<glm::vec3>& positions,
+                                               std::uint32_t level_count,
+                                               float reduction /* = 0.5f*/) {
+    LevelOfDetailIndices level_of_detail_indices = {};
+    level_of_detail_indices.indices              = indices;
+    level_of_detail_indices.offsets.push_back(0);
+    std::vector<std::uint32_t> previous = indices;
+    for (std::uint32_t level = 1; level < level_count; ++level) {
+        const std::size_t target =
+            static_cast<std::size_t>(static_cast<float>(previous.size() / 3) * reduction) * 3;
+        if (target == 0) break;
+        auto simplified = SimplifyMesh(previous, positions, target);
+        // Not even half way to the target, the mesh can't be simplified anymore.
+        if (simplified.empty() || simplified.size() * 2 > previous.size() + target) break;
+        OptimizeVertexCache(simplified, positions.size());
+        level_of_detail_indices.offsets.push_back(
+            static_cast<std::uint32_t>(level_of_detail_indices.indices.size()));
+        level_of_detail_indices.indices.insert(level_of_detail_indices.indices.end(),
+                                               simplified.begin(), simplified.end());
+        previous = std::move(simplified);
+    }
+    return level_of_detail_indices;
+}
+
+}  // End namespace frame::file.
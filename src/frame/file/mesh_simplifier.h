@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace frame::file {
+
+/**
+ * @class LevelOfDetailIndices
+ * @brief Index buffer holding a chain of levels of detail one after the other, all the levels use
+ * the same vertices.
+ */
+struct LevelOfDetailIndices {
+    //! @brief Indices of all the levels (3 per triangle), the full resolution level first.
+    std::vector<std::uint32_t> indices = {};
+    //! @brief Offset of the first index of every level in indices.
+    std::vector<std::uint32_t> offsets = {};
+};
+
+/**
+ * @brief Simplify a triangle mesh with quadric error metrics: the edge that adds the least squared
+ * distance to the planes of the original triangles is collapsed first. Vertices only collapse on
+ * existing vertices (so the vertex buffer can be shared with the original mesh), vertices at the
+ * same position are moved together (no crack along the seams of normals or texture coordinates)
+ * and the open borders are kept.
+ * @param indices: Index buffer (3 indices per triangle).
+ * @param positions: Positions of the vertices.
+ * @param target_index_count: Stop when the number of indices is below this.
+ * @return The simplified index buffer (can be bigger than the target if no collapse is left).
+ */
+std::vector<std::uint32_t> SimplifyMesh(const std::vector<std::uint32_t>& indices,
+                                        const std::vector<glm::vec3>& positions,
+                                        std::size_t target_index_count);
+/**
+ * @brief Build a chain of levels of detail, each level is simplified from the previous one and
+ * reordered for the vertex cache, the chain stops early if a level can't be reduced anymore.
+ * @param indices: Index buffer of the full resolution level (3 indices per triangle).
+ * @param positions: Positions of the vertices.
+ * @param level_count: Maximum number of levels (including the full resolution one).
+ * @param reduction: Ratio of triangles kept from one level to the next.
+ * @return The indices of all the levels and their offsets.
+ */
+LevelOfDetailIndices BuildLevelOfDetailIndices(const std::vector<std::uint32_t>& indices,
+                                               const std::vector<glm::vec3>& positions,
+                                               std::uint32_t level_count, float reduction = 0.5f);
+
+}  // End namespace frame::file.
@@ -0,0 +1,119 @@
+#include "frame/file/mipmap.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace frame::file {
+
+namespace {
+
+float SrgbToLinear(float value) {
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+float LinearToSrgb(float value) {
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+}
+
+const std::array<float, 256>& GetSrgbToLinearTable() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> result = {};
+        for (int i = 0; i < 256; ++i) {
+            result[i] = SrgbToLinear(static_cast<float>(i) / 255.f);
+        }
+        return result;
+    }();
+    return table;
+}
+
+std::uint8_t ToByte(float value) {
+    return static_cast<std::uint8_t>(std::lround(std::clamp(value, 0.f, 1.f) * 255.f));
+}
+
+}  // End namespace.
+
+std::uint32_t GetMipmapCount(glm::uvec2 size) {
+    std::uint32_t count   = 1;
+    std::uint32_t longest = std::max(size.x, size.y);
+    while (longest > 1) {
+        longest >>= 1;
+        ++count;
+    }
+    return count;
+}
+
+std::vector<std::uint8_t> DownsampleLevel(const std::uint8_t* pixels, glm::uvec2 size,
+                                          std::uint32_t channel_count,
+                                          proto::MipmapFilter::Enum filter) {
+    if (channel_count < 1 || channel_count > 4) {
+        throw std::runtime_error(fmt::format("Invalid channel count [{}].", channel_count));
+    }
+    if (filter == proto::MipmapFilter::NORMAL && channel_count < 3) {
+        throw std::runtime_error("Normal maps need at least 3 channels.");
+    }
+    const glm::uvec2 next_size(std::max(size.x / 2, 1u), std::max(size.y / 2, 1u));
+    std::vector<std::uint8_t> next(static_cast<std::size_t>(next_size.x) * next_size.y *
+                                   channel_count);
+    // Alpha (the last channel of GREY_ALPHA and RGB_ALPHA) is never gamma encoded.
+    const std::uint32_t color_count =
+        (channel_count == 2 || channel_count == 4) ? channel_count - 1 : channel_count;
+    const auto& srgb_to_linear = GetSrgbToLinearTable();
+    for (std::uint32_t y = 0; y < next_size.y; ++y) {
+        const std::uint32_t y0 = std::min(y * 2, size.y - 1);
+        const std::uint32_t y1 = std::min(y * 2 + 1, size.y - 1);
+        for (std::uint32_t x = 0; x < next_size.x; ++x) {
+            const std::uint32_t x0 = std::min(x * 2, size.x - 1);
+            const std::uint32_t x1 = std::min(x * 2 + 1, size.x - 1);
+            const std::array<const std::uint8_t*, 4> texels = {
+                pixels + (y0 * size.x + x0) * channel_count,
+                pixels + (y0 * size.x + x1) * channel_count,
+                pixels + (y1 * size.x + x0) * channel_count,
+                pixels + (y1 * size.x + x1) * channel_count,
+            };
+            std::uint8_t* out = next.data() + (y * next_size.x + x) * channel_count;
+            std::uint32_t c   = 0;
+            if (filter == proto::MipmapFilter::SRGB) {
+                for (; c < color_count; ++c) {
+                    float sum = 0.f;
+                    for (const auto* texel : texels) sum += srgb_to_linear[texel[c]];
+                    out[c] = ToByte(LinearToSrgb(sum / 4.f));
+                }
+            } else if (filter == proto::MipmapFilter::NORMAL) {
+                glm::vec3 normal(0.f);
+                for (const auto* texel : texels) {
+                    normal += glm::vec3(texel[0], texel[1], texel[2]) / 127.5f - glm::vec3(1.f);
+                }
+                const float length = glm::length(normal);
+                normal = length > 0.f ? normal / length : glm::vec3(0.f, 0.f, 1.f);
+                for (; c < 3; ++c) out[c] = ToByte((normal[c] + 1.f) * .5f);
+            }
+            for (; c < channel_count; ++c) {
+                const int sum = texels[0][c] + texels[1][c] + texels[2][c] + texels[3][c];
+                out[c]        = static_cast<std::uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+    return next;
+}
+
+std::vector<std::vector<std::uint8_t>> GenerateMipmaps(const std::uint8_t* pixels,
+                                                       glm::uvec2 size,
+                                                       std::uint32_t channel_count,
+                                                       proto::MipmapFilter::Enum filter) {
+    std::vector<std::vector<std::uint8_t>> levels;
+    const std::uint8_t* current = pixels;
+    glm::uvec2 current_size     = size;
+    while (current_size.x > 1 || current_size.y > 1) {
+        levels.push_back(DownsampleLevel(current, current_size, channel_count, filter));
+        current      = levels.back().data();
+        current_size =
+            glm::uvec2(std::max(current_size.x / 2, 1u), std::max(current_size.y / 2, 1u));
+    }
+    return levels;
+}
+
+}  // End namespace frame::file.
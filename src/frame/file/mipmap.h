@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/json/proto.h"
+
+namespace frame::file {
+
+/**
+ * @brief Get the number of levels of a full mip chain (down to 1x1).
+ * @param size: Size of the first level.
+ * @return The number of levels (including the first one).
+ */
+std::uint32_t GetMipmapCount(glm::uvec2 size);
+/**
+ * @brief Halve an image (8 bit per channel) with a box filter.
+ * @param pixels: Pixels of the image (size.x * size.y * channel_count bytes, row major).
+ * @param size: Size of the image.
+ * @param channel_count: Number of channel per pixel (1 to 4).
+ * @param filter: BOX (or GPU) average the values, SRGB average them in linear space (the alpha
+ * stays linear) and NORMAL renormalize the vector stored in the first 3 channels.
+ * @return The pixels of the next level (max(size / 2, 1)).
+ */
+std::vector<std::uint8_t> DownsampleLevel(const std::uint8_t* pixels, glm::uvec2 size,
+                                          std::uint32_t channel_count,
+                                          proto::MipmapFilter::Enum filter);
+/**
+ * @brief Build the mip chain of an image (8 bit per channel) on the CPU.
+ * @param pixels: Pixels of the image (size.x * size.y * channel_count bytes, row major).
+ * @param size: Size of the image.
+ * @param channel_count: Number of channel per pixel (1 to 4).
+ * @param filter: Filter used for every level (see DownsampleLevel).
+ * @return The levels 1 and up (down to 1x1), the first level is not copied.
+ */
+std::vector<std::vector<std::uint8_t>> GenerateMipmaps(const std::uint8_t* pixels,
+                                                       glm::uvec2 size,
+                                                       std::uint32_t channel_count,
+                                                       proto::MipmapFilter::Enum filter);
+
+}  // End namespace frame::file.
@@ -10,7 +10,31 @@
 
 namespace frame::file {
 
-Obj::Obj(const std::filesystem::path& file_name) {
+namespace {
+
+// Weld the vertices, then reorder the triangles (cache and overdraw) and the vertices (fetch).
+MeshOptimizerStats OptimizeMesh(std::vector<ObjVertex>& points, std::vector<int>& indices) {
+    MeshOptimizerStats stats = {};
+    std::vector<std::uint32_t> unsigned_indices(indices.begin(), indices.end());
+    stats.vertex_count_before = points.size();
+    stats.acmr_before         = ComputeAcmr(unsigned_indices, points.size());
+    WeldVertices(points, unsigned_indices);
+    OptimizeVertexCache(unsigned_indices, points.size());
+    std::vector<glm::vec3> positions;
+    positions.reserve(points.size());
+    for (const auto& point : points) positions.push_back(point.point);
+    OptimizeOverdraw(unsigned_indices, positions);
+    const auto remap         = OptimizeVertexFetch(unsigned_indices, points.size());
+    points                   = RemapVertices(points, remap);
+    stats.vertex_count_after = points.size();
+    stats.acmr_after         = ComputeAcmr(unsigned_indices, points.size());
+    indices.assign(unsigned_indices.begin(), unsigned_indices.end());
+    return stats;
+}
+
+}  // End namespace.
+
+Obj::Obj(const std::filesystem::path& file_name, bool optimize /* = false*/) {
 #ifdef TINY_OBJ_LOADER_V2
     tinyobj::ObjReaderConfig reader_config;
     const auto pair               = SplitFileDirectory(file_name);
@@ -110,7 +134,14 @@ Obj::Obj(const std::filesystem::path& file_name) {
                 if (material_id) assert(material_id == shapes[s].mesh.material_ids[f]);
                 material_id = shapes[s].mesh.material_ids[f];
             }
-            ObjMesh mesh(points, indices, material_id);
+            MeshOptimizerStats stats = {};
+            if (optimize) {
+                stats = OptimizeMesh(points, indices);
+                logger_->info("Optimized mesh [{}]: vertices {} -> {}, ACMR {:.3f} -> {:.3f}.",
+                              shapes[s].name, stats.vertex_count_before, stats.vertex_count_after,
+                              stats.acmr_before, stats.acmr_after);
+            }
+            ObjMesh mesh(points, indices, material_id, stats);
             meshes_.push_back(mesh);
         }
     }
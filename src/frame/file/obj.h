@@ -5,6 +5,7 @@
 #include <vector>
 #include <filesystem>
 
+#include "frame/file/mesh_optimizer.h"
 #include "frame/logger.h"
 
 namespace frame::file {
@@ -31,9 +32,14 @@ class ObjMesh {
      * @param indices: Vector of indices as int.
      * @param material: Material id (watch out this is an  internal material not a entity id type of
      * material!).
+     * @param optimizer_stats: Statistics of the optimization (if the mesh was optimized).
      */
-    ObjMesh(std::vector<ObjVertex> points, std::vector<int> indices, int material)
-        : points_(points), indices_(indices), material_(material) {}
+    ObjMesh(std::vector<ObjVertex> points, std::vector<int> indices, int material,
+            MeshOptimizerStats optimizer_stats = {})
+        : points_(points),
+          indices_(indices),
+          material_(material),
+          optimizer_stats_(optimizer_stats) {}
     /**
      * @brief Will return the list of vertices.
      * @return Vector of vertices.
@@ -49,11 +55,17 @@ class ObjMesh {
      * @return An index to the material vector.
      */
     int GetMaterialId() const { return material_; }
+    /**
+     * @brief Get the statistics of the optimization (all 0 if the mesh was not optimized).
+     * @return Vertex counts and ACMR before and after the optimization.
+     */
+    const MeshOptimizerStats& GetOptimizerStats() const { return optimizer_stats_; }
 
    protected:
-    std::vector<ObjVertex> points_ = {};
-    std::vector<int> indices_      = {};
-    int material_                  = -1;
+    std::vector<ObjVertex> points_      = {};
+    std::vector<int> indices_           = {};
+    int material_                       = -1;
+    MeshOptimizerStats optimizer_stats_ = {};
 };
 
 /**
@@ -86,8 +98,10 @@ class Obj {
     /**
      * @brief Constructor parse from an OBJ file.
      * @param file_name: File to be open.
+     * @param optimize: Weld the duplicated vertices and reorder the triangles for the vertex cache
+     * and overdraw (then the vertices for fetch).
      */
-    Obj(const std::filesystem::path& file_name);
+    Obj(const std::filesystem::path& file_name, bool optimize = false);
 
    public:
     /**
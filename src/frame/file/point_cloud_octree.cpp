@@ -0,0 +1,727 @@
+#include "frame/file/point_cloud_octree.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+
+#include "frame/frustum.h"
+
+namespace frame::file {
+
+namespace {
+
+// Layout of the file (little endian):
+//   FileHeader | points of every node | NodeRecord * node_count.
+constexpr std::array<char, 4> file_magic = { 'F', 'R', 'M', 'P' };
+constexpr std::uint32_t file_version     = 1;
+// Number of points read from the PLY file at once.
+constexpr std::size_t read_point_count = 1 << 16;
+// Number of points kept in memory before they are appended to the chunk files.
+constexpr std::size_t flush_point_count = 1 << 20;
+
+struct FileHeader {
+    std::array<char, 4> magic;
+    std::uint32_t version;
+    std::uint64_t point_count;
+    std::uint32_t node_count;
+    std::uint32_t max_node_point_count;
+    std::uint64_t table_offset;
+    float cube_min[3];
+    float cube_size;
+    float spacing;
+    std::uint32_t reserved[3];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader is written as is.");
+
+struct NodeRecord {
+    std::uint32_t level;
+    std::uint32_t cell[3];
+    std::uint32_t point_count;
+    std::uint32_t reserved;
+    std::uint64_t offset;
+};
+static_assert(sizeof(NodeRecord) == 32, "NodeRecord is written as is.");
+
+// Level and cell of a node (ordered by level first).
+using NodeKey = std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>;
+
+NodeKey GetNodeKey(std::uint32_t level, glm::uvec3 cell) {
+    return { level, cell.x, cell.y, cell.z };
+}
+
+enum class PlyTypeEnum : std::uint8_t {
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    FLOAT32,
+    FLOAT64,
+};
+
+struct PlyProperty {
+    std::string name;
+    PlyTypeEnum type;
+    std::uint32_t offset;
+};
+
+PlyTypeEnum GetPlyType(const std::string& type) {
+    if (type == "char" || type == "int8") return PlyTypeEnum::INT8;
+    if (type == "uchar" || type == "uint8") return PlyTypeEnum::UINT8;
+    if (type == "short" || type == "int16") return PlyTypeEnum::INT16;
+    if (type == "ushort" || type == "uint16") return PlyTypeEnum::UINT16;
+    if (type == "int" || type == "int32") return PlyTypeEnum::INT32;
+    if (type == "uint" || type == "uint32") return PlyTypeEnum::UINT32;
+    if (type == "float" || type == "float32") return PlyTypeEnum::FLOAT32;
+    if (type == "double" || type == "float64") return PlyTypeEnum::FLOAT64;
+    throw std::runtime_error(fmt::format("Unknown PLY property type [{}].", type));
+}
+
+std::uint32_t GetPlyTypeSize(PlyTypeEnum type) {
+    switch (type) {
+        case PlyTypeEnum::INT8:
+        case PlyTypeEnum::UINT8:
+            return 1;
+        case PlyTypeEnum::INT16:
+        case PlyTypeEnum::UINT16:
+            return 2;
+        case PlyTypeEnum::INT32:
+        case PlyTypeEnum::UINT32:
+        case PlyTypeEnum::FLOAT32:
+            return 4;
+        case PlyTypeEnum::FLOAT64:
+            return 8;
+    }
+    return 0;
+}
+
+template <typename T>
+double ReadBinary(const char* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return static_cast<double>(value);
+}
+
+double ReadPlyValue(const char* data, PlyTypeEnum type) {
+    switch (type) {
+        case PlyTypeEnum::INT8:
+            return ReadBinary<std::int8_t>(data);
+        case PlyTypeEnum::UINT8:
+            return ReadBinary<std::uint8_t>(data);
+        case PlyTypeEnum::INT16:
+            return ReadBinary<std::int16_t>(data);
+        case PlyTypeEnum::UINT16:
+            return ReadBinary<std::uint16_t>(data);
+        case PlyTypeEnum::INT32:
+            return ReadBinary<std::int32_t>(data);
+        case PlyTypeEnum::UINT32:
+            return ReadBinary<std::uint32_t>(data);
+        case PlyTypeEnum::FLOAT32:
+            return ReadBinary<float>(data);
+        case PlyTypeEnum::FLOAT64:
+            return ReadBinary<double>(data);
+    }
+    return 0.0;
+}
+
+// Color component in [0, 255] from a PLY value (floats are in [0, 1], 16 bit in [0, 65535]).
+std::uint32_t GetColorComponent(double value, PlyTypeEnum type) {
+    if (type == PlyTypeEnum::FLOAT32 || type == PlyTypeEnum::FLOAT64) value *= 255.0;
+    if (type == PlyTypeEnum::UINT16 || type == PlyTypeEnum::INT16) value /= 257.0;
+    return static_cast<std::uint32_t>(std::clamp(value, 0.0, 255.0) + 0.5);
+}
+
+// Read the vertices of a PLY file by batch (the whole file is never in memory), the vertex
+// element has to be the first element of the file.
+class PlyVertexReader {
+   public:
+    explicit PlyVertexReader(const std::filesystem::path& file_name)
+        : ifs_(file_name, std::ios::binary) {
+        if (!ifs_) {
+            throw std::runtime_error(fmt::format("Could not open file [{}].", file_name.string()));
+        }
+        std::string line;
+        std::getline(ifs_, line);
+        if (line.rfind("ply", 0) != 0) {
+            throw std::runtime_error(fmt::format("File [{}] is not a PLY.", file_name.string()));
+        }
+        bool in_vertex    = false;
+        bool found_vertex = false;
+        while (std::getline(ifs_, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            std::istringstream iss(line);
+            std::string keyword;
+            iss >> keyword;
+            if (keyword == "end_header") break;
+            if (keyword == "format") {
+                std::string format;
+                iss >> format;
+                if (format == "ascii") {
+                    ascii_ = true;
+                } else if (format != "binary_little_endian") {
+                    throw std::runtime_error(fmt::format("Unsupported PLY format [{}] in [{}].",
+                                                         format, file_name.string()));
+                }
+            } else if (keyword == "element") {
+                std::string name;
+                iss >> name;
+                in_vertex = name == "vertex";
+                if (in_vertex) {
+                    iss >> vertex_count_;
+                    found_vertex = true;
+                } else if (!found_vertex) {
+                    throw std::runtime_error(fmt::format(
+                        "The vertex should be the first element in [{}].", file_name.string()));
+                }
+            } else if (keyword == "property" && in_vertex) {
+                std::string type;
+                std::string name;
+                iss >> type >> name;
+                if (type == "list") {
+                    throw std::runtime_error(fmt::format(
+                        "Unsupported vertex list property in [{}].", file_name.string()));
+                }
+                const PlyTypeEnum ply_type = GetPlyType(type);
+                properties_.push_back({ name, ply_type, stride_ });
+                stride_ += GetPlyTypeSize(ply_type);
+            }
+        }
+        position_indices_ = { FindProperty({ "x" }), FindProperty({ "y" }), FindProperty({ "z" }) };
+        color_indices_    = { FindProperty({ "red", "r", "diffuse_red" }),
+                              FindProperty({ "green", "g", "diffuse_green" }),
+                              FindProperty({ "blue", "b", "diffuse_blue" }) };
+        if (!found_vertex || position_indices_[0] < 0 || position_indices_[1] < 0 ||
+            position_indices_[2] < 0) {
+            throw std::runtime_error(
+                fmt::format("No vertex position in file [{}].", file_name.string()));
+        }
+        has_color_ = color_indices_[0] >= 0 && color_indices_[1] >= 0 && color_indices_[2] >= 0;
+        data_start_ = ifs_.tellg();
+    }
+
+    std::uint64_t GetVertexCount() const { return vertex_count_; }
+
+    // Go back to the first vertex.
+    void Rewind() {
+        ifs_.clear();
+        ifs_.seekg(data_start_);
+        read_count_ = 0;
+    }
+
+    // Read the next points (at most max_count), return false at the end of the vertices.
+    bool Read(std::vector<PointCloudPoint>& points, std::size_t max_count) {
+        points.clear();
+        const auto count = static_cast<std::size_t>(
+            std::min<std::uint64_t>(max_count, vertex_count_ - read_count_));
+        if (count == 0) return false;
+        std::vector<double> values(properties_.size());
+        if (!ascii_) buffer_.resize(count * stride_);
+        if (!ascii_ && !ifs_.read(buffer_.data(), buffer_.size())) {
+            throw std::runtime_error("Truncated PLY file.");
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t j = 0; j < properties_.size(); ++j) {
+                if (ascii_) {
+                    if (!(ifs_ >> values[j])) throw std::runtime_error("Truncated PLY file.");
+                } else {
+                    values[j] = ReadPlyValue(buffer_.data() + i * stride_ + properties_[j].offset,
+                                             properties_[j].type);
+                }
+            }
+            PointCloudPoint point = {};
+            point.position = glm::vec3(values[position_indices_[0]], values[position_indices_[1]],
+                                       values[position_indices_[2]]);
+            if (has_color_) {
+                point.color = 0xff000000;
+                for (int k = 0; k < 3; ++k) {
+                    const auto& property = properties_[color_indices_[k]];
+                    point.color |= GetColorComponent(values[color_indices_[k]], property.type)
+                                   << (8 * k);
+                }
+            }
+            points.push_back(point);
+        }
+        read_count_ += count;
+        return true;
+    }
+
+   private:
+    int FindProperty(std::initializer_list<const char*> names) const {
+        for (std::size_t i = 0; i < properties_.size(); ++i) {
+            for (const auto* name : names) {
+                if (properties_[i].name == name) return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+   private:
+    std::ifstream ifs_;
+    std::streampos data_start_           = 0;
+    bool ascii_                          = false;
+    std::uint64_t vertex_count_          = 0;
+    std::uint64_t read_count_            = 0;
+    std::vector<PlyProperty> properties_ = {};
+    std::uint32_t stride_                = 0;
+    std::array<int, 3> position_indices_ = { -1, -1, -1 };
+    std::array<int, 3> color_indices_    = { -1, -1, -1 };
+    bool has_color_                      = false;
+    std::vector<char> buffer_            = {};
+};
+
+// Cell of a position in a grid of resolution cells per axis over a cube.
+glm::uvec3 GetCell(glm::vec3 position, glm::vec3 cube_min, float cube_size,
+                   std::uint32_t resolution) {
+    const glm::vec3 cell = (position - cube_min) / cube_size * static_cast<float>(resolution);
+    return glm::uvec3(glm::clamp(glm::ivec3(glm::floor(cell)), glm::ivec3(0),
+                                 glm::ivec3(static_cast<int>(resolution) - 1)));
+}
+
+// Index of a cell in a grid of resolution cells per axis.
+std::size_t GetCellIndex(glm::uvec3 cell, std::uint32_t resolution) {
+    return (static_cast<std::size_t>(cell.z) * resolution + cell.y) * resolution + cell.x;
+}
+
+struct BuildNode {
+    std::uint32_t level                 = 0;
+    glm::uvec3 cell                     = glm::uvec3(0);
+    std::vector<PointCloudPoint> points = {};
+};
+
+struct Chunk {
+    std::uint32_t level = 0;
+    glm::uvec3 cell     = glm::uvec3(0);
+};
+
+// Write the nodes as they are finished and keep the table.
+class OctreeWriter {
+   public:
+    OctreeWriter(const std::filesystem::path& octree_file,
+                 const PointCloudOctreeParameter& parameter, glm::vec3 cube_min, float cube_size)
+        : ofs_(octree_file, std::ios::binary | std::ios::trunc),
+          parameter_(parameter),
+          cube_min_(cube_min),
+          cube_size_(cube_size) {
+        if (!ofs_) {
+            throw std::runtime_error(
+                fmt::format("Could not open file [{}].", octree_file.string()));
+        }
+        // The header is written at the end (when the table is known).
+        const FileHeader header = {};
+        ofs_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        offset_ = sizeof(header);
+    }
+
+    void WriteNode(const BuildNode& node) {
+        NodeRecord record  = {};
+        record.level       = node.level;
+        record.cell[0]     = node.cell.x;
+        record.cell[1]     = node.cell.y;
+        record.cell[2]     = node.cell.z;
+        record.point_count = static_cast<std::uint32_t>(node.points.size());
+        record.offset      = offset_;
+        records_.push_back(record);
+        ofs_.write(reinterpret_cast<const char*>(node.points.data()),
+                   node.points.size() * sizeof(PointCloudPoint));
+        offset_ += node.points.size() * sizeof(PointCloudPoint);
+        point_count_ += node.points.size();
+        max_node_point_count_ = std::max(max_node_point_count_, record.point_count);
+    }
+
+    // Move the points that fall in a free cell of the sampling grid of a node out of the points,
+    // the occupied cells are shared between calls (to sample several children in a parent).
+    std::vector<PointCloudPoint> SamplePoints(std::uint32_t level, glm::uvec3 cell,
+                                              std::vector<PointCloudPoint>& points,
+                                              std::unordered_set<std::uint64_t>& occupied) const {
+        const float node_size    = GetNodeSize(level);
+        const glm::vec3 node_min = cube_min_ + glm::vec3(cell) * node_size;
+        std::vector<PointCloudPoint> sampled;
+        std::size_t kept = 0;
+        for (const auto& point : points) {
+            const glm::uvec3 sample_cell =
+                GetCell(point.position, node_min, node_size, parameter_.sampling_grid_size);
+            if (occupied.insert(GetCellIndex(sample_cell, parameter_.sampling_grid_size)).second) {
+                sampled.push_back(point);
+            } else {
+                points[kept++] = point;
+            }
+        }
+        points.resize(kept);
+        return sampled;
+    }
+
+    // Build the sub tree of a node: the node keeps a sample of the points and the rest is split
+    // between its children (written as soon as they are built), the node itself isn't written.
+    BuildNode BuildSubTree(std::uint32_t level, glm::uvec3 cell,
+                           std::vector<PointCloudPoint> points) {
+        BuildNode node = { level, cell, {} };
+        if (points.size() <= parameter_.max_node_point_count || level >= parameter_.max_level) {
+            node.points = std::move(points);
+            return node;
+        }
+        std::unordered_set<std::uint64_t> occupied;
+        node.points             = SamplePoints(level, cell, points, occupied);
+        const float node_size   = GetNodeSize(level);
+        const glm::vec3 center  = cube_min_ + (glm::vec3(cell) + 0.5f) * node_size;
+        std::array<std::vector<PointCloudPoint>, 8> children;
+        for (const auto& point : points) {
+            const int octant = (point.position.x >= center.x ? 1 : 0) |
+                               (point.position.y >= center.y ? 2 : 0) |
+                               (point.position.z >= center.z ? 4 : 0);
+            children[octant].push_back(point);
+        }
+        points = {};
+        for (std::uint32_t octant = 0; octant < 8; ++octant) {
+            if (children[octant].empty()) continue;
+            const glm::uvec3 child_cell =
+                cell * 2u + glm::uvec3(octant & 1, (octant >> 1) & 1, (octant >> 2) & 1);
+            WriteNode(BuildSubTree(level + 1, child_cell, std::move(children[octant])));
+        }
+        return node;
+    }
+
+    // Write the table and the header.
+    void Finish() {
+        std::sort(records_.begin(), records_.end(),
+                  [](const NodeRecord& left, const NodeRecord& right) {
+                      return std::tie(left.level, left.cell[0], left.cell[1], left.cell[2]) <
+                             std::tie(right.level, right.cell[0], right.cell[1], right.cell[2]);
+                  });
+        ofs_.write(reinterpret_cast<const char*>(records_.data()),
+                   records_.size() * sizeof(NodeRecord));
+        FileHeader header           = {};
+        header.magic                = file_magic;
+        header.version              = file_version;
+        header.point_count          = point_count_;
+        header.node_count           = static_cast<std::uint32_t>(records_.size());
+        header.max_node_point_count = max_node_point_count_;
+        header.table_offset         = offset_;
+        header.cube_min[0]          = cube_min_.x;
+        header.cube_min[1]          = cube_min_.y;
+        header.cube_min[2]          = cube_min_.z;
+        header.cube_size            = cube_size_;
+        header.spacing = cube_size_ / static_cast<float>(parameter_.sampling_grid_size);
+        ofs_.seekp(0);
+        ofs_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!ofs_) throw std::runtime_error("Could not write the octree file.");
+    }
+
+   private:
+    float GetNodeSize(std::uint32_t level) const {
+        return cube_size_ / static_cast<float>(1ull << level);
+    }
+
+   private:
+    std::ofstream ofs_;
+    const PointCloudOctreeParameter& parameter_;
+    glm::vec3 cube_min_                 = glm::vec3(0.0f);
+    float cube_size_                    = 0.0f;
+    std::uint64_t offset_               = 0;
+    std::uint64_t point_count_          = 0;
+    std::uint32_t max_node_point_count_ = 0;
+    std::vector<NodeRecord> records_    = {};
+};
+
+// Split the cloud in chunks of at most max_chunk_point_count points (unless a cell of the
+// counting grid has more) from the counts of the counting grid, and assign every cell of the
+// counting grid to its chunk.
+std::vector<Chunk> ComputeChunks(std::vector<std::uint64_t> counts, std::uint32_t grid_level,
+                                 std::uint64_t max_chunk_point_count,
+                                 std::vector<std::int32_t>& chunk_of_cell) {
+    // Counts of the coarser levels (the last one is the finest).
+    std::vector<std::vector<std::uint64_t>> level_counts(grid_level + 1);
+    level_counts[grid_level] = std::move(counts);
+    for (std::uint32_t level = grid_level; level > 0; --level) {
+        const std::uint32_t resolution = 1u << level;
+        level_counts[level - 1].assign(static_cast<std::size_t>(resolution / 2) * (resolution / 2) *
+                                           (resolution / 2),
+                                       0);
+        for (std::uint32_t z = 0; z < resolution; ++z) {
+            for (std::uint32_t y = 0; y < resolution; ++y) {
+                for (std::uint32_t x = 0; x < resolution; ++x) {
+                    level_counts[level - 1][GetCellIndex(glm::uvec3(x, y, z) / 2u,
+                                                         resolution / 2)] +=
+                        level_counts[level][GetCellIndex(glm::uvec3(x, y, z), resolution)];
+                }
+            }
+        }
+    }
+    const std::uint32_t grid_resolution = 1u << grid_level;
+    chunk_of_cell.assign(level_counts[grid_level].size(), -1);
+    std::vector<Chunk> chunks;
+    std::vector<Chunk> stack = { Chunk{} };
+    while (!stack.empty()) {
+        const Chunk chunk = stack.back();
+        stack.pop_back();
+        const std::uint64_t count =
+            level_counts[chunk.level][GetCellIndex(chunk.cell, 1u << chunk.level)];
+        if (count == 0) continue;
+        if (count > max_chunk_point_count && chunk.level < grid_level) {
+            for (std::uint32_t octant = 0; octant < 8; ++octant) {
+                stack.push_back({ chunk.level + 1, chunk.cell * 2u +
+                                                       glm::uvec3(octant & 1, (octant >> 1) & 1,
+                                                                  (octant >> 2) & 1) });
+            }
+            continue;
+        }
+        // All the cells of the counting grid under the chunk.
+        const std::uint32_t shift = grid_level - chunk.level;
+        const glm::uvec3 first    = chunk.cell << shift;
+        const glm::uvec3 last     = (chunk.cell + 1u) << shift;
+        for (std::uint32_t z = first.z; z < last.z; ++z) {
+            for (std::uint32_t y = first.y; y < last.y; ++y) {
+                for (std::uint32_t x = first.x; x < last.x; ++x) {
+                    chunk_of_cell[GetCellIndex(glm::uvec3(x, y, z), grid_resolution)] =
+                        static_cast<std::int32_t>(chunks.size());
+                }
+            }
+        }
+        chunks.push_back(chunk);
+    }
+    return chunks;
+}
+
+std::filesystem::path GetChunkPath(const std::filesystem::path& octree_file, std::size_t index) {
+    return octree_file.parent_path() /
+           fmt::format("{}.{}.chunk", octree_file.filename().string(), index);
+}
+
+void AppendChunks(const std::filesystem::path& octree_file,
+                  std::vector<std::vector<PointCloudPoint>>& buffers) {
+    for (std::size_t i = 0; i < buffers.size(); ++i) {
+        if (buffers[i].empty()) continue;
+        const auto chunk_path = GetChunkPath(octree_file, i);
+        std::ofstream ofs(chunk_path, std::ios::binary | std::ios::app);
+        ofs.write(reinterpret_cast<const char*>(buffers[i].data()),
+                  buffers[i].size() * sizeof(PointCloudPoint));
+        if (!ofs) {
+            throw std::runtime_error(
+                fmt::format("Could not write chunk file [{}].", chunk_path.string()));
+        }
+        std::vector<PointCloudPoint>().swap(buffers[i]);
+    }
+}
+
+std::vector<PointCloudPoint> ReadChunk(const std::filesystem::path& chunk_path) {
+    std::vector<PointCloudPoint> points(std::filesystem::file_size(chunk_path) /
+                                        sizeof(PointCloudPoint));
+    std::ifstream ifs(chunk_path, std::ios::binary);
+    if (!ifs.read(reinterpret_cast<char*>(points.data()),
+                  points.size() * sizeof(PointCloudPoint))) {
+        throw std::runtime_error(
+            fmt::format("Could not read chunk file [{}].", chunk_path.string()));
+    }
+    return points;
+}
+
+}  // End namespace.
+
+void BuildPointCloudOctree(const std::filesystem::path& ply_file,
+                           const std::filesystem::path& octree_file,
+                           const PointCloudOctreeParameter& parameter /* = {}*/) {
+    if (parameter.sampling_grid_size == 0 || parameter.sampling_grid_size > (1u << 20) ||
+        parameter.counting_grid_level > 10 || parameter.max_level > 30) {
+        throw std::runtime_error("Invalid point cloud octree parameters.");
+    }
+    PlyVertexReader reader(ply_file);
+    if (reader.GetVertexCount() == 0) {
+        throw std::runtime_error(fmt::format("No vertex in file [{}].", ply_file.string()));
+    }
+    std::vector<PointCloudPoint> points;
+    // 1st pass: the cube around the points.
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    while (reader.Read(points, read_point_count)) {
+        for (const auto& point : points) {
+            min = glm::min(min, point.position);
+            max = glm::max(max, point.position);
+        }
+    }
+    const glm::vec3 extent = max - min;
+    float cube_size        = std::max(extent.x, std::max(extent.y, extent.z));
+    if (cube_size <= 0.0f) cube_size = 1.0f;
+    // 2nd pass: count the points in a coarse grid to split the cloud in chunks.
+    const std::uint32_t grid_resolution = 1u << parameter.counting_grid_level;
+    std::vector<std::uint64_t> counts(static_cast<std::size_t>(grid_resolution) *
+                                      grid_resolution * grid_resolution);
+    reader.Rewind();
+    while (reader.Read(points, read_point_count)) {
+        for (const auto& point : points) {
+            ++counts[GetCellIndex(GetCell(point.position, min, cube_size, grid_resolution),
+                                  grid_resolution)];
+        }
+    }
+    std::vector<std::int32_t> chunk_of_cell;
+    const auto chunks = ComputeChunks(std::move(counts), parameter.counting_grid_level,
+                                      parameter.max_chunk_point_count, chunk_of_cell);
+    // 3rd pass: distribute the points in the chunk files.
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        std::filesystem::remove(GetChunkPath(octree_file, i));
+    }
+    std::vector<std::vector<PointCloudPoint>> buffers(chunks.size());
+    std::size_t buffered_count = 0;
+    reader.Rewind();
+    while (reader.Read(points, read_point_count)) {
+        for (const auto& point : points) {
+            const auto cell = GetCell(point.position, min, cube_size, grid_resolution);
+            buffers[chunk_of_cell[GetCellIndex(cell, grid_resolution)]].push_back(point);
+        }
+        buffered_count += points.size();
+        if (buffered_count >= flush_point_count) {
+            AppendChunks(octree_file, buffers);
+            buffered_count = 0;
+        }
+    }
+    AppendChunks(octree_file, buffers);
+    // Build the sub tree of every chunk, only the roots of the chunks stay in memory.
+    OctreeWriter writer(octree_file, parameter, min, cube_size);
+    std::map<NodeKey, BuildNode> pending_nodes;
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        const auto chunk_path = GetChunkPath(octree_file, i);
+        auto chunk_points     = ReadChunk(chunk_path);
+        std::filesystem::remove(chunk_path);
+        auto node = writer.BuildSubTree(chunks[i].level, chunks[i].cell, std::move(chunk_points));
+        pending_nodes.emplace(GetNodeKey(node.level, node.cell), std::move(node));
+    }
+    // Build the levels above the chunks, the points of a parent are sampled from (and removed
+    // from) its children.
+    while (std::get<0>(pending_nodes.rbegin()->first) > 0) {
+        const std::uint32_t level = std::get<0>(pending_nodes.rbegin()->first);
+        auto first                = pending_nodes.lower_bound(GetNodeKey(level, glm::uvec3(0)));
+        std::map<NodeKey, std::vector<BuildNode>> children;
+        for (auto it = first; it != pending_nodes.end(); ++it) {
+            children[GetNodeKey(level - 1, it->second.cell / 2u)].push_back(
+                std::move(it->second));
+        }
+        pending_nodes.erase(first, pending_nodes.end());
+        for (auto& [key, nodes] : children) {
+            BuildNode parent = { level - 1, nodes.front().cell / 2u, {} };
+            std::unordered_set<std::uint64_t> occupied;
+            for (auto& node : nodes) {
+                auto sampled = writer.SamplePoints(parent.level, parent.cell, node.points,
+                                                   occupied);
+                parent.points.insert(parent.points.end(), sampled.begin(), sampled.end());
+                writer.WriteNode(node);
+            }
+            pending_nodes.emplace(key, std::move(parent));
+        }
+    }
+    writer.WriteNode(pending_nodes.begin()->second);
+    writer.Finish();
+}
+
+PointCloudOctree::PointCloudOctree(const std::filesystem::path& file_name)
+    : mapped_file_(file_name) {
+    const std::uint8_t* data = mapped_file_.GetData();
+    const std::size_t size   = mapped_file_.GetSize();
+    FileHeader header        = {};
+    if (size < sizeof(header)) {
+        throw std::runtime_error(fmt::format("File [{}] is too small.", file_name.string()));
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != file_magic || header.version != file_version) {
+        throw std::runtime_error(fmt::format("File [{}] is not a point cloud octree (version {}).",
+                                             file_name.string(), file_version));
+    }
+    if (header.node_count == 0 ||
+        header.table_offset + static_cast<std::uint64_t>(header.node_count) * sizeof(NodeRecord) >
+            size) {
+        throw std::runtime_error(fmt::format("File [{}] is truncated.", file_name.string()));
+    }
+    point_count_             = header.point_count;
+    max_node_point_count_    = header.max_node_point_count;
+    spacing_                 = header.spacing;
+    const glm::vec3 cube_min = glm::vec3(header.cube_min[0], header.cube_min[1],
+                                         header.cube_min[2]);
+    std::map<NodeKey, std::uint32_t> node_indices;
+    for (std::uint32_t i = 0; i < header.node_count; ++i) {
+        NodeRecord record = {};
+        std::memcpy(&record, data + header.table_offset + i * sizeof(NodeRecord), sizeof(record));
+        const std::uint64_t end = record.offset + static_cast<std::uint64_t>(record.point_count) *
+                                                      sizeof(PointCloudPoint);
+        // Only the first node is the root.
+        if (end > header.table_offset || (i == 0) != (record.level == 0)) {
+            throw std::runtime_error(
+                fmt::format("Invalid node {} in file [{}].", i, file_name.string()));
+        }
+        PointCloudNode node      = {};
+        node.level               = record.level;
+        node.cell                = glm::uvec3(record.cell[0], record.cell[1], record.cell[2]);
+        node.point_count         = record.point_count;
+        node.offset              = record.offset;
+        const float node_size    = header.cube_size / static_cast<float>(1ull << node.level);
+        const glm::vec3 node_min = cube_min + glm::vec3(node.cell) * node_size;
+        const glm::vec3 node_max = node_min + node_size;
+        node.bounding_volume     = ComputeBoundingVolume(
+            { node_min.x, node_min.y, node_min.z, node_max.x, node_max.y, node_max.z });
+        if (i > 0) {
+            // The table is sorted by level so the parent is already there.
+            const auto it = node_indices.find(GetNodeKey(node.level - 1, node.cell / 2u));
+            if (it == node_indices.end()) {
+                throw std::runtime_error(
+                    fmt::format("Node {} has no parent in file [{}].", i, file_name.string()));
+            }
+            const glm::uvec3 octant = node.cell % 2u;
+            node.parent             = static_cast<std::int32_t>(it->second);
+            nodes_[it->second].children[octant.x | (octant.y << 1) | (octant.z << 2)] =
+                static_cast<std::int32_t>(i);
+        }
+        node_indices.emplace(GetNodeKey(node.level, node.cell), i);
+        nodes_.push_back(node);
+    }
+}
+
+std::vector<PointCloudPoint> PointCloudOctree::ReadNode(std::uint32_t index) const {
+    const auto& node = nodes_.at(index);
+    std::vector<PointCloudPoint> points(node.point_count);
+    std::memcpy(points.data(), mapped_file_.GetData() + node.offset,
+                points.size() * sizeof(PointCloudPoint));
+    return points;
+}
+
+std::vector<std::uint32_t> PointCloudOctree::SelectNodes(const glm::mat4& projection,
+                                                         const glm::mat4& view,
+                                                         float screen_height,
+                                                         std::uint64_t point_budget,
+                                                         float max_error) const {
+    const Frustum frustum(projection * view);
+    // Distance between the points of a node on the screen in pixels.
+    auto projected_spacing = [&](const PointCloudNode& node) {
+        const float screen_size = ComputeScreenSize(node.bounding_volume, projection, view);
+        return screen_size / node.bounding_volume.radius * GetSpacing(node.level) *
+               screen_height * 0.5f;
+    };
+    std::vector<std::uint32_t> selection;
+    std::priority_queue<std::pair<float, std::uint32_t>> queue;
+    if (frustum.IsVisible(nodes_.front().bounding_volume)) {
+        queue.push({ projected_spacing(nodes_.front()), 0 });
+    }
+    std::uint64_t point_count = 0;
+    while (!queue.empty()) {
+        const auto [error, index] = queue.top();
+        queue.pop();
+        const auto& node = nodes_[index];
+        if (point_count + node.point_count > point_budget) break;
+        point_count += node.point_count;
+        selection.push_back(index);
+        if (error <= max_error) continue;
+        for (const auto child : node.children) {
+            if (child < 0 || !frustum.IsVisible(nodes_[child].bounding_volume)) continue;
+            queue.push({ projected_spacing(nodes_[child]), static_cast<std::uint32_t>(child) });
+        }
+    }
+    return selection;
+}
+
+}  // End namespace frame::file.
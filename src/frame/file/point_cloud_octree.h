@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/bounding_volume.h"
+#include "frame/file/mesh_cache.h"
+
+namespace frame::file {
+
+/**
+ * @class PointCloudPoint
+ * @brief A point as it is stored in the octree file and uploaded to the GPU (16 bytes).
+ */
+struct PointCloudPoint {
+    //! @brief Position of the point.
+    glm::vec3 position = glm::vec3(0.0f);
+    //! @brief Color as RGBA8 (red in the lowest byte).
+    std::uint32_t color = 0xffffffff;
+};
+static_assert(sizeof(PointCloudPoint) == 16, "PointCloudPoint is written as is.");
+
+/**
+ * @class PointCloudOctreeParameter
+ * @brief Parameters of the conversion of a point cloud into an octree.
+ */
+struct PointCloudOctreeParameter {
+    //! @brief A node with more points is split (the sampled nodes can have more).
+    std::uint32_t max_node_point_count = 20000;
+    //! @brief Cells per axis of the grid used to sample the points kept in a node, the spacing of
+    //! the root is the size of the cloud divided by this.
+    std::uint32_t sampling_grid_size = 128;
+    //! @brief Maximum number of points of a chunk (the points loaded in memory at once).
+    std::uint64_t max_chunk_point_count = 10000000;
+    //! @brief Level of the grid counting the points to split the cloud in chunks.
+    std::uint32_t counting_grid_level = 7;
+    //! @brief Deepest level of the octree (nodes at this level are never split).
+    std::uint32_t max_level = 24;
+};
+
+/**
+ * @class PointCloudNode
+ * @brief A node of a point cloud octree, the points of a node are not repeated in its children
+ * (the children add the details).
+ */
+struct PointCloudNode {
+    //! @brief Depth of the node (0 is the root).
+    std::uint32_t level = 0;
+    //! @brief Position of the node in the grid of its level.
+    glm::uvec3 cell = glm::uvec3(0);
+    //! @brief Number of points of the node.
+    std::uint32_t point_count = 0;
+    //! @brief Offset of the points in the file in bytes.
+    std::uint64_t offset = 0;
+    //! @brief Cube of the node.
+    BoundingVolume bounding_volume = {};
+    //! @brief Index of the parent (-1 for the root).
+    std::int32_t parent = -1;
+    //! @brief Index of the children per octant (-1 if there is none).
+    std::array<std::int32_t, 8> children = { -1, -1, -1, -1, -1, -1, -1, -1 };
+};
+
+/**
+ * @brief Convert a PLY point cloud (ascii or binary little endian, x, y, z and optionally red,
+ * green, blue) into a multi resolution octree file, out of core: the file is read in passes and
+ * split in chunks that fit in memory, each chunk is turned into a sub tree and written, and the
+ * upper levels are sampled from the roots of the chunks. Throw std::runtime_error if it fails.
+ * @param ply_file: Source point cloud.
+ * @param octree_file: Octree file (the temporary chunks are written next to it).
+ * @param parameter: Parameters of the conversion.
+ */
+void BuildPointCloudOctree(const std::filesystem::path& ply_file,
+                           const std::filesystem::path& octree_file,
+                           const PointCloudOctreeParameter& parameter = {});
+
+/**
+ * @class PointCloudOctree
+ * @brief An octree file mapped in memory, only the node table is read at construction and the
+ * points of a node are read on demand (from any thread).
+ */
+class PointCloudOctree {
+   public:
+    /**
+     * @brief Constructor map and validate an octree file (throw std::runtime_error if it is not a
+     * valid file).
+     * @param file_name: Octree file (see BuildPointCloudOctree).
+     */
+    explicit PointCloudOctree(const std::filesystem::path& file_name);
+
+   public:
+    /**
+     * @brief Get the nodes, the root is the first one.
+     * @return The nodes of the octree.
+     */
+    const std::vector<PointCloudNode>& GetNodes() const { return nodes_; }
+    /**
+     * @brief Get the number of points in the octree.
+     * @return Number of points.
+     */
+    std::uint64_t GetPointCount() const { return point_count_; }
+    /**
+     * @brief Get the number of points of the biggest node.
+     * @return Maximum number of points in a node.
+     */
+    std::uint32_t GetMaxNodePointCount() const { return max_node_point_count_; }
+    /**
+     * @brief Get the cube around the points.
+     * @return The volume of the root.
+     */
+    const BoundingVolume& GetBoundingVolume() const { return nodes_.front().bounding_volume; }
+    /**
+     * @brief Get the distance between the points of a level.
+     * @param level: Depth in the octree.
+     * @return Minimum distance between the points kept in a node at this level.
+     */
+    float GetSpacing(std::uint32_t level) const {
+        return spacing_ / static_cast<float>(1ull << level);
+    }
+    /**
+     * @brief Read the points of a node (the pages are loaded from the disk by the system).
+     * @param index: Index of the node.
+     * @return The points of the node.
+     */
+    std::vector<PointCloudPoint> ReadNode(std::uint32_t index) const;
+    /**
+     * @brief Select the nodes to be drawn: the nodes are visited by decreasing projected spacing
+     * and refined until the spacing is under the error or the budget is spent, a selected node
+     * always has its parent selected.
+     * @param projection: Projection matrix of the camera.
+     * @param view: View matrix (times model) of the camera.
+     * @param screen_height: Height of the viewport in pixels.
+     * @param point_budget: Maximum number of points selected.
+     * @param max_error: Projected spacing in pixels under which a node isn't refined.
+     * @return The index of the selected nodes (a parent comes before its children).
+     */
+    std::vector<std::uint32_t> SelectNodes(const glm::mat4& projection, const glm::mat4& view,
+                                           float screen_height, std::uint64_t point_budget,
+                                           float max_error) const;
+
+   protected:
+    MappedFile mapped_file_;
+    std::vector<PointCloudNode> nodes_  = {};
+    std::uint64_t point_count_          = 0;
+    std::uint32_t max_node_point_count_ = 0;
+    float spacing_                      = 0.0f;
+};
+
+}  // End namespace frame::file.
@@ -0,0 +1,71 @@
+#include "frame/frustum.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace frame {
+
+Frustum::Frustum(const glm::mat4& view_projection) {
+    // Rows of the matrix (glm is column major).
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; ++i) {
+        rows[i] = glm::vec4(view_projection[0][i], view_projection[1][i], view_projection[2][i],
+                            view_projection[3][i]);
+    }
+    const glm::vec4 planes[6] = {
+        rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+        rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2],
+    };
+    for (std::size_t i = 0; i < plane_count_; ++i) {
+        if (i >= 6) {
+            // Padding planes (0, 0, 0, 1) everything is in front of them.
+            distance_[i] = 1.0f;
+            continue;
+        }
+        const glm::vec4& plane = planes[i];
+        const float length     = glm::length(glm::vec3(plane));
+        const float inverse    = (length > 0.0f) ? 1.0f / length : 0.0f;
+        normal_x_[i]           = plane.x * inverse;
+        normal_y_[i]           = plane.y * inverse;
+        normal_z_[i]           = plane.z * inverse;
+        distance_[i]           = plane.w * inverse;
+    }
+}
+
+glm::vec4 Frustum::GetPlane(int index) const {
+    if (index < 0 || index >= 6) {
+        throw std::runtime_error("Only [0-5] planes in a frustum.");
+    }
+    return glm::vec4(normal_x_[index], normal_y_[index], normal_z_[index], distance_[index]);
+}
+
+bool Frustum::IsVisible(const BoundingVolume& bounding_volume) const {
+    if (!bounding_volume.IsValid()) return true;
+    // The sphere is cheaper and rejects most of the far away volumes.
+    const glm::vec3 center = bounding_volume.center;
+    bool outside           = false;
+    for (std::size_t i = 0; i < plane_count_; ++i) {
+        const float distance = normal_x_[i] * center.x + normal_y_[i] * center.y +
+                               normal_z_[i] * center.z + distance_[i];
+        outside |= distance < -bounding_volume.radius;
+    }
+    if (outside) return false;
+    return IsBoxVisible(bounding_volume.min, bounding_volume.max);
+}
+
+bool Frustum::IsBoxVisible(glm::vec3 min, glm::vec3 max) const {
+    const glm::vec3 center = (min + max) * 0.5f;
+    const glm::vec3 extent = (max - min) * 0.5f;
+    // Distance of the corner the most in front of each plane (center + |normal| . extent).
+    bool outside = false;
+    for (std::size_t i = 0; i < plane_count_; ++i) {
+        const float distance =
+            normal_x_[i] * center.x + normal_y_[i] * center.y + normal_z_[i] * center.z +
+            std::abs(normal_x_[i]) * extent.x + std::abs(normal_y_[i]) * extent.y +
+            std::abs(normal_z_[i]) * extent.z + distance_[i];
+        outside |= distance < 0.0f;
+    }
+    return !outside;
+}
+
+}  // End namespace frame.
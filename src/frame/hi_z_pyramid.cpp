@@ -0,0 +1,104 @@
+#include "frame/hi_z_pyramid.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace frame {
+
+void HiZPyramid::Build(std::vector<float> depths, glm::uvec2 size) {
+    levels_.clear();
+    if (!size.x || !size.y) return;
+    if (depths.size() != static_cast<std::size_t>(size.x) * size.y) {
+        throw std::runtime_error(fmt::format("Depth image size mismatch ({} for {}x{}).",
+                                             depths.size(), size.x, size.y));
+    }
+    levels_.push_back({ size, std::move(depths) });
+    while (size.x > 1 || size.y > 1) {
+        const Level& previous = levels_.back();
+        Level level           = {};
+        level.size            = glm::uvec2(std::max(1u, size.x / 2), std::max(1u, size.y / 2));
+        level.depths.resize(static_cast<std::size_t>(level.size.x) * level.size.y);
+        for (std::uint32_t y = 0; y < level.size.y; ++y) {
+            // With an odd size the last texel also covers the extra row or column.
+            const std::uint32_t y_end = (y + 1 == level.size.y) ? size.y : 2 * y + 2;
+            for (std::uint32_t x = 0; x < level.size.x; ++x) {
+                const std::uint32_t x_end = (x + 1 == level.size.x) ? size.x : 2 * x + 2;
+                float depth               = 0.0f;
+                for (std::uint32_t j = 2 * y; j < y_end; ++j) {
+                    for (std::uint32_t i = 2 * x; i < x_end; ++i) {
+                        depth = std::max(depth, previous.depths[j * size.x + i]);
+                    }
+                }
+                level.depths[y * level.size.x + x] = depth;
+            }
+        }
+        size = level.size;
+        levels_.push_back(std::move(level));
+    }
+}
+
+float HiZPyramid::GetDepth(std::size_t level, glm::uvec2 texel) const {
+    const Level& pyramid_level = levels_.at(level);
+    if (texel.x >= pyramid_level.size.x || texel.y >= pyramid_level.size.y) {
+        throw std::runtime_error(
+            fmt::format("Texel ({}, {}) outside of level {}.", texel.x, texel.y, level));
+    }
+    return pyramid_level.depths[texel.y * pyramid_level.size.x + texel.x];
+}
+
+bool HiZPyramid::IsOccluded(const BoundingVolume& bounding_volume,
+                            const glm::mat4& view_projection) const {
+    if (!IsValid() || !bounding_volume.IsValid()) return false;
+    // Screen rectangle and nearest depth of the 8 corners.
+    glm::vec3 ndc_min(std::numeric_limits<float>::max());
+    glm::vec3 ndc_max(std::numeric_limits<float>::lowest());
+    for (int i = 0; i < 8; ++i) {
+        const glm::vec3 corner((i & 1) ? bounding_volume.max.x : bounding_volume.min.x,
+                               (i & 2) ? bounding_volume.max.y : bounding_volume.min.y,
+                               (i & 4) ? bounding_volume.max.z : bounding_volume.min.z);
+        const glm::vec4 clip = view_projection * glm::vec4(corner, 1.0f);
+        // Crossing the near plane, the rectangle is unbounded.
+        if (clip.w <= std::numeric_limits<float>::epsilon()) return false;
+        const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+        ndc_min             = glm::min(ndc_min, ndc);
+        ndc_max             = glm::max(ndc_max, ndc);
+    }
+    if (ndc_max.x < -1.0f || ndc_min.x > 1.0f || ndc_max.y < -1.0f || ndc_min.y > 1.0f) {
+        return false;
+    }
+    const float nearest_depth = ndc_min.z * 0.5f + 0.5f;
+    if (nearest_depth <= 0.0f) return false;
+    // Rectangle in texels of the first level.
+    const glm::uvec2 size = levels_.front().size;
+    auto to_texel         = [](float ndc, std::uint32_t texel_count) {
+        const float texel = (ndc * 0.5f + 0.5f) * static_cast<float>(texel_count);
+        return static_cast<std::uint32_t>(
+            std::clamp(texel, 0.0f, static_cast<float>(texel_count - 1)));
+    };
+    glm::uvec2 texel_min(to_texel(ndc_min.x, size.x), to_texel(ndc_min.y, size.y));
+    glm::uvec2 texel_max(to_texel(ndc_max.x, size.x), to_texel(ndc_max.y, size.y));
+    // Go up until the rectangle covers at most 2 x 2 texels (the last texel of an odd level
+    // covers 3 texels so the halved index is clamped).
+    std::size_t level = 0;
+    while (level + 1 < levels_.size() &&
+           (texel_max.x - texel_min.x > 1 || texel_max.y - texel_min.y > 1)) {
+        ++level;
+        const glm::uvec2 level_size = levels_[level].size;
+        texel_min                   = glm::uvec2(std::min(texel_min.x / 2, level_size.x - 1),
+                                                 std::min(texel_min.y / 2, level_size.y - 1));
+        texel_max                   = glm::uvec2(std::min(texel_max.x / 2, level_size.x - 1),
+                                                 std::min(texel_max.y / 2, level_size.y - 1));
+    }
+    float farthest_depth = 0.0f;
+    for (std::uint32_t y = texel_min.y; y <= texel_max.y; ++y) {
+        for (std::uint32_t x = texel_min.x; x <= texel_max.x; ++x) {
+            farthest_depth = std::max(farthest_depth, GetDepth(level, glm::uvec2(x, y)));
+        }
+    }
+    return nearest_depth > farthest_depth;
+}
+
+}  // End namespace frame.
@@ -1,5 +1,14 @@
 #include "frame/json/parse_level.h"
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <vector>
+
+#include "frame/file/compressed_image.h"
+#include "frame/file/file_system.h"
+#include "frame/file/image.h"
 #include "frame/json/parse_json.h"
 #include "frame/json/parse_material.h"
 #include "frame/json/parse_program.h"
@@ -7,9 +16,12 @@
 #include "frame/json/parse_texture.h"
 #include "frame/level.h"
 #include "frame/opengl/material.h"
+#include "frame/opengl/program.h"
+#include "frame/opengl/file/load_texture.h"
 #include "frame/opengl/static_mesh.h"
 #include "frame/opengl/texture.h"
 #include "frame/program_interface.h"
+#include "frame/task_pool.h"
 
 namespace frame::proto {
 
@@ -17,12 +29,40 @@ namespace {
 
 struct PreRenderInfos {};
 
+// Image decoded on a worker with its mip chain (if it is built on the CPU).
+struct DecodedImage {
+    std::unique_ptr<frame::file::Image> image;
+    std::vector<std::vector<std::uint8_t>> mip_levels;
+};
+
+using Clock = std::chrono::steady_clock;
+
+// Milliseconds elapsed since start.
+double ElapsedMilliseconds(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Run a task on the pool and add the time it took to the total (in microseconds).
+template <typename F>
+auto SubmitTimed(TaskPool& task_pool, std::atomic<std::int64_t>& total_microseconds, F&& function) {
+    return task_pool.Submit([&total_microseconds, function = std::forward<F>(function)]() {
+        const auto start   = Clock::now();
+        auto result        = function();
+        const auto elapsed = Clock::now() - start;
+        total_microseconds +=
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        return result;
+    });
+}
+
 std::unique_ptr<LevelInterface> LevelProto(glm::uvec2 size, const proto::Level& proto_level) {
     // TODO(anirul): Check we are in OPENGL mode?
-    auto logger = Logger::GetInstance();
-    auto level  = std::make_unique<frame::Level>();
+    auto logger            = Logger::GetInstance();
+    const auto level_start = Clock::now();
+    auto level             = std::make_unique<frame::Level>();
     level->SetName(proto_level.name());
     level->SetDefaultTextureName(proto_level.default_texture_name());
+    level->SetFrameGraphEnabled(proto_level.frame_graph());
 
     // Include the default cube and quad.
     auto cube_id = opengl::CreateCubeStaticMesh(*level.get());
@@ -32,12 +72,71 @@ std::unique_ptr<LevelInterface> LevelProto(glm::uvec2 size, const proto::Level&
     if (quad_id == NullId) throw std::runtime_error("Could not create static quad mesh.");
     level->SetDefaultStaticMeshQuadId(quad_id);
 
+    // Read and decode the files on the workers, only the GL calls stay on this thread (the one
+    // owning the context), the stages below wait for the files they need. What the workers write
+    // to is declared before the pool, so that if a stage throws the pool finishes its tasks before
+    // it is destroyed.
+    std::atomic<std::int64_t> worker_microseconds = { 0 };
+    std::map<std::string, std::future<DecodedImage>> image_futures;
+    std::map<std::string, std::future<std::unique_ptr<frame::file::CompressedImage>>>
+        compressed_image_futures;
+    std::map<std::string, std::future<opengl::file::StaticMeshFile>> mesh_futures;
+    TaskPool task_pool;
+    for (const auto& proto_texture : proto_level.textures()) {
+        // Cube maps are converted from equirectangular with a render pass.
+        if (!proto_texture.has_file_name() || proto_texture.cubemap()) continue;
+        // Block compressed files (DDS, KTX) are uploaded as is.
+        if (frame::file::IsCompressedImageFile(proto_texture.file_name())) {
+            compressed_image_futures.emplace(
+                proto_texture.name(),
+                SubmitTimed(task_pool, worker_microseconds, [proto_texture]() {
+                    return std::make_unique<frame::file::CompressedImage>(
+                        file::FindFile(std::filesystem::path(proto_texture.file_name())));
+                }));
+            continue;
+        }
+        image_futures.emplace(
+            proto_texture.name(),
+            SubmitTimed(task_pool, worker_microseconds, [proto_texture]() {
+                DecodedImage decoded_image = {};
+                decoded_image.image        = std::make_unique<frame::file::Image>(
+                    file::FindFile(std::filesystem::path(proto_texture.file_name())),
+                    proto_texture.pixel_element_size(), proto_texture.pixel_structure());
+                decoded_image.mip_levels = ParseTextureMipmaps(proto_texture, *decoded_image.image);
+                return decoded_image;
+            }));
+    }
+    for (const auto& proto_static_mesh : proto_level.scene_tree().scene_static_meshes()) {
+        // Compiled meshes are already mapped directly from the disk.
+        if (!proto_static_mesh.has_file_name() || proto_static_mesh.compiled()) continue;
+        mesh_futures.emplace(
+            proto_static_mesh.name(),
+            SubmitTimed(task_pool, worker_microseconds, [proto_static_mesh]() {
+                return opengl::file::ReadStaticMeshFile(
+                    file::FindFile("asset/model/" + proto_static_mesh.file_name()),
+                    proto_static_mesh.optimize(), proto_static_mesh.lod_count());
+            }));
+    }
+
     // Load textures from proto.
+    auto stage_start = Clock::now();
     for (const auto& proto_texture : proto_level.textures()) {
-        std::unique_ptr<TextureInterface> texture = ParseBasicTexture(proto_texture, size, *level);
-        EntityId stream_id                        = NullId;
-        EntityId texture_id                       = NullId;
-        std::string texture_name                  = proto_texture.name();
+        std::unique_ptr<TextureInterface> texture = nullptr;
+        auto it                                   = image_futures.find(proto_texture.name());
+        if (it != image_futures.end()) {
+            const auto decoded_image = it->second.get();
+            texture =
+                ParseTextureImage(proto_texture, *decoded_image.image, decoded_image.mip_levels);
+        } else if (compressed_image_futures.count(proto_texture.name())) {
+            texture = opengl::file::LoadTextureFromCompressedImage(
+                *compressed_image_futures.at(proto_texture.name()).get());
+            if (texture) ParseTextureFilters(proto_texture, *texture);
+        } else {
+            texture = ParseBasicTexture(proto_texture, size, *level);
+        }
+        EntityId stream_id       = NullId;
+        EntityId texture_id      = NullId;
+        std::string texture_name = proto_texture.name();
         if (!texture) {
             throw std::runtime_error(
                 fmt::format("Could not load texture: {}", proto_texture.file_name()));
@@ -55,10 +154,21 @@ std::unique_ptr<LevelInterface> LevelProto(glm::uvec2 size, const proto::Level&
     if (!level->GetDefaultOutputTextureId()) {
         throw std::runtime_error("should have a default texture.");
     }
+    const double texture_milliseconds = ElapsedMilliseconds(stage_start);
 
-    // Load programs from proto.
+    // Load programs from proto, all of them are compiled in one batch (in parallel when the
+    // driver supports it).
+    stage_start = Clock::now();
+    std::vector<opengl::ProgramSource> program_sources;
+    program_sources.reserve(proto_level.programs_size());
     for (const auto& proto_program : proto_level.programs()) {
-        auto program = ParseProgramOpenGL(proto_program, *level.get());
+        program_sources.push_back(ParseProgramSourceOpenGL(proto_program));
+    }
+    auto compiled_programs = opengl::CreatePrograms(program_sources);
+    for (int i = 0; i < proto_level.programs_size(); ++i) {
+        const auto& proto_program = proto_level.programs(i);
+        auto program =
+            ParseProgramOpenGL(proto_program, *level.get(), std::move(compiled_programs[i]));
         if (!program) {
             throw std::runtime_error(fmt::format("invalid program: {}", proto_program.name()));
         }
@@ -69,7 +179,10 @@ std::unique_ptr<LevelInterface> LevelProto(glm::uvec2 size, const proto::Level&
         }
     }
 
+    const double program_milliseconds = ElapsedMilliseconds(stage_start);
+
     // Load material from proto.
+    stage_start = Clock::now();
     for (const auto& proto_material : proto_level.materials()) {
         auto maybe_material = ParseMaterialOpenGL(proto_material, *level.get());
         if (!maybe_material) {
@@ -82,11 +195,25 @@ std::unique_ptr<LevelInterface> LevelProto(glm::uvec2 size, const proto::Level&
         }
     }
 
+    const double material_milliseconds = ElapsedMilliseconds(stage_start);
+
     // Load scenes from proto.
-    if (!ParseSceneTreeFile(proto_level.scene_tree(), *level.get())) {
+    stage_start = Clock::now();
+    std::map<std::string, opengl::file::StaticMeshFile> static_mesh_files;
+    for (auto& [name, mesh_future] : mesh_futures) {
+        static_mesh_files.emplace(name, mesh_future.get());
+    }
+    if (!ParseSceneTreeFile(proto_level.scene_tree(), *level.get(), static_mesh_files)) {
         throw std::runtime_error("Could not parse proto scene file.");
     }
     level->SetDefaultCameraName(proto_level.scene_tree().default_camera_name());
+    const double scene_milliseconds = ElapsedMilliseconds(stage_start);
+    logger->info(
+        "Level [{}] loaded in {:.1f}ms (textures {:.1f}ms, programs {:.1f}ms, materials {:.1f}ms, "
+        "scene {:.1f}ms), decoding {:.1f}ms on {} workers.",
+        proto_level.name(), ElapsedMilliseconds(level_start), texture_milliseconds,
+        program_milliseconds, material_milliseconds, scene_milliseconds,
+        worker_microseconds.load() / 1000.0, task_pool.GetThreadCount());
     return level;
 }
 
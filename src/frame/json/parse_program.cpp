@@ -27,6 +27,31 @@ std::unique_ptr<frame::ProgramInterface> ParseProgramOpenGL(const Program& proto
             opengl::file::LoadProgramFromName(proto_program.shader(0), proto_program.shader(0),
                                               proto_program.shader(1), proto_program.shader(2));
     }
+    return ParseProgramOpenGL(proto_program, level, std::move(program));
+}
+
+opengl::ProgramSource ParseProgramSourceOpenGL(const Program& proto_program) {
+    if (proto_program.shader_size() == 1) {
+        return opengl::file::LoadProgramSourceFromName(
+            proto_program.shader(0), proto_program.shader(0), proto_program.shader(0),
+            proto_program.shader(0));
+    } else if (proto_program.shader_size() == 2) {
+        // Use the vertex shader name as the program name.
+        return opengl::file::LoadProgramSourceFromName(
+            proto_program.shader(0), proto_program.shader(0), proto_program.shader(1));
+    } else if (proto_program.shader_size() == 3) {
+        // Use the vertex shader name as the program name.
+        return opengl::file::LoadProgramSourceFromName(
+            proto_program.shader(0), proto_program.shader(0), proto_program.shader(1),
+            proto_program.shader(2));
+    }
+    throw std::runtime_error(fmt::format("Invalid shader count ({}) for program {}.",
+                                         proto_program.shader_size(), proto_program.name()));
+}
+
+std::unique_ptr<frame::ProgramInterface> ParseProgramOpenGL(
+    const Program& proto_program, LevelInterface& level,
+    std::unique_ptr<frame::ProgramInterface> program) {
     if (!program) return nullptr;
     for (const auto& texture_name : proto_program.input_texture_names()) {
         auto maybe_texture_id = level.GetIdFromName(texture_name);
@@ -5,6 +5,7 @@
 
 #include "frame/json/proto.h"
 #include "frame/level_interface.h"
+#include "frame/opengl/program.h"
 #include "frame/program_interface.h"
 
 namespace frame::proto {
@@ -18,4 +19,22 @@ namespace frame::proto {
 std::unique_ptr<ProgramInterface> ParseProgramOpenGL(const frame::proto::Program& proto_program,
                                                      LevelInterface& level);
 
+/**
+ * @brief Read the sources of a program without compiling it (see opengl::CreatePrograms).
+ * @param proto_program: The proto form of the program.
+ * @return The sources of the program (throw std::runtime_error on error).
+ */
+opengl::ProgramSource ParseProgramSourceOpenGL(const frame::proto::Program& proto_program);
+
+/**
+ * @brief Set up an already compiled program from its proto form (textures, scene, parameters).
+ * @param proto_program: The proto form of the program.
+ * @param level: A pointer to a level.
+ * @param program: The compiled program.
+ * @return A unique pointer to a program interface or error.
+ */
+std::unique_ptr<ProgramInterface> ParseProgramOpenGL(const frame::proto::Program& proto_program,
+                                                     LevelInterface& level,
+                                                     std::unique_ptr<ProgramInterface> program);
+
 }  // End namespace frame::proto.
@@ -48,6 +48,17 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
     return static_cast<bool>(maybe_scene_id);
 }
 
+// Set the instance models (if any) declared in the proto to a static mesh node.
+void ParseInstanceMatrices(NodeInterface& node, const SceneStaticMesh& proto_scene_static_mesh) {
+    if (proto_scene_static_mesh.instance_matrices().empty()) return;
+    std::vector<glm::mat4> instance_models;
+    instance_models.reserve(proto_scene_static_mesh.instance_matrices_size());
+    for (const auto& proto_matrix : proto_scene_static_mesh.instance_matrices()) {
+        instance_models.push_back(ParseUniform(proto_matrix));
+    }
+    dynamic_cast<NodeStaticMesh&>(node).SetInstanceModels(std::move(instance_models));
+}
+
 [[nodiscard]] bool ParseSceneStaticMeshClearBuffer(LevelInterface& level,
                                                    const SceneStaticMesh& proto_scene_static_mesh) {
     auto node_interface =
@@ -97,6 +108,7 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
         std::make_unique<NodeStaticMesh>(GetFunctor(level), mesh_id);
     node_interface->SetName(proto_scene_static_mesh.name());
     node_interface->SetParentName(proto_scene_static_mesh.parent());
+    ParseInstanceMatrices(*node_interface, proto_scene_static_mesh);
     auto maybe_scene_id   = level.AddSceneNode(std::move(node_interface));
     auto render_time_enum = proto_scene_static_mesh.render_time_enum();
     level.AddMeshMaterialId(maybe_scene_id, material_id, render_time_enum);
@@ -104,20 +116,34 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
     return true;
 }
 
-[[nodiscard]] bool ParseSceneStaticMeshFileName(LevelInterface& level,
-                                                const SceneStaticMesh& proto_scene_static_mesh) {
-    auto vec_node_mesh_id = opengl::file::LoadStaticMeshesFromFile(
-        level, "asset/model/" + proto_scene_static_mesh.file_name(), proto_scene_static_mesh.name(),
-        proto_scene_static_mesh.material_name());
+[[nodiscard]] bool ParseSceneStaticMeshFileName(
+    LevelInterface& level, const SceneStaticMesh& proto_scene_static_mesh,
+    const std::map<std::string, opengl::file::StaticMeshFile>& static_mesh_files) {
+    std::vector<EntityId> vec_node_mesh_id;
+    auto it = static_mesh_files.find(proto_scene_static_mesh.name());
+    if (it != static_mesh_files.end()) {
+        vec_node_mesh_id = opengl::file::LoadStaticMeshesFromFile(
+            level, it->second, proto_scene_static_mesh.name(),
+            proto_scene_static_mesh.material_name(), proto_scene_static_mesh.interleaved());
+    } else {
+        vec_node_mesh_id = opengl::file::LoadStaticMeshesFromFile(
+            level, "asset/model/" + proto_scene_static_mesh.file_name(),
+            proto_scene_static_mesh.name(), proto_scene_static_mesh.material_name(),
+            proto_scene_static_mesh.interleaved(), proto_scene_static_mesh.optimize(),
+            proto_scene_static_mesh.compiled(), proto_scene_static_mesh.lod_count());
+    }
     if (vec_node_mesh_id.empty()) return false;
     int i = 0;
     for (const auto node_mesh_id : vec_node_mesh_id) {
         auto& node = level.GetSceneNodeFromId(node_mesh_id);
         auto& mesh = level.GetStaticMeshFromId(node.GetLocalMesh());
         mesh.SetRenderPrimitive(proto_scene_static_mesh.render_primitive_enum());
+        mesh.SetLevelOfDetailScreenSizes({ proto_scene_static_mesh.lod_screen_sizes().begin(),
+                                           proto_scene_static_mesh.lod_screen_sizes().end() });
         auto str = fmt::format("{}.{}", proto_scene_static_mesh.name(), i);
         mesh.SetName(str);
         node.SetParentName(proto_scene_static_mesh.parent());
+        ParseInstanceMatrices(node, proto_scene_static_mesh);
         ++i;
     }
     return true;
@@ -172,8 +198,9 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
     return true;
 }
 
-[[nodiscard]] bool ParseSceneStaticMesh(LevelInterface& level,
-                                        const SceneStaticMesh& proto_scene_static_mesh) {
+[[nodiscard]] bool ParseSceneStaticMesh(
+    LevelInterface& level, const SceneStaticMesh& proto_scene_static_mesh,
+    const std::map<std::string, opengl::file::StaticMeshFile>& static_mesh_files) {
     // 1st case this is a clean static mesh node.
     if (proto_scene_static_mesh.has_clean_buffer()) {
         return ParseSceneStaticMeshClearBuffer(level, proto_scene_static_mesh);
@@ -184,7 +211,7 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
     }
     // 3rd case this is a mesh file.
     if (proto_scene_static_mesh.has_file_name()) {
-        return ParseSceneStaticMeshFileName(level, proto_scene_static_mesh);
+        return ParseSceneStaticMeshFileName(level, proto_scene_static_mesh, static_mesh_files);
     }
     // 4th case stream input.
     if (proto_scene_static_mesh.has_multi_plugin()) {
@@ -246,14 +273,16 @@ std::function<NodeInterface*(const std::string& name)> GetFunctor(LevelInterface
 
 }  // End namespace.
 
-[[nodiscard]] bool ParseSceneTreeFile(const SceneTree& proto_scene_tree, LevelInterface& level) {
+[[nodiscard]] bool ParseSceneTreeFile(
+    const SceneTree& proto_scene_tree, LevelInterface& level,
+    const std::map<std::string, opengl::file::StaticMeshFile>& static_mesh_files /* = {}*/) {
     level.SetDefaultCameraName(proto_scene_tree.default_camera_name());
     level.SetDefaultRootSceneNodeName(proto_scene_tree.default_root_name());
     for (const auto& proto_matrix : proto_scene_tree.scene_matrices()) {
         if (!ParseSceneMatrix(level, proto_matrix)) return false;
     }
     for (const auto& proto_static_mesh : proto_scene_tree.scene_static_meshes()) {
-        if (!ParseSceneStaticMesh(level, proto_static_mesh)) return false;
+        if (!ParseSceneStaticMesh(level, proto_static_mesh, static_mesh_files)) return false;
     }
     for (const auto& proto_camera : proto_scene_tree.scene_cameras()) {
         if (!ParseSceneCamera(level, proto_camera)) return false;
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <string>
 
 #include "frame/level_interface.h"
 #include "frame/json/proto.h"
+#include "frame/opengl/file/load_static_mesh.h"
 
 namespace frame::proto {
 
@@ -11,8 +14,12 @@ namespace frame::proto {
  * @brief Parse a proto to a scene tree (platform independent).
  * @param proto_scene_tree: Proto that contain the scene tree.
  * @param level: A pointer to a level.
+ * @param static_mesh_files: Mesh files already read (by static mesh name), the other mesh files
+ * are read while parsing.
  * @return True if success and false if error.
  */
-[[nodiscard]] bool ParseSceneTreeFile(const SceneTree& proto_scene_tree, LevelInterface& level);
+[[nodiscard]] bool ParseSceneTreeFile(
+    const SceneTree& proto_scene_tree, LevelInterface& level,
+    const std::map<std::string, opengl::file::StaticMeshFile>& static_mesh_files = {});
 
 }  // End namespace frame::proto.
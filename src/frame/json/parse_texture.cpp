@@ -1,8 +1,12 @@
 #include "frame/json/parse_texture.h"
 
+#include <algorithm>
 #include <filesystem>
 
+#include "frame/file/compressed_image.h"
 #include "frame/file/file_system.h"
+#include "frame/file/image.h"
+#include "frame/file/mipmap.h"
 #include "frame/opengl/file/load_texture.h"
 #include "frame/opengl/fill.h"
 #include "frame/opengl/texture.h"
@@ -22,10 +26,64 @@ void CheckParameters(const frame::proto::Texture& proto_texture) {
     }
 }
 
+// Storage options shared by the textures created from a proto.
+frame::TextureParameter GetTextureParameter(const frame::proto::Texture& proto_texture) {
+    frame::TextureParameter texture_parameter = {};
+    texture_parameter.pixel_element_size      = proto_texture.pixel_element_size();
+    texture_parameter.pixel_structure         = proto_texture.pixel_structure();
+    texture_parameter.transient               = proto_texture.transient();
+    texture_parameter.mipmap                  = proto_texture.mipmap();
+    texture_parameter.max_anisotropy          = std::max(proto_texture.max_anisotropy(), 1.0f);
+    texture_parameter.immutable               = proto_texture.immutable();
+    return texture_parameter;
+}
+
 }  // End namespace.
 
 namespace frame::proto {
 
+void ParseTextureFilters(const Texture& proto_texture, TextureInterface& texture) {
+    constexpr auto INVALID_TEXTURE = frame::proto::TextureFilter::INVALID;
+    if (proto_texture.min_filter().value() != INVALID_TEXTURE)
+        texture.SetMinFilter(proto_texture.min_filter().value());
+    if (proto_texture.mag_filter().value() != INVALID_TEXTURE)
+        texture.SetMagFilter(proto_texture.mag_filter().value());
+    if (proto_texture.wrap_s().value() != INVALID_TEXTURE)
+        texture.SetWrapS(proto_texture.wrap_s().value());
+    if (proto_texture.wrap_t().value() != INVALID_TEXTURE)
+        texture.SetWrapT(proto_texture.wrap_t().value());
+    if (proto_texture.max_anisotropy() > 1.0f)
+        texture.SetMaxAnisotropy(proto_texture.max_anisotropy());
+}
+
+std::vector<std::vector<std::uint8_t>> ParseTextureMipmaps(const Texture& proto_texture,
+                                                           const ImageInterface& image) {
+    if (!proto_texture.mipmap() ||
+        proto_texture.mipmap_filter().value() == proto::MipmapFilter::GPU ||
+        image.GetPixelElementSize().value() != proto::PixelElementSize::BYTE) {
+        return {};
+    }
+    return file::GenerateMipmaps(static_cast<const std::uint8_t*>(image.Data()), image.GetSize(),
+                                 static_cast<std::uint32_t>(image.GetPixelStructure().value()),
+                                 proto_texture.mipmap_filter().value());
+}
+
+std::unique_ptr<TextureInterface> ParseTextureImage(
+    const Texture& proto_texture, const ImageInterface& image,
+    const std::vector<std::vector<std::uint8_t>>& mip_levels /* = {}*/) {
+    TextureParameter texture_parameter   = GetTextureParameter(proto_texture);
+    texture_parameter.pixel_element_size = image.GetPixelElementSize();
+    texture_parameter.pixel_structure    = image.GetPixelStructure();
+    texture_parameter.size               = image.GetSize();
+    texture_parameter.data_ptr           = const_cast<void*>(image.Data());
+    for (const auto& mip_level : mip_levels) {
+        texture_parameter.mip_data_ptrs.push_back(mip_level.data());
+    }
+    auto texture = std::make_unique<frame::opengl::Texture>(texture_parameter);
+    ParseTextureFilters(proto_texture, *texture);
+    return texture;
+}
+
 std::unique_ptr<frame::TextureInterface> ParseTexture(const Texture& proto_texture,
                                                       glm::uvec2 size) {
     glm::uvec2 texture_size = size;
@@ -40,9 +98,7 @@ std::unique_ptr<frame::TextureInterface> ParseTexture(const Texture& proto_textu
         texture_size.y = proto_texture.size().y();
     }
     std::unique_ptr<TextureInterface> texture = nullptr;
-    TextureParameter texture_parameter        = {};
-    texture_parameter.pixel_element_size      = proto_texture.pixel_element_size();
-    texture_parameter.pixel_structure         = proto_texture.pixel_structure();
+    TextureParameter texture_parameter        = GetTextureParameter(proto_texture);
     texture_parameter.size                    = texture_size;
     if (!proto_texture.pixels().empty()) {
         texture_parameter.data_ptr = (void*)proto_texture.pixels().data();
@@ -50,15 +106,7 @@ std::unique_ptr<frame::TextureInterface> ParseTexture(const Texture& proto_textu
     } else {
         texture = std::make_unique<frame::opengl::Texture>(texture_parameter);
     }
-    constexpr auto INVALID_TEXTURE = frame::proto::TextureFilter::INVALID;
-    if (proto_texture.min_filter().value() != INVALID_TEXTURE)
-        texture->SetMinFilter(proto_texture.min_filter().value());
-    if (proto_texture.mag_filter().value() != INVALID_TEXTURE)
-        texture->SetMagFilter(proto_texture.mag_filter().value());
-    if (proto_texture.wrap_s().value() != INVALID_TEXTURE)
-        texture->SetWrapS(proto_texture.wrap_s().value());
-    if (proto_texture.wrap_t().value() != INVALID_TEXTURE)
-        texture->SetWrapT(proto_texture.wrap_t().value());
+    ParseTextureFilters(proto_texture, *texture);
     return texture;
 }
 
@@ -84,32 +132,32 @@ std::unique_ptr<TextureInterface> ParseCubeMapTexture(const Texture& proto_textu
     texture_parameter.pixel_structure    = proto_texture.pixel_structure();
     texture_parameter.map_type           = TextureTypeEnum::CUBMAP;
     texture_parameter.size               = texture_size;
-    texture                        = std::make_unique<opengl::TextureCubeMap>(texture_parameter);
-    constexpr auto INVALID_TEXTURE = frame::proto::TextureFilter::INVALID;
-    if (proto_texture.min_filter().value() != INVALID_TEXTURE)
-        texture->SetMinFilter(proto_texture.min_filter().value());
-    if (proto_texture.mag_filter().value() != INVALID_TEXTURE)
-        texture->SetMagFilter(proto_texture.mag_filter().value());
-    if (proto_texture.wrap_s().value() != INVALID_TEXTURE)
-        texture->SetWrapS(proto_texture.wrap_s().value());
-    if (proto_texture.wrap_t().value() != INVALID_TEXTURE)
-        texture->SetWrapT(proto_texture.wrap_t().value());
+    texture = std::make_unique<opengl::TextureCubeMap>(texture_parameter);
+    ParseTextureFilters(proto_texture, *texture);
     return texture;
 }
 
 std::unique_ptr<TextureInterface> ParseTextureFile(const proto::Texture& proto_texture) {
-    return opengl::file::LoadTextureFromFile(
-        file::FindFile(std::filesystem::path(proto_texture.file_name())),
-        proto_texture.pixel_element_size(), proto_texture.pixel_structure());
+    const auto path = file::FindFile(std::filesystem::path(proto_texture.file_name()));
+    // Compressed files carry their own mip chain.
+    if (file::IsCompressedImageFile(path)) {
+        auto texture = opengl::file::LoadTextureFromFile(path);
+        if (texture) ParseTextureFilters(proto_texture, *texture);
+        return texture;
+    }
+    file::Image image(path, proto_texture.pixel_element_size(), proto_texture.pixel_structure());
+    return ParseTextureImage(proto_texture, image, ParseTextureMipmaps(proto_texture, image));
 }
 
-std::unique_ptr<TextureInterface> ParseCubeMapTextureFile(const proto::Texture& proto_texture) {
+std::unique_ptr<TextureInterface> ParseCubeMapTextureFile(
+    const proto::Texture& proto_texture, std::uint64_t* source_hash /* = nullptr*/) {
     return opengl::file::LoadCubeMapTextureFromFile(
         file::FindFile(std::filesystem::path(proto_texture.file_name())),
-        proto_texture.pixel_element_size(), proto_texture.pixel_structure());
+        proto_texture.pixel_element_size(), proto_texture.pixel_structure(), source_hash);
 }
 
-std::unique_ptr<TextureInterface> ParseCubeMapTextureFiles(const proto::Texture& proto_texture) {
+std::unique_ptr<TextureInterface> ParseCubeMapTextureFiles(const proto::Texture& proto_texture,
+                                                           std::uint64_t* source_hash) {
     std::array<std::filesystem::path, 6> name_array = {
         file::FindFile(std::filesystem::path(proto_texture.file_names().positive_x())),
         file::FindFile(std::filesystem::path(proto_texture.file_names().negative_x())),
@@ -119,7 +167,7 @@ std::unique_ptr<TextureInterface> ParseCubeMapTextureFiles(const proto::Texture&
         file::FindFile(std::filesystem::path(proto_texture.file_names().negative_z()))
     };
     return opengl::file::LoadCubeMapTextureFromFiles(name_array, proto_texture.pixel_element_size(),
-                                                     proto_texture.pixel_structure());
+                                                     proto_texture.pixel_structure(), source_hash);
 }
 
 std::unique_ptr<frame::TextureInterface> ParseBasicTexture(const proto::Texture& proto_texture,
@@ -131,15 +179,34 @@ std::unique_ptr<frame::TextureInterface> ParseBasicTexture(const proto::Texture&
 
     if (proto_texture.cubemap()) {
         std::unique_ptr<frame::TextureInterface> cube_map;
+        // What is precomputed from the cube map is only cached if it comes from files.
+        std::uint64_t source_hash = 0;
 
         if (proto_texture.has_file_name()) {
-            cube_map = ParseCubeMapTextureFile(proto_texture);
+            cube_map = ParseCubeMapTextureFile(proto_texture, &source_hash);
         } else if (proto_texture.has_file_names()) {
-            cube_map = ParseCubeMapTextureFiles(proto_texture);
+            cube_map = ParseCubeMapTextureFiles(proto_texture, &source_hash);
         } else {
             cube_map = ParseCubeMapTexture(proto_texture, size);
         }
 
+        if (!proto_texture.prefilter().name().empty()) {
+            const auto& proto_prefilter = proto_texture.prefilter();
+            const auto prefilter_id     = level.GetIdFromName(proto_prefilter.name());
+            if (prefilter_id == NullId) {
+                throw std::runtime_error(
+                    "Prefilter map not found. Make sure the prefilter texture is declared before "
+                    "its associated cube map.");
+            }
+            // Defaults match the shaders (MAX_REFLECTION_LOD of 4).
+            const std::uint32_t mip_count =
+                proto_prefilter.mip_count() ? proto_prefilter.mip_count() : 5;
+            const std::uint32_t sample_count =
+                proto_prefilter.sample_count() ? proto_prefilter.sample_count() : 64;
+            cube_map = opengl::FillPrefilterFromCubeMap(level, std::move(cube_map), prefilter_id,
+                                                        mip_count, sample_count, source_hash);
+        }
+
         if (proto_texture.irradiance().empty()) {
             return cube_map;
         }
@@ -152,7 +219,8 @@ std::unique_ptr<frame::TextureInterface> ParseBasicTexture(const proto::Texture&
                     "its associated cube map.");
             }
 
-            return opengl::FillIrradianceFromCubeMap(level, std::move(cube_map), irradiance_id);
+            return opengl::FillIrradianceFromCubeMap(level, std::move(cube_map), irradiance_id,
+                                                     source_hash);
         }
     }
 
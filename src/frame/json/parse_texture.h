@@ -2,7 +2,9 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
+#include "frame/image_interface.h"
 #include "frame/json/proto.h"
 #include "frame/level.h"
 #include "frame/texture_interface.h"
@@ -31,12 +33,40 @@ std::unique_ptr<TextureInterface> ParseCubeMapTexture(const proto::Texture& prot
  * @return A unique pointer to a texture interface.
  */
 std::unique_ptr<TextureInterface> ParseTextureFile(const proto::Texture& proto_texture);
+/**
+ * @brief Build the mip chain of a decoded image on the CPU, this is thread safe and done in the
+ * loading workers (only for 8 bit images with a CPU mipmap filter).
+ * @param proto_texture: the input proto (mipmap and mipmap_filter).
+ * @param image: The decoded image.
+ * @return The levels 1 and up, empty if the chain has to be generated on the GPU.
+ */
+std::vector<std::vector<std::uint8_t>> ParseTextureMipmaps(const proto::Texture& proto_texture,
+                                                           const ImageInterface& image);
+/**
+ * @brief Parse a texture from an already decoded image.
+ * @param proto_texture: the input proto.
+ * @param image: The decoded image (see file::Image).
+ * @param mip_levels: Levels built on the CPU (see ParseTextureMipmaps).
+ * @return A unique pointer to a texture interface.
+ */
+std::unique_ptr<TextureInterface> ParseTextureImage(
+    const proto::Texture& proto_texture, const ImageInterface& image,
+    const std::vector<std::vector<std::uint8_t>>& mip_levels = {});
+/**
+ * @brief Set the filters, the wrapping and the anisotropy from the proto to a texture.
+ * @param proto_texture: the input proto.
+ * @param texture: The texture to be set.
+ */
+void ParseTextureFilters(const proto::Texture& proto_texture, TextureInterface& texture);
 /**
  * @brief Parse a cube map texture from a file.
  * @param proto_texture: proto for the texture.
+ * @param source_hash[out]: If not null receive the hash of what the cube map is made from (see
+ * LoadCubeMapTextureFromFile).
  * @return A unique pointer to a texture interface.
  */
-std::unique_ptr<TextureInterface> ParseCubeMapTextureFile(const proto::Texture& proto_texture);
+std::unique_ptr<TextureInterface> ParseCubeMapTextureFile(const proto::Texture& proto_texture,
+                                                          std::uint64_t* source_hash = nullptr);
 /**
  * @brief Parse a basic texture from a proto and a size.
  * @param proto_texture: proto for the texture.
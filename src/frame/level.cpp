@@ -5,12 +5,13 @@
 
 #include "frame/device_interface.h"
 #include "frame/node_camera.h"
+#include "frame/node_static_mesh.h"
 
 namespace frame {
 
 Level::~Level() {
     // This has to be deleted first (it has reference to buffers).
-    id_static_mesh_map_.clear();
+    static_meshes_.Clear();
 }
 
 EntityId Level::GetDefaultStaticMeshQuadId() const {
@@ -44,7 +45,7 @@ EntityId Level::GetIdFromName(const std::string& name) const {
 
 std::optional<std::string> Level::GetNameFromId(EntityId id) const {
     try {
-        return id_name_map_.at(id);
+        return entity_names_.At(id);
     } catch (std::out_of_range& ex) {
         logger_->warn(ex.what());
         return std::nullopt;
@@ -57,10 +58,12 @@ EntityId Level::AddSceneNode(std::unique_ptr<NodeInterface>&& scene_node) {
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
     string_set_.insert(name);
-    id_scene_node_map_.insert({ id, std::move(scene_node) });
-    id_name_map_.insert({ id, name });
+    scene_nodes_.Insert(id, std::move(scene_node));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::NODE });
+    entity_types_.Insert(id, EntityTypeEnum::NODE);
+    scene_graph_need_build_ = true;
+    bvh_need_build_         = true;
     return id;
 }
 
@@ -70,10 +73,10 @@ EntityId Level::AddTexture(std::unique_ptr<TextureInterface>&& texture) {
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
     string_set_.insert(name);
-    id_texture_map_.insert({ id, std::move(texture) });
-    id_name_map_.insert({ id, name });
+    textures_.Insert(id, std::move(texture));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::TEXTURE });
+    entity_types_.Insert(id, EntityTypeEnum::TEXTURE);
     return id;
 }
 
@@ -82,10 +85,10 @@ EntityId Level::AddProgram(std::unique_ptr<ProgramInterface>&& program) {
     std::string name = program->GetName();
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
-    id_program_map_.insert({ id, std::move(program) });
-    id_name_map_.insert({ id, name });
+    programs_.Insert(id, std::move(program));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::PROGRAM });
+    entity_types_.Insert(id, EntityTypeEnum::PROGRAM);
     return id;
 }
 
@@ -94,10 +97,10 @@ EntityId Level::AddMaterial(std::unique_ptr<MaterialInterface>&& material) {
     std::string name = material->GetName();
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
-    id_material_map_.insert({ id, std::move(material) });
-    id_name_map_.insert({ id, name });
+    materials_.Insert(id, std::move(material));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::MATERIAL });
+    entity_types_.Insert(id, EntityTypeEnum::MATERIAL);
     return id;
 }
 
@@ -106,22 +109,23 @@ EntityId Level::AddBuffer(std::unique_ptr<BufferInterface>&& buffer) {
     std::string name = buffer->GetName();
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
-    id_buffer_map_.insert({ id, std::move(buffer) });
-    id_name_map_.insert({ id, name });
+    buffers_.Insert(id, std::move(buffer));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::BUFFER });
+    entity_types_.Insert(id, EntityTypeEnum::BUFFER);
     return id;
 }
 
 void Level::RemoveBuffer(EntityId buffer_id) {
-    if (!id_buffer_map_.count(buffer_id)) {
+    if (!buffers_.Contains(buffer_id)) {
         throw std::runtime_error(fmt::format("No buffer with id #{}.", buffer_id));
     }
-    std::string name = id_name_map_.at(buffer_id);
-    id_buffer_map_.erase(buffer_id);
-    id_name_map_.erase(buffer_id);
+    std::string name = entity_names_.At(buffer_id);
+    buffers_.Erase(buffer_id);
+    entity_names_.Erase(buffer_id);
     name_id_map_.erase(name);
-    id_enum_map_.erase(buffer_id);
+    entity_types_.Erase(buffer_id);
+    id_allocator_.Free(buffer_id);
 }
 
 EntityId Level::AddStaticMesh(std::unique_ptr<StaticMeshInterface>&& static_mesh) {
@@ -130,57 +134,143 @@ EntityId Level::AddStaticMesh(std::unique_ptr<StaticMeshInterface>&& static_mesh
     // CHECKME(anirul): maybe this should return std::nullopt.
     if (string_set_.count(name)) throw std::runtime_error("Name: " + name + " is already in!");
     string_set_.insert(name);
-    id_static_mesh_map_.insert({ id, std::move(static_mesh) });
-    id_name_map_.insert({ id, name });
+    static_meshes_.Insert(id, std::move(static_mesh));
+    entity_names_.Insert(id, name);
     name_id_map_.insert({ name, id });
-    id_enum_map_.insert({ id, EntityTypeEnum::STATIC_MESH });
+    entity_types_.Insert(id, EntityTypeEnum::STATIC_MESH);
     return id;
 }
 
 std::optional<std::vector<frame::EntityId>> Level::GetChildList(EntityId id) const {
-    std::vector<EntityId> list;
-    try {
-        const auto& node = id_scene_node_map_.at(id);
-        // Check who has node as a parent.
-        for (const auto& id_node : id_scene_node_map_) {
-            // In case this is node then add it to the list.
-            if (id_node.second->GetParentName() == node->GetName()) {
-                list.push_back(id_node.first);
-            }
-        }
-    } catch (std::out_of_range& ex) {
-        logger_->warn(ex.what());
+    const auto& scene_graph = GetSceneGraph();
+    if (!scene_graph.HasNode(id)) {
+        logger_->warn("No scene node with id #{}.", id);
         return std::nullopt;
     }
-    return list;
+    return scene_graph.GetChildList(id);
 }
 
 EntityId Level::GetParentId(EntityId id) const {
-    try {
-        std::string name = id_scene_node_map_.at(id)->GetParentName();
-        auto maybe_id    = GetIdFromName(name);
-        return maybe_id;
-    } catch (std::out_of_range& ex) {
-        logger_->warn(ex.what());
+    const auto& scene_graph = GetSceneGraph();
+    if (!scene_graph.HasNode(id)) {
+        logger_->warn("No scene node with id #{}.", id);
         return NullId;
     }
+    return scene_graph.GetParentId(id);
+}
+
+void Level::UpdateWorldModels(double dt) {
+    latest_update_time_ = dt;
+    GetSceneGraph();
+    if (!scene_graph_.Update(dt) || bvh_need_build_) return;
+    // Refit the hierarchy only along the paths of the nodes that moved.
+    for (const EntityId id : scene_graph_.GetUpdatedIds()) {
+        if (!bvh_.Contains(id)) continue;
+        const BoundingVolume bounding_volume = ComputeWorldBoundingVolume(id);
+        world_bounding_volumes_[id]          = bounding_volume;
+        bvh_.Update(id, bounding_volume);
+    }
+}
+
+glm::mat4 Level::GetWorldModelFromId(EntityId id) const {
+    return GetSceneGraph().GetWorldModel(id);
+}
+
+BoundingVolume Level::GetWorldBoundingVolumeFromId(EntityId id) const {
+    GetBvh();
+    auto it = world_bounding_volumes_.find(id);
+    if (it == world_bounding_volumes_.end()) return {};
+    return it->second;
+}
+
+std::vector<EntityId> Level::GetNodesInFrustum(const Frustum& frustum) const {
+    return GetBvh().QueryFrustum(frustum);
+}
+
+std::vector<EntityId> Level::GetNodesInBox(glm::vec3 min, glm::vec3 max) const {
+    return GetBvh().QueryBox(min, max);
+}
+
+EntityId Level::PickNode(glm::vec3 origin, glm::vec3 direction) const {
+    return GetBvh().Raycast(origin, direction).id;
+}
+
+const Bvh& Level::GetBvh() const {
+    // Build the scene graph first as it also set the flag.
+    GetSceneGraph();
+    if (!bvh_need_build_) return bvh_;
+    std::vector<std::pair<EntityId, BoundingVolume>> items;
+    world_bounding_volumes_.clear();
+    for (const EntityId id : scene_nodes_.GetIds()) {
+        const BoundingVolume bounding_volume = ComputeWorldBoundingVolume(id);
+        if (!bounding_volume.IsValid()) continue;
+        world_bounding_volumes_.insert({ id, bounding_volume });
+        items.push_back({ id, bounding_volume });
+    }
+    bvh_.Build(items);
+    logger_->info("Built the bounding volume hierarchy over {} nodes (depth {}).", bvh_.GetSize(),
+                  bvh_.GetDepth());
+    bvh_need_build_ = false;
+    return bvh_;
 }
 
-std::vector<frame::EntityId> Level::GetAllTextures() const {
-    std::vector<EntityId> list;
-    for (const auto& id_texture : id_texture_map_) {
-        list.push_back(id_texture.first);
+BoundingVolume Level::ComputeWorldBoundingVolume(EntityId id) const {
+    const auto& node       = scene_nodes_.At(id);
+    const EntityId mesh_id = node->GetLocalMesh();
+    if (!mesh_id || !static_meshes_.Contains(mesh_id)) return {};
+    const auto& bounding_volume = static_meshes_.At(mesh_id)->GetBoundingVolume();
+    if (!bounding_volume.IsValid()) return {};
+    const glm::mat4& model = scene_graph_.GetWorldModel(id);
+    auto* node_static_mesh = dynamic_cast<const NodeStaticMesh*>(node.get());
+    if (!node_static_mesh || node_static_mesh->GetInstanceModels().empty()) {
+        return TransformBoundingVolume(bounding_volume, model);
     }
-    return list;
+    BoundingVolume world_bounding_volume = {};
+    for (const auto& instance_model : node_static_mesh->GetInstanceModels()) {
+        const BoundingVolume instance =
+            TransformBoundingVolume(bounding_volume, model * instance_model);
+        world_bounding_volume = MergeBoundingVolume(world_bounding_volume, instance);
+    }
+    return world_bounding_volume;
+}
+
+const SceneGraph& Level::GetSceneGraph() const {
+    if (!scene_graph_need_build_) return scene_graph_;
+    // Resolve the parent names once.
+    std::vector<std::tuple<EntityId, EntityId, const NodeInterface*>> nodes;
+    nodes.reserve(scene_nodes_.Size());
+    for (std::size_t i = 0; i < scene_nodes_.Size(); ++i) {
+        const EntityId id  = scene_nodes_.GetIds()[i];
+        const auto& node   = scene_nodes_.GetValues()[i];
+        EntityId parent_id = NullId;
+        if (!node->IsRoot()) {
+            auto it = name_id_map_.find(node->GetParentName());
+            if (it == name_id_map_.end() || !scene_nodes_.Contains(it->second)) {
+                throw std::runtime_error(fmt::format("No parent node {} for node {}.",
+                                                     node->GetParentName(), node->GetName()));
+            }
+            parent_id = it->second;
+        }
+        nodes.push_back({ id, parent_id, node.get() });
+    }
+    scene_graph_.Build(nodes);
+    scene_graph_.Update(latest_update_time_);
+    scene_graph_need_build_ = false;
+    return scene_graph_;
 }
 
+std::vector<frame::EntityId> Level::GetAllTextures() const { return textures_.GetIds(); }
+
 std::unique_ptr<frame::TextureInterface> Level::ExtractTexture(EntityId id) {
-    auto node_texture = id_texture_map_.extract(id);
-    auto node_name    = id_name_map_.extract(id);
-    auto node_id      = name_id_map_.extract(node_name.mapped());
-    auto node_enum    = id_enum_map_.extract(id);
-    string_set_.extract(node_name.mapped());
-    return std::move(node_texture.mapped());
+    auto texture     = std::move(textures_.At(id));
+    std::string name = entity_names_.At(id);
+    textures_.Erase(id);
+    entity_names_.Erase(id);
+    name_id_map_.erase(name);
+    entity_types_.Erase(id);
+    string_set_.erase(name);
+    id_allocator_.Free(id);
+    return texture;
 }
 
 frame::Camera& Level::GetDefaultCamera() {
@@ -193,21 +283,21 @@ frame::Camera& Level::GetDefaultCamera() {
 
 void Level::ReplaceTexture(std::vector<std::uint8_t>&& vector, glm::uvec2 size,
                            std::uint8_t bytes_per_pixel, EntityId id) {
-    if (!id_texture_map_.count(id))
+    if (!textures_.Contains(id))
         throw std::runtime_error("trying to replace {} but no texture there yet?");
-    auto& texture = id_texture_map_.at(id);
+    auto& texture = textures_.At(id);
     if (!texture)
         throw std::runtime_error(fmt::format("Invalid texture tried to be updated {}.", id));
     texture->Update(std::move(vector), size, bytes_per_pixel);
 }
 
 void Level::ReplaceMesh(std::unique_ptr<StaticMeshInterface>&& mesh, EntityId id) {
-    if (!id_static_mesh_map_.count(id)) {
+    if (!static_meshes_.Contains(id)) {
         throw std::runtime_error(
             fmt::format("trying to replace {} by {} but no mesh there yet?", mesh->GetName(), id));
     }
-    id_static_mesh_map_.erase(id);
-    id_static_mesh_map_.emplace(id, std::move(mesh));
+    static_meshes_.At(id) = std::move(mesh);
+    bvh_need_build_       = true;
 }
 
 }  // End namespace frame.
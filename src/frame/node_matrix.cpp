@@ -18,20 +18,26 @@ glm::mat4 NodeMatrix::GetLocalModel(const double dt) const {
     return ComputeLocalRotation(dt);
 }
 
-// FIXME(anirul): Find a better way.
 glm::mat4 NodeMatrix::ComputeLocalRotation(const double dt) const {
     if (matrix_ == glm::mat4(1.0f) || !enable_rotation_) return matrix_;
+    // Reconvert from angle / axis to quaternion.
+    glm::quat present_rotation = glm::angleAxis(angle_rad_ * static_cast<float>(dt), axis_);
+    return glm::toMat4(present_rotation);
+}
+
+void NodeMatrix::ComputeAxisAngle() {
     glm::quat rotation = glm::quat_cast(matrix_);
-    // should decode the angle and recode it.
     float normal =
         std::sqrt(rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z);
-    float angle_rad = 2.0f * std::atan2(normal, rotation.w);
-    glm::vec3 axis  = glm::vec3(rotation.x / normal, rotation.y / normal, rotation.z / normal);
-    // Reconvert from angle / axis to quaternion.
-    glm::quat present_rotation =
-        glm::angleAxis(angle_rad * static_cast<float>(dt), glm::normalize(axis));
-    glm::mat4 result_matrix = glm::toMat4(present_rotation);
-    return result_matrix;
+    // No rotation (the axis is meaningless).
+    if (normal == 0.0f) {
+        axis_      = glm::vec3(0.f, 0.f, 1.f);
+        angle_rad_ = 0.f;
+        return;
+    }
+    angle_rad_ = 2.0f * std::atan2(normal, rotation.w);
+    axis_      = glm::normalize(
+        glm::vec3(rotation.x / normal, rotation.y / normal, rotation.z / normal));
 }
 
 }  // End namespace frame.
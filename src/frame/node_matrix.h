@@ -31,7 +31,9 @@ class NodeMatrix : public NodeInterface {
      * a mat4 at creation).
      */
     NodeMatrix(std::function<NodeInterface*(const std::string&)> func, glm::quat quat)
-        : NodeInterface(func), matrix_(glm::toMat4(quat)), enable_rotation_(true) {}
+        : NodeInterface(func), matrix_(glm::toMat4(quat)), enable_rotation_(true) {
+        ComputeAxisAngle();
+    }
     /**
      * @brief Constructor with a matrix mat4 entry.
      * @param matrix: A matrix in mat4 format that represent a transform for this point.
@@ -47,7 +49,9 @@ class NodeMatrix : public NodeInterface {
     NodeMatrix(glm::quat quat)
         : NodeInterface([](std::string) { return nullptr; }),
           matrix_(glm::toMat4(quat)),
-          enable_rotation_(true) {}
+          enable_rotation_(true) {
+        ComputeAxisAngle();
+    }
     //! @brief Virtual destructor.
     ~NodeMatrix() override = default;
 
@@ -59,13 +63,22 @@ class NodeMatrix : public NodeInterface {
      * @return A mat4 representing the local model matrix.
      */
     glm::mat4 GetLocalModel(const double dt) const override;
+    /**
+     * @brief Compute the transform relative to the parent.
+     * @param dt: Delta time from the beginning of the software running in seconds.
+     * @return A mat4 representing the transform relative to the parent.
+     */
+    glm::mat4 GetLocalTransform(const double dt) const override { return ComputeLocalRotation(dt); }
 
    public:
     /**
 	* @brief Set local matrix (could be used if you want to move something around).
 	* @param matrix: The new matrix.
 	*/
-    void SetMatrix(glm::mat4 matrix) { matrix_ = matrix; }
+    void SetMatrix(glm::mat4 matrix) {
+        matrix_ = matrix;
+        ComputeAxisAngle();
+    }
 
    protected:
     /**
@@ -73,11 +86,15 @@ class NodeMatrix : public NodeInterface {
 	 * @param dt: Delta time from software start in second.
      */
     glm::mat4 ComputeLocalRotation(const double dt) const;
+    //! @brief Decompose the rotation matrix into an axis and an angle (done once, not per frame).
+    void ComputeAxisAngle();
 
    private:
     glm::mat4 matrix_         = glm::mat4(1.f);
     bool enable_rotation_     = false;
     std::uint32_t clear_flags = 0;
+    glm::vec3 axis_           = glm::vec3(0.f, 0.f, 1.f);
+    float angle_rad_          = 0.f;
 };
 
 }  // End namespace frame.
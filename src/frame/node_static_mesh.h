@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "frame/node_interface.h"
 
@@ -54,10 +55,24 @@ class NodeStaticMesh : public NodeInterface {
      * @return Clean buffer.
      */
     std::uint32_t GetCleanBuffer() { return clean_buffer_; }
+    /**
+     * @brief Set the instance models, the mesh will be drawn once per matrix (relative to the local
+     * model of the node).
+     * @param instance_models: Vector of instance models.
+     */
+    void SetInstanceModels(std::vector<glm::mat4> instance_models) {
+        instance_models_ = std::move(instance_models);
+    }
+    /**
+     * @brief Get the instance models (empty if this is a single mesh).
+     * @return Vector of instance models.
+     */
+    const std::vector<glm::mat4>& GetInstanceModels() const { return instance_models_; }
 
    private:
-    EntityId static_mesh_id_    = NullId;
-    std::uint32_t clean_buffer_ = {};
+    EntityId static_mesh_id_                = NullId;
+    std::uint32_t clean_buffer_             = {};
+    std::vector<glm::mat4> instance_models_ = {};
 };
 
 }  // End namespace frame.
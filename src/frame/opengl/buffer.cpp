@@ -1,14 +1,22 @@
 #include "buffer.h"
 
+#include <fmt/core.h>
+
 #include <exception>
 #include <stdexcept>
 
+#include "frame/opengl/pixel.h"
+
 namespace frame::opengl {
 
 Buffer::Buffer(const BufferTypeEnum buffer_type /*= BufferTypeEnum::ARRAY_BUFFER*/,
                const BufferUsageEnum buffer_usage /*= BufferUsageEnum::STATIC_DRAW*/)
     : buffer_type_(buffer_type), buffer_usage_(buffer_usage) {
-    glGenBuffers(1, &buffer_object_);
+    if (IsDirectStateAccessSupported()) {
+        glCreateBuffers(1, &buffer_object_);
+    } else {
+        glGenBuffers(1, &buffer_object_);
+    }
 }
 
 Buffer::~Buffer() { glDeleteBuffers(1, &buffer_object_); }
@@ -24,42 +32,74 @@ void Buffer::UnBind() const {
 }
 
 void Buffer::Copy(const std::size_t size, const void* data /*= nullptr*/) const {
-    Bind();
-    glBufferData(static_cast<GLenum>(buffer_type_), size, data, static_cast<GLenum>(buffer_usage_));
-    UnBind();
+    if (!IsDirectStateAccessSupported()) {
+        Bind();
+        glBufferData(static_cast<GLenum>(buffer_type_), size, data,
+                     static_cast<GLenum>(buffer_usage_));
+        UnBind();
+        return;
+    }
+    // Static buffers get an immutable storage, the next copies have to keep the same size.
+    if (immutable_size_) {
+        if (size != immutable_size_) {
+            throw std::runtime_error(
+                fmt::format("Cannot resize the immutable buffer [{}] from {} to {} bytes.", name_,
+                            immutable_size_, size));
+        }
+        if (data) glNamedBufferSubData(buffer_object_, 0, size, data);
+        return;
+    }
+    const bool is_static = buffer_usage_ == BufferUsageEnum::STATIC_DRAW ||
+                           buffer_usage_ == BufferUsageEnum::STATIC_READ ||
+                           buffer_usage_ == BufferUsageEnum::STATIC_COPY;
+    if (is_static && size) {
+        glNamedBufferStorage(buffer_object_, size, data, GL_DYNAMIC_STORAGE_BIT);
+        immutable_size_ = size;
+        return;
+    }
+    glNamedBufferData(buffer_object_, size, data, static_cast<GLenum>(buffer_usage_));
 }
 
 void Buffer::Copy(const std::vector<float>& vector) const {
-    Bind();
-    glBufferData(static_cast<GLenum>(buffer_type_), vector.size() * sizeof(float), vector.data(),
-                 static_cast<GLenum>(buffer_usage_));
-    UnBind();
+    Copy(vector.size() * sizeof(float), vector.data());
 }
 
 void Buffer::Copy(const std::vector<unsigned int>& vector) const {
-    Bind();
-    glBufferData(static_cast<GLenum>(buffer_type_), vector.size() * sizeof(unsigned int),
-                 vector.data(), static_cast<GLenum>(buffer_usage_));
-    UnBind();
+    Copy(vector.size() * sizeof(unsigned int), vector.data());
 }
 
 void Buffer::Copy(const std::vector<std::uint8_t>& vector) const {
-    Bind();
-    glBufferData(static_cast<GLenum>(buffer_type_), vector.size() * sizeof(std::uint8_t),
-                 vector.data(), static_cast<GLenum>(buffer_usage_));
-    UnBind();
+    Copy(vector.size() * sizeof(std::uint8_t), vector.data());
+}
+
+void Buffer::Update(std::size_t offset, std::size_t size, const void* data) const {
+    if (IsDirectStateAccessSupported()) {
+        glNamedBufferSubData(buffer_object_, offset, size, data);
+        return;
+    }
+    // The copy write target isn't part of the vertex array state.
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer_object_);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
 }
 
 std::size_t Buffer::GetSize() const {
-    std::size_t size[1] = { 0 };
+    GLint size = 0;
+    if (IsDirectStateAccessSupported()) {
+        glGetNamedBufferParameteriv(buffer_object_, GL_BUFFER_SIZE, &size);
+        return static_cast<std::size_t>(size);
+    }
     Bind();
-    glGetBufferParameteriv(static_cast<GLenum>(buffer_type_), GL_BUFFER_SIZE,
-                           reinterpret_cast<GLint*>(&size));
+    glGetBufferParameteriv(static_cast<GLenum>(buffer_type_), GL_BUFFER_SIZE, &size);
     UnBind();
-    return size[0];
+    return static_cast<std::size_t>(size);
 }
 
 void Buffer::Clear() const {
+    if (IsDirectStateAccessSupported()) {
+        glClearNamedBufferData(buffer_object_, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+        return;
+    }
     Bind();
     glClearBufferData(static_cast<GLenum>(buffer_type_), GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT,
                       nullptr);
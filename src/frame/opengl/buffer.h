@@ -58,7 +58,8 @@ class Buffer : public BindInterface, public BufferInterface {
 
    public:
     /**
-     * @brief Copy a value in the buffer, the size is in bytes!
+     * @brief Copy a value in the buffer, the size is in bytes! With direct state access the static
+     * buffers are allocated once (immutable storage) and throw if the size change.
      * @param size: Number of bytes to be copied.
      * @param data: Data pointer to the data to be copied (void*).
      */
@@ -78,6 +79,14 @@ class Buffer : public BindInterface, public BufferInterface {
      * @param vector: in vector to be copied in the buffer.
      */
     void Copy(const std::vector<std::uint8_t>& vector) const override;
+    /**
+     * @brief Copy data in a part of the buffer (the buffer has to be big enough), this doesn't
+     * touch the element array binding of the bound vertex array.
+     * @param offset: Offset in the buffer in bytes.
+     * @param size: Number of bytes to be copied.
+     * @param data: Data pointer to the data to be copied.
+     */
+    void Update(std::size_t offset, std::size_t size, const void* data) const;
     /**
      * @brief Clear the buffer.
      */
@@ -131,6 +140,8 @@ class Buffer : public BindInterface, public BufferInterface {
     const BufferTypeEnum buffer_type_   = BufferTypeEnum::ARRAY_BUFFER;
     const BufferUsageEnum buffer_usage_ = BufferUsageEnum::STATIC_DRAW;
     unsigned int buffer_object_         = 0;
+    // Size of the storage allocated with glNamedBufferStorage (0 while mutable).
+    mutable std::size_t immutable_size_ = 0;
 };
 
 /**
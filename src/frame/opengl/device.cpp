@@ -1,5 +1,7 @@
 #include "device.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <glm/gtc/matrix_transform.hpp>
@@ -33,7 +35,13 @@ Device::Device(void* gl_context, glm::uvec2 size) : gl_context_(gl_context), siz
     glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 }
 
-Device::~Device() { Cleanup(); }
+Device::~Device() {
+    // Write the screenshots still in flight (the pool wait for the encoding).
+    texture_readback_.Finish();
+    EncodeScreenShots();
+    encode_pool_ = nullptr;
+    Cleanup();
+}
 
 void Device::Startup(std::unique_ptr<frame::LevelInterface>&& level) {
     // Copy level into the local area.
@@ -135,11 +143,12 @@ void Device::DisplayLeftRightCamera(const Camera& camera_left, const Camera& cam
 void Device::Display(double dt /*= 0.0*/) {
     if (!renderer_) throw std::runtime_error("No Renderer.");
     Clear();
+    // Compute the world models once for the whole frame.
+    level_->UpdateWorldModels(dt);
     // Get the holder of the camera.
     auto camera_holder_id = level_->GetDefaultCameraId();
     auto enum_type        = level_->GetEnumTypeFromId(camera_holder_id);
-    auto& node            = level_->GetSceneNodeFromId(camera_holder_id);
-    auto matrix_node      = node.GetLocalModel(dt);
+    auto matrix_node      = level_->GetWorldModelFromId(camera_holder_id);
     auto inverse_model    = glm::inverse(matrix_node);
     Camera default_camera = level_->GetDefaultCamera();
     default_camera.SetFront(default_camera.GetFront() * glm::mat3(inverse_model));
@@ -181,6 +190,10 @@ void Device::Display(double dt /*= 0.0*/) {
     // Final display.
     // CHECKME(anirul): Is this still needed?
     renderer_->Display(dt);
+    // Readbacks requested in the previous frames should be ready by now.
+    texture_readback_.Poll();
+    CaptureFrame();
+    EncodeScreenShots();
 }
 
 void Device::ScreenShot(const std::string& file) const {
@@ -198,6 +211,82 @@ void Device::ScreenShot(const std::string& file) const {
     output_image.SaveImageToFile(file);
 }
 
+std::future<void> Device::ScreenShotAsync(const std::string& file) {
+    auto maybe_texture_id = level_->GetDefaultOutputTextureId();
+    if (!maybe_texture_id) throw std::runtime_error("no default texture.");
+    auto& texture = dynamic_cast<Texture&>(level_->GetTextureFromId(maybe_texture_id));
+    PendingScreenShot pending_screen_shot = {};
+    pending_screen_shot.pixels            = texture_readback_.Request(texture);
+    pending_screen_shot.size              = texture.GetSize();
+    pending_screen_shot.pixel_structure.set_value(texture.GetPixelStructure());
+    pending_screen_shot.file    = file;
+    pending_screen_shot.promise = std::make_shared<std::promise<void>>();
+    auto future                 = pending_screen_shot.promise->get_future();
+    pending_screen_shots_.push_back(std::move(pending_screen_shot));
+    return future;
+}
+
+void Device::StartCapture(const std::string& file_pattern,
+                          std::uint32_t every_n_frames /* = 1*/) {
+    capture_file_pattern_   = file_pattern;
+    capture_every_n_frames_ = std::max(every_n_frames, 1u);
+    capture_frame_          = 0;
+    capture_dropped_        = 0;
+}
+
+void Device::StopCapture() {
+    if (!capture_every_n_frames_) return;
+    capture_every_n_frames_ = 0;
+    logger_->info("Capture stopped after {} frames ({} dropped).", capture_frame_,
+                  capture_dropped_);
+}
+
+std::future<std::vector<std::uint8_t>> Device::ReadTextureAsync(EntityId texture_id) {
+    auto& texture = dynamic_cast<Texture&>(level_->GetTextureFromId(texture_id));
+    return texture_readback_.Request(texture);
+}
+
+void Device::CaptureFrame() {
+    if (!capture_every_n_frames_) return;
+    const auto frame = capture_frame_++;
+    if (frame % capture_every_n_frames_) return;
+    // Drop the frame rather than slowing down the rendering when the encoding is late.
+    const std::size_t max_in_flight =
+        2 * (encode_pool_ ? encode_pool_->GetThreadCount() : 1) + 2;
+    if (pending_screen_shots_.size() + encode_count_ >= max_in_flight) {
+        capture_dropped_++;
+        return;
+    }
+    ScreenShotAsync(fmt::format(fmt::runtime(capture_file_pattern_), frame));
+}
+
+void Device::EncodeScreenShots() {
+    while (!pending_screen_shots_.empty()) {
+        auto& pixels = pending_screen_shots_.front().pixels;
+        if (pixels.wait_for(std::chrono::seconds(0)) != std::future_status::ready) break;
+        if (!encode_pool_) {
+            encode_pool_ = std::make_unique<TaskPool>(
+                std::max(std::thread::hardware_concurrency() / 2, 1u));
+        }
+        encode_count_++;
+        encode_pool_->Submit(
+            [this, pending_screen_shot = std::move(pending_screen_shots_.front())]() mutable {
+                try {
+                    auto pixels = pending_screen_shot.pixels.get();
+                    file::Image image(pending_screen_shot.size, proto::PixelElementSize_BYTE(),
+                                      pending_screen_shot.pixel_structure);
+                    image.SetData(pixels.data());
+                    image.SaveImageToFile(pending_screen_shot.file);
+                    pending_screen_shot.promise->set_value();
+                } catch (...) {
+                    pending_screen_shot.promise->set_exception(std::current_exception());
+                }
+                encode_count_--;
+            });
+        pending_screen_shots_.pop_front();
+    }
+}
+
 std::unique_ptr<frame::BufferInterface> Device::CreatePointBuffer(std::vector<float>&& vector) {
     return opengl::CreatePointBuffer(std::move(vector));
 }
@@ -3,7 +3,10 @@
 #include <SDL2/SDL.h>
 
 #include <array>
+#include <atomic>
+#include <deque>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -18,6 +21,8 @@
 #include "frame/opengl/renderer.h"
 #include "frame/opengl/static_mesh.h"
 #include "frame/opengl/texture.h"
+#include "frame/opengl/texture_readback.h"
+#include "frame/task_pool.h"
 #include "frame/uniform_interface.h"
 
 namespace frame::opengl {
@@ -95,6 +100,26 @@ class Device : public DeviceInterface {
      * dropped at the path where the software is run.
      */
     void ScreenShot(const std::string& file) const final;
+    /**
+     * @brief Make a screenshot of the current frame without stalling.
+     * @param file: File name to write the screenshot to (*.png).
+     * @return A future that is ready once the file is written.
+     */
+    std::future<void> ScreenShotAsync(const std::string& file) final;
+    /**
+     * @brief Start to capture every Nth frame to an image sequence.
+     * @param file_pattern: Pattern of the file names, formatted with the frame number.
+     * @param every_n_frames: Capture one frame every N frames.
+     */
+    void StartCapture(const std::string& file_pattern, std::uint32_t every_n_frames = 1) final;
+    //! @brief Stop the capture started with StartCapture.
+    void StopCapture() final;
+    /**
+     * @brief Read the pixels of a texture without stalling.
+     * @param texture_id: Id of the texture to be read.
+     * @return A future to the pixels.
+     */
+    std::future<std::vector<std::uint8_t>> ReadTextureAsync(EntityId texture_id) final;
 
    public:
     /**
@@ -163,6 +188,10 @@ class Device : public DeviceInterface {
     void DisplayCamera(const Camera& camera, glm::uvec4 viewport, double time);
     void DisplayLeftRightCamera(const Camera& camera_left, const Camera& camera_right,
                                 glm::uvec4 viewport_left, glm::uvec4 viewport_right, double time);
+    //! @brief Capture the current frame if the capture is on (drop it if the encoding is late).
+    void CaptureFrame();
+    //! @brief Send the screenshots whose pixels arrived to the encoding workers.
+    void EncodeScreenShots();
 
    private:
     // Map of current stored level.
@@ -182,6 +211,22 @@ class Device : public DeviceInterface {
     bool invert_left_right_     = false;
     // Logger for the device.
     const Logger& logger_ = Logger::GetInstance();
+    // Asynchronous screenshots (waiting for their pixels) and capture.
+    struct PendingScreenShot {
+        std::future<std::vector<std::uint8_t>> pixels = {};
+        glm::uvec2 size                               = { 0, 0 };
+        proto::PixelStructure pixel_structure         = {};
+        std::string file                              = {};
+        std::shared_ptr<std::promise<void>> promise   = nullptr;
+    };
+    TextureReadback texture_readback_                   = {};
+    std::deque<PendingScreenShot> pending_screen_shots_ = {};
+    std::unique_ptr<TaskPool> encode_pool_              = nullptr;
+    std::atomic<std::size_t> encode_count_              = 0;
+    std::string capture_file_pattern_                   = {};
+    std::uint32_t capture_every_n_frames_               = 0;
+    std::uint64_t capture_frame_                        = 0;
+    std::uint64_t capture_dropped_                      = 0;
 };
 
 }  // End namespace frame::opengl.
@@ -47,4 +47,25 @@ std::unique_ptr<frame::ProgramInterface> LoadProgram(const std::string& program_
     return CreateProgram(program_name, vertex_ifs, fragment_ifs);
 }
 
+ProgramSource LoadProgramSourceFromName(const std::string& program_name,
+                                        const std::string& vertex_name,
+                                        const std::string& fragment_name,
+                                        const std::string& geometry_name) {
+    // Read a shader file from its name and extension.
+    auto read_shader = [](const std::string& shader_name, const std::string& extension) {
+        std::ifstream ifs{ frame::file::FindFile(
+            std::filesystem::path("asset/shader/opengl/" + shader_name + extension)) };
+        return std::string(std::istreambuf_iterator<char>(ifs), {});
+    };
+    ProgramSource program_source = {};
+    program_source.name          = program_name;
+    program_source.vertex        = read_shader(vertex_name, ".vert");
+    program_source.fragment      = read_shader(fragment_name, ".frag");
+    if (geometry_name != "") try {
+            program_source.geometry = read_shader(geometry_name, ".geom");
+        } catch (std::runtime_error) {
+        }
+    return program_source;
+}
+
 }  // namespace frame::opengl::file
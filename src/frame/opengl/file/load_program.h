@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 
+#include "frame/opengl/program.h"
 #include "frame/program_interface.h"
 
 namespace frame::opengl::file {
@@ -39,4 +40,18 @@ std::unique_ptr<ProgramInterface> LoadProgram(const std::string& program_name,
                                               const std::string& fragment_filepath,
                                               const std::string& geometry_filepath = "");
 
+/**
+ * @brief Read the sources of a program from names without compiling it (see CreatePrograms).
+ * @param program_name: Program name.
+ * @param vertex_name: vertex shader name.
+ * @param fragment_name: fragment shader name.
+ * @param geometry_name: geometry shader name (optional if the file doesn't exist). By default
+ * empty.
+ * @return The sources of the program.
+ */
+ProgramSource LoadProgramSourceFromName(const std::string& program_name,
+                                        const std::string& vertex_name,
+                                        const std::string& fragment_name,
+                                        const std::string& geometry_name = "");
+
 }  // namespace frame::opengl::file
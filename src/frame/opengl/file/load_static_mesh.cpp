@@ -2,34 +2,70 @@
 
 #include <stdexcept>
 
+#include "frame/bounding_volume.h"
 #include "frame/file/file_system.h"
 #include "frame/file/image.h"
+#include "frame/file/mesh_cache.h"
 #include "frame/file/obj.h"
 #include "frame/file/ply.h"
 #include "frame/logger.h"
 #include "frame/opengl/buffer.h"
 #include "frame/opengl/file/load_texture.h"
 #include "frame/opengl/static_mesh.h"
+#include "frame/vertex_packing.h"
 
 namespace frame::opengl::file {
 
 namespace {
 
-template <typename T>
 std::optional<EntityId> CreateBufferInLevel(
-    LevelInterface& level, const std::vector<T>& vec, const std::string& desc,
+    LevelInterface& level, const void* data, std::size_t size, const std::string& desc,
     const BufferTypeEnum buffer_type   = BufferTypeEnum::ARRAY_BUFFER,
     const BufferUsageEnum buffer_usage = BufferUsageEnum::STATIC_DRAW) {
     auto buffer = std::make_unique<Buffer>(buffer_type, buffer_usage);
     if (!buffer) throw std::runtime_error("No buffer create!");
     // Buffer initialization.
     buffer->Bind();
-    buffer->Copy(vec.size() * sizeof(T), vec.data());
+    buffer->Copy(size, data);
     buffer->UnBind();
     buffer->SetName(desc);
     return level.AddBuffer(std::move(buffer));
 }
 
+template <typename T>
+std::optional<EntityId> CreateBufferInLevel(
+    LevelInterface& level, const std::vector<T>& vec, const std::string& desc,
+    const BufferTypeEnum buffer_type   = BufferTypeEnum::ARRAY_BUFFER,
+    const BufferUsageEnum buffer_usage = BufferUsageEnum::STATIC_DRAW) {
+    return CreateBufferInLevel(level, vec.data(), vec.size() * sizeof(T), desc, buffer_type,
+                               buffer_usage);
+}
+
+// Create a single vertex buffer and an index buffer and fill the parameter with them.
+bool CreateInterleavedBuffersInLevel(LevelInterface& level, StaticMeshParameter& parameter,
+                                     const std::vector<float>& points,
+                                     const std::vector<float>& colors,
+                                     const std::vector<float>& normals,
+                                     const std::vector<float>& textures,
+                                     const std::vector<std::uint32_t>& indices,
+                                     const std::string& name) {
+    auto interleaved_vertices = InterleaveVertices(points, colors, normals, textures, indices);
+
+    auto maybe_vertex_buffer_id = CreateBufferInLevel(level, interleaved_vertices.vertices,
+                                                      fmt::format("{}.vertex", name));
+    if (!maybe_vertex_buffer_id) return false;
+    auto maybe_index_buffer_id =
+        CreateBufferInLevel(level, interleaved_vertices.indices, fmt::format("{}.index", name),
+                            opengl::BufferTypeEnum::ELEMENT_ARRAY_BUFFER);
+    if (!maybe_index_buffer_id) return false;
+    parameter.vertex_buffer_id   = maybe_vertex_buffer_id.value();
+    parameter.index_buffer_id    = maybe_index_buffer_id.value();
+    parameter.vertex_stride      = interleaved_vertices.vertex_stride;
+    parameter.vertex_attributes  = std::move(interleaved_vertices.vertex_attributes);
+    parameter.index_element_size = interleaved_vertices.index_element_size;
+    return true;
+}
+
 std::optional<std::unique_ptr<TextureInterface>> LoadTextureFromString(
     const std::string& str, const proto::PixelElementSize pixel_element_size,
     const proto::PixelStructure pixel_structure) {
@@ -94,11 +130,32 @@ std::optional<EntityId> LoadMaterialFromObj(LevelInterface& level,
     return level.AddMaterial(std::move(material));
 }
 
-std::pair<EntityId, EntityId> LoadStaticMeshFromObj(LevelInterface& level,
-                                                    const frame::file::ObjMesh& mesh_obj,
-                                                    const std::string& name,
-                                                    const std::vector<EntityId> material_ids,
-                                                    int counter) {
+std::pair<EntityId, EntityId> AddStaticMeshFromObj(LevelInterface& level,
+                                                   const StaticMeshParameter& parameter,
+                                                   const std::string& name,
+                                                   const std::vector<EntityId> material_ids,
+                                                   int counter,
+                                                   const BoundingVolume& bounding_volume) {
+    auto static_mesh = std::make_unique<opengl::StaticMesh>(level, parameter);
+    static_mesh->SetBoundingVolume(bounding_volume);
+    auto material_id = NullId;
+    if (!material_ids.empty()) {
+        if (material_ids.size() != 1) {
+            throw std::runtime_error("should only have 1 material here.");
+        }
+        material_id = material_ids[0];
+    }
+    std::string mesh_name = fmt::format("{}.{}", name, counter);
+    static_mesh->SetName(mesh_name);
+    auto maybe_mesh_id = level.AddStaticMesh(std::move(static_mesh));
+    if (!maybe_mesh_id) return { NullId, NullId };
+    return { maybe_mesh_id, material_id };
+}
+
+std::pair<EntityId, EntityId> LoadStaticMeshFromObj(
+    LevelInterface& level, const frame::file::ObjMesh& mesh_obj, const std::string& name,
+    const std::vector<EntityId> material_ids, int counter, bool interleaved,
+    const frame::file::LevelOfDetailIndices* level_of_detail) {
     std::vector<float> points;
     std::vector<float> normals;
     std::vector<float> textures;
@@ -114,7 +171,24 @@ std::pair<EntityId, EntityId> LoadStaticMeshFromObj(LevelInterface& level,
         textures.push_back(vertice.tex_coord.x);
         textures.push_back(vertice.tex_coord.y);
     }
-    const auto& indices = mesh_obj.GetIndices();
+    const auto& indices                  = mesh_obj.GetIndices();
+    StaticMeshParameter parameter        = {};
+    const BoundingVolume bounding_volume = ComputeBoundingVolume(points);
+    // All the levels of detail are in the index buffer.
+    std::vector<std::uint32_t> unsigned_indices(indices.begin(), indices.end());
+    if (level_of_detail) {
+        unsigned_indices                  = level_of_detail->indices;
+        parameter.level_of_detail_offsets = level_of_detail->offsets;
+    }
+
+    if (interleaved) {
+        if (!CreateInterleavedBuffersInLevel(level, parameter, points, {}, normals, textures,
+                                             unsigned_indices,
+                                             fmt::format("{}.{}", name, counter))) {
+            return { NullId, NullId };
+        }
+        return AddStaticMeshFromObj(level, parameter, name, material_ids, counter, bounding_volume);
+    }
 
     // Point buffer initialization.
     auto maybe_point_buffer_id =
@@ -136,32 +210,20 @@ std::pair<EntityId, EntityId> LoadStaticMeshFromObj(LevelInterface& level,
 
     // Index buffer array.
     auto maybe_index_buffer_id =
-        CreateBufferInLevel(level, indices, fmt::format("{}.{}.index", name, counter),
+        CreateBufferInLevel(level, unsigned_indices, fmt::format("{}.{}.index", name, counter),
                             opengl::BufferTypeEnum::ELEMENT_ARRAY_BUFFER);
     if (!maybe_index_buffer_id) return { NullId, NullId };
-    EntityId index_buffer_id      = maybe_index_buffer_id.value();
-    StaticMeshParameter parameter = {};
-    parameter.point_buffer_id     = point_buffer_id;
-    parameter.normal_buffer_id    = normal_buffer_id;
-    parameter.texture_buffer_id   = tex_coord_buffer_id;
-    parameter.index_buffer_id     = index_buffer_id;
-    auto static_mesh              = std::make_unique<opengl::StaticMesh>(level, parameter);
-    auto material_id              = NullId;
-    if (!material_ids.empty()) {
-        if (material_ids.size() != 1) {
-            throw std::runtime_error("should only have 1 material here.");
-        }
-        material_id = material_ids[0];
-    }
-    std::string mesh_name = fmt::format("{}.{}", name, counter);
-    static_mesh->SetName(mesh_name);
-    auto maybe_mesh_id = level.AddStaticMesh(std::move(static_mesh));
-    if (!maybe_mesh_id) return { NullId, NullId };
-    return { maybe_mesh_id, material_id };
+    EntityId index_buffer_id    = maybe_index_buffer_id.value();
+    parameter.point_buffer_id   = point_buffer_id;
+    parameter.normal_buffer_id  = normal_buffer_id;
+    parameter.texture_buffer_id = tex_coord_buffer_id;
+    parameter.index_buffer_id   = index_buffer_id;
+    return AddStaticMeshFromObj(level, parameter, name, material_ids, counter, bounding_volume);
 }
 
 EntityId LoadStaticMeshFromPly(LevelInterface& level, const frame::file::Ply& ply,
-                               const std::string& name) {
+                               const std::string& name, bool interleaved,
+                               const frame::file::LevelOfDetailIndices* level_of_detail) {
     EntityId result = NullId;
     std::vector<float> points;
     std::vector<float> normals;
@@ -186,67 +248,80 @@ EntityId LoadStaticMeshFromPly(LevelInterface& level, const frame::file::Ply& pl
         textures.push_back(texcoord.x);
         textures.push_back(texcoord.y);
     }
-    const auto& indices = ply.GetIndices();
+    // All the levels of detail are in the index buffer.
+    const auto& indices = level_of_detail ? level_of_detail->indices : ply.GetIndices();
 
-    // Point buffer initialization.
-    auto maybe_point_buffer_id = CreateBufferInLevel(level, points, fmt::format("{}.point", name));
-    if (!maybe_point_buffer_id) return NullId;
-    EntityId point_buffer_id = maybe_point_buffer_id.value();
+    std::unique_ptr<opengl::StaticMesh> static_mesh = nullptr;
 
-    // Color buffer initialization.
-    auto maybe_color_buffer_id = CreateBufferInLevel(level, colors, fmt::format("{}.color", name));
-    if (!maybe_color_buffer_id) return NullId;
-    EntityId color_buffer_id = maybe_color_buffer_id.value();
+    StaticMeshParameter parameter = {};
+    if (level_of_detail) parameter.level_of_detail_offsets = level_of_detail->offsets;
 
-    // Normal buffer initialization.
-    auto maybe_normal_buffer_id =
-        CreateBufferInLevel(level, normals, fmt::format("{}.normal", name));
-    if (!maybe_normal_buffer_id) return NullId;
-    EntityId normal_buffer_id = maybe_normal_buffer_id.value();
+    if (interleaved) {
+        if (!CreateInterleavedBuffersInLevel(level, parameter, points, colors, normals, textures,
+                                             indices, name)) {
+            return NullId;
+        }
+    } else {
+        // Point buffer initialization.
+        auto maybe_point_buffer_id =
+            CreateBufferInLevel(level, points, fmt::format("{}.point", name));
+        if (!maybe_point_buffer_id) return NullId;
+        EntityId point_buffer_id = maybe_point_buffer_id.value();
 
-    // Texture coordinates buffer initialization.
-    auto maybe_tex_coord_buffer_id =
-        CreateBufferInLevel(level, textures, fmt::format("{}.texture", name));
-    if (!maybe_tex_coord_buffer_id) return NullId;
-    EntityId tex_coord_buffer_id = maybe_tex_coord_buffer_id.value();
+        // Color buffer initialization.
+        auto maybe_color_buffer_id =
+            CreateBufferInLevel(level, colors, fmt::format("{}.color", name));
+        if (!maybe_color_buffer_id) return NullId;
+        EntityId color_buffer_id = maybe_color_buffer_id.value();
 
-    // Index buffer array.
-    auto maybe_index_buffer_id = CreateBufferInLevel(level, indices, fmt::format("{}.index", name),
-                                                     opengl::BufferTypeEnum::ELEMENT_ARRAY_BUFFER);
-    if (!maybe_index_buffer_id) return NullId;
-    EntityId index_buffer_id = maybe_index_buffer_id.value();
+        // Normal buffer initialization.
+        auto maybe_normal_buffer_id =
+            CreateBufferInLevel(level, normals, fmt::format("{}.normal", name));
+        if (!maybe_normal_buffer_id) return NullId;
+        EntityId normal_buffer_id = maybe_normal_buffer_id.value();
 
-    std::unique_ptr<opengl::StaticMesh> static_mesh = nullptr;
+        // Texture coordinates buffer initialization.
+        auto maybe_tex_coord_buffer_id =
+            CreateBufferInLevel(level, textures, fmt::format("{}.texture", name));
+        if (!maybe_tex_coord_buffer_id) return NullId;
+        EntityId tex_coord_buffer_id = maybe_tex_coord_buffer_id.value();
 
-    StaticMeshParameter parameter = {};
-    parameter.point_buffer_id     = point_buffer_id;
-    parameter.index_buffer_id     = index_buffer_id;
+        // Index buffer array.
+        auto maybe_index_buffer_id =
+            CreateBufferInLevel(level, indices, fmt::format("{}.index", name),
+                                opengl::BufferTypeEnum::ELEMENT_ARRAY_BUFFER);
+        if (!maybe_index_buffer_id) return NullId;
+        EntityId index_buffer_id = maybe_index_buffer_id.value();
 
-    // Add for present buffer.
-    if (!normals.empty()) {
-        parameter.normal_buffer_id = normal_buffer_id;
-    }
-    if (!textures.empty()) {
-        parameter.texture_buffer_id = tex_coord_buffer_id;
-    }
-    if (!colors.empty()) {
-        parameter.color_buffer_id = color_buffer_id;
+        parameter.point_buffer_id = point_buffer_id;
+        parameter.index_buffer_id = index_buffer_id;
+
+        // Add for present buffer.
+        if (!normals.empty()) {
+            parameter.normal_buffer_id = normal_buffer_id;
+        }
+        if (!textures.empty()) {
+            parameter.texture_buffer_id = tex_coord_buffer_id;
+        }
+        if (!colors.empty()) {
+            parameter.color_buffer_id = color_buffer_id;
+        }
     }
 
     static_mesh           = std::make_unique<opengl::StaticMesh>(level, parameter);
     std::string mesh_name = fmt::format("{}", name);
     static_mesh->SetName(mesh_name);
+    static_mesh->SetBoundingVolume(ComputeBoundingVolume(points));
     auto maybe_mesh_id = level.AddStaticMesh(std::move(static_mesh));
     if (!maybe_mesh_id) return NullId;
     return maybe_mesh_id;
 }
 
-std::vector<EntityId> LoadStaticMeshesFromObjFile(LevelInterface& level,
-                                                  const std::filesystem::path& file,
-                                                  const std::string& name,
-                                                  const std::string& material_name /* = ""*/) {
+std::vector<EntityId> LoadStaticMeshesFromObjFile(
+    LevelInterface& level, const frame::file::Obj& obj, const std::filesystem::path& file,
+    const std::string& name, const std::string& material_name, bool interleaved,
+    const std::vector<frame::file::LevelOfDetailIndices>& level_of_details) {
     std::vector<EntityId> entity_id_vec;
-    frame::file::Obj obj(file);
     const auto& meshes = obj.GetMeshes();
     Logger& logger     = Logger::GetInstance();
     std::vector<EntityId> material_ids;
@@ -257,8 +332,10 @@ std::vector<EntityId> LoadStaticMeshesFromObjFile(LevelInterface& level,
     logger->info("Found in obj<{}> : {} meshes.", file.string(), meshes.size());
     int mesh_counter = 0;
     for (const auto& mesh : meshes) {
-        auto [static_mesh_id, material_id] =
-            LoadStaticMeshFromObj(level, mesh, name, material_ids, mesh_counter);
+        const auto* level_of_detail =
+            level_of_details.empty() ? nullptr : &level_of_details[mesh_counter];
+        auto [static_mesh_id, material_id] = LoadStaticMeshFromObj(
+            level, mesh, name, material_ids, mesh_counter, interleaved, level_of_detail);
         if (!static_mesh_id) return {};
         auto func = [&level](const std::string& name) -> NodeInterface* {
             auto maybe_id = level.GetIdFromName(name);
@@ -278,18 +355,17 @@ std::vector<EntityId> LoadStaticMeshesFromObjFile(LevelInterface& level,
     return entity_id_vec;
 }
 
-EntityId LoadStaticMeshFromPlyFile(LevelInterface& level, const std::filesystem::path& file,
-                                   const std::string& name,
-                                   const std::string& material_name /* = ""*/) {
-    EntityId entity_id = NullId;
-    frame::file::Ply ply(file);
-    Logger& logger       = Logger::GetInstance();
+EntityId LoadStaticMeshFromPlyFile(LevelInterface& level, const frame::file::Ply& ply,
+                                   const std::string& name, const std::string& material_name,
+                                   bool interleaved,
+                                   const frame::file::LevelOfDetailIndices* level_of_detail) {
+    EntityId entity_id   = NullId;
     EntityId material_id = NullId;
     if (!material_name.empty()) {
         auto maybe_id = level.GetIdFromName(material_name);
         if (maybe_id) material_id = maybe_id;
     }
-    auto static_mesh_id = LoadStaticMeshFromPly(level, ply, name);
+    auto static_mesh_id = LoadStaticMeshFromPly(level, ply, name, interleaved, level_of_detail);
     if (!static_mesh_id) return NullId;
     auto func = [&level](const std::string& name) -> NodeInterface* {
         auto maybe_id = level.GetIdFromName(name);
@@ -307,18 +383,211 @@ EntityId LoadStaticMeshFromPlyFile(LevelInterface& level, const std::filesystem:
     return entity_id;
 }
 
+// Interleave the meshes of an OBJ or PLY file (the same way as the separate buffers).
+std::vector<InterleavedVertices> InterleaveMeshesFromFile(const std::filesystem::path& file,
+                                                          bool optimize) {
+    std::vector<InterleavedVertices> result;
+    if (file.extension() == ".obj") {
+        frame::file::Obj obj(file, optimize);
+        for (const auto& mesh : obj.GetMeshes()) {
+            std::vector<float> points;
+            std::vector<float> normals;
+            std::vector<float> textures;
+            for (const auto& vertice : mesh.GetVertices()) {
+                points.insert(points.end(), { vertice.point.x, vertice.point.y, vertice.point.z });
+                normals.insert(normals.end(),
+                               { vertice.normal.x, vertice.normal.y, vertice.normal.z });
+                textures.insert(textures.end(), { vertice.tex_coord.x, vertice.tex_coord.y });
+            }
+            const std::vector<std::uint32_t> indices(mesh.GetIndices().begin(),
+                                                     mesh.GetIndices().end());
+            result.push_back(InterleaveVertices(points, {}, normals, textures, indices));
+        }
+        return result;
+    }
+    frame::file::Ply ply(file);
+    std::vector<float> points;
+    std::vector<float> colors;
+    std::vector<float> normals;
+    std::vector<float> textures;
+    for (const auto& point : ply.GetVertices()) {
+        points.insert(points.end(), { point.x, point.y, point.z });
+    }
+    for (const auto& color : ply.GetColors()) {
+        colors.insert(colors.end(), { color.r, color.g, color.b });
+    }
+    for (const auto& normal : ply.GetNormals()) {
+        normals.insert(normals.end(), { normal.x, normal.y, normal.z });
+    }
+    for (const auto& texcoord : ply.GetTextureCoordinates()) {
+        textures.insert(textures.end(), { texcoord.x, texcoord.y });
+    }
+    result.push_back(InterleaveVertices(points, colors, normals, textures, ply.GetIndices()));
+    return result;
+}
+
+// Load the meshes from the compiled mesh next to the file (compile it if it is missing), the
+// buffers are filled directly from the mapping.
+std::vector<EntityId> LoadStaticMeshesFromCompiledFile(LevelInterface& level,
+                                                       const std::filesystem::path& file,
+                                                       const std::string& name,
+                                                       const std::string& material_name,
+                                                       bool optimize) {
+    Logger& logger           = Logger::GetInstance();
+    const auto hash          = frame::file::HashFile(file, optimize ? 1 : 0);
+    const auto compiled_path = frame::file::GetCompiledMeshPath(file, hash);
+    // Keep the source of the views alive (either the mapping or the compiled vectors).
+    std::unique_ptr<frame::file::CompiledMeshFile> compiled_file = nullptr;
+    std::vector<InterleavedVertices> interleaved_meshes;
+    std::vector<frame::file::CompiledMesh> meshes;
+    if (std::filesystem::exists(compiled_path)) {
+        try {
+            compiled_file = std::make_unique<frame::file::CompiledMeshFile>(compiled_path);
+            meshes        = compiled_file->GetMeshes();
+            logger->info("Loaded compiled mesh [{}].", compiled_path.string());
+        } catch (const std::exception& ex) {
+            logger->warn("Invalid compiled mesh [{}]: {}", compiled_path.string(), ex.what());
+            compiled_file = nullptr;
+        }
+    }
+    if (!compiled_file) {
+        interleaved_meshes = InterleaveMeshesFromFile(file, optimize);
+        try {
+            frame::file::WriteCompiledMeshFile(compiled_path, hash, interleaved_meshes);
+            logger->info("Wrote compiled mesh [{}].", compiled_path.string());
+        } catch (const std::exception& ex) {
+            // Not fatal, the mesh will be compiled again next time.
+            logger->warn("Could not write compiled mesh [{}]: {}", compiled_path.string(),
+                         ex.what());
+        }
+        for (const auto& interleaved_mesh : interleaved_meshes) {
+            frame::file::CompiledMesh mesh = {};
+            mesh.vertex_stride             = interleaved_mesh.vertex_stride;
+            mesh.vertex_attributes         = interleaved_mesh.vertex_attributes;
+            mesh.index_element_size        = interleaved_mesh.index_element_size;
+            mesh.vertices                  = interleaved_mesh.vertices.data();
+            mesh.vertex_size               = interleaved_mesh.vertices.size();
+            mesh.indices                   = interleaved_mesh.indices.data();
+            mesh.index_size                = interleaved_mesh.indices.size();
+            meshes.push_back(std::move(mesh));
+        }
+    }
+    EntityId material_id = NullId;
+    if (!material_name.empty()) {
+        auto maybe_id = level.GetIdFromName(material_name);
+        if (maybe_id) material_id = maybe_id;
+    }
+    // Same names as the OBJ (with a counter) and PLY (without) loaders.
+    const bool use_counter = file.extension() == ".obj";
+    std::vector<EntityId> entity_id_vec;
+    for (std::size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh            = meshes[i];
+        const std::string mesh_name = use_counter ? fmt::format("{}.{}", name, i) : name;
+        auto maybe_vertex_buffer_id =
+            CreateBufferInLevel(level, mesh.vertices, mesh.vertex_size,
+                                fmt::format("{}.vertex", mesh_name));
+        if (!maybe_vertex_buffer_id) return {};
+        auto maybe_index_buffer_id =
+            CreateBufferInLevel(level, mesh.indices, mesh.index_size,
+                                fmt::format("{}.index", mesh_name),
+                                opengl::BufferTypeEnum::ELEMENT_ARRAY_BUFFER);
+        if (!maybe_index_buffer_id) return {};
+        StaticMeshParameter parameter = {};
+        parameter.vertex_buffer_id    = maybe_vertex_buffer_id.value();
+        parameter.index_buffer_id     = maybe_index_buffer_id.value();
+        parameter.vertex_stride       = mesh.vertex_stride;
+        parameter.vertex_attributes   = mesh.vertex_attributes;
+        parameter.index_element_size  = mesh.index_element_size;
+        auto static_mesh              = std::make_unique<opengl::StaticMesh>(level, parameter);
+        static_mesh->SetName(mesh_name);
+        static_mesh->SetBoundingVolume(
+            ComputeBoundingVolume(mesh.vertices, mesh.vertex_size, mesh.vertex_stride));
+        auto static_mesh_id = level.AddStaticMesh(std::move(static_mesh));
+        if (!static_mesh_id) return {};
+        auto func = [&level](const std::string& name) -> NodeInterface* {
+            auto maybe_id = level.GetIdFromName(name);
+            if (!maybe_id) {
+                throw std::runtime_error(fmt::format("no id for name: {}", name));
+            }
+            return &level.GetSceneNodeFromId(maybe_id);
+        };
+        auto ptr = std::make_unique<NodeStaticMesh>(func, static_mesh_id);
+        ptr->SetName(fmt::format("Node.{}", mesh_name));
+        auto maybe_id = level.AddSceneNode(std::move(ptr));
+        if (!maybe_id) return {};
+        level.AddMeshMaterialId(maybe_id, material_id);
+        entity_id_vec.push_back(maybe_id);
+    }
+    return entity_id_vec;
+}
+
 }  // End namespace.
 
 std::vector<EntityId> LoadStaticMeshesFromFile(LevelInterface& level,
                                                const std::filesystem::path& file,
                                                const std::string& name,
-                                               const std::string& material_name /* = ""*/) {
+                                               const std::string& material_name /* = ""*/,
+                                               bool interleaved /* = false*/,
+                                               bool optimize /* = false*/,
+                                               bool compiled /* = false*/,
+                                               std::uint32_t lod_count /* = 0*/) {
     auto extension                   = file.extension();
     std::filesystem::path final_path = frame::file::FindFile(file);
-    if (extension == ".obj")
-        return LoadStaticMeshesFromObjFile(level, final_path, name, material_name);
-    if (extension == ".ply")
-        return { LoadStaticMeshFromPlyFile(level, final_path, name, material_name) };
+    if (compiled && (extension == ".obj" || extension == ".ply")) {
+        if (lod_count > 1) {
+            Logger::GetInstance()->warn("No level of detail in compiled mesh [{}].",
+                                        final_path.string());
+        }
+        return LoadStaticMeshesFromCompiledFile(level, final_path, name, material_name, optimize);
+    }
+    return LoadStaticMeshesFromFile(level, ReadStaticMeshFile(final_path, optimize, lod_count),
+                                    name, material_name, interleaved);
+}
+
+StaticMeshFile ReadStaticMeshFile(const std::filesystem::path& file, bool optimize /* = false*/,
+                                  std::uint32_t lod_count /* = 0*/) {
+    StaticMeshFile static_mesh_file = {};
+    static_mesh_file.file           = file;
+    if (file.extension() == ".obj")
+        static_mesh_file.obj = std::make_unique<frame::file::Obj>(file, optimize);
+    if (file.extension() == ".ply") static_mesh_file.ply = std::make_unique<frame::file::Ply>(file);
+    if (lod_count <= 1) return static_mesh_file;
+    // The simplification is done here as this is the part that runs on the worker threads.
+    if (static_mesh_file.obj) {
+        for (const auto& mesh : static_mesh_file.obj->GetMeshes()) {
+            std::vector<glm::vec3> positions;
+            for (const auto& vertice : mesh.GetVertices()) positions.push_back(vertice.point);
+            const std::vector<std::uint32_t> indices(mesh.GetIndices().begin(),
+                                                     mesh.GetIndices().end());
+            static_mesh_file.level_of_details.push_back(
+                frame::file::BuildLevelOfDetailIndices(indices, positions, lod_count));
+        }
+    }
+    // Point clouds don't have triangles to simplify.
+    if (static_mesh_file.ply && !static_mesh_file.ply->GetIndices().empty()) {
+        static_mesh_file.level_of_details.push_back(frame::file::BuildLevelOfDetailIndices(
+            static_mesh_file.ply->GetIndices(), static_mesh_file.ply->GetVertices(), lod_count));
+    }
+    return static_mesh_file;
+}
+
+std::vector<EntityId> LoadStaticMeshesFromFile(LevelInterface& level,
+                                               const StaticMeshFile& static_mesh_file,
+                                               const std::string& name,
+                                               const std::string& material_name /* = ""*/,
+                                               bool interleaved /* = false*/) {
+    if (static_mesh_file.obj) {
+        return LoadStaticMeshesFromObjFile(level, *static_mesh_file.obj, static_mesh_file.file,
+                                           name, material_name, interleaved,
+                                           static_mesh_file.level_of_details);
+    }
+    if (static_mesh_file.ply) {
+        const auto* level_of_detail = static_mesh_file.level_of_details.empty()
+                                          ? nullptr
+                                          : &static_mesh_file.level_of_details.front();
+        return { LoadStaticMeshFromPlyFile(level, *static_mesh_file.ply, name, material_name,
+                                           interleaved, level_of_detail) };
+    }
     return {};
 }
 
@@ -3,13 +3,30 @@
 #include <memory>
 #include <string>
 
+#include "frame/file/mesh_simplifier.h"
 #include "frame/file/obj.h"
+#include "frame/file/ply.h"
 #include "frame/level_interface.h"
 #include "frame/node_static_mesh.h"
 #include "frame/static_mesh_interface.h"
 
 namespace frame::opengl::file {
 
+/**
+ * @class StaticMeshFile
+ * @brief The CPU side of a mesh file (parsed but not yet uploaded), it can be read on any thread.
+ */
+struct StaticMeshFile {
+    //! @brief The file the mesh was read from.
+    std::filesystem::path file = {};
+    //! @brief The parsed OBJ file (if it was an OBJ file).
+    std::unique_ptr<frame::file::Obj> obj = nullptr;
+    //! @brief The parsed PLY file (if it was a PLY file).
+    std::unique_ptr<frame::file::Ply> ply = nullptr;
+    //! @brief Levels of detail of every mesh of the file (empty if none were asked).
+    std::vector<frame::file::LevelOfDetailIndices> level_of_details = {};
+};
+
 /**
  * @brief Load static meshes from file.
  * @param level: The level in which you want to load the mesh.
@@ -17,11 +34,43 @@ namespace frame::opengl::file {
  * @param name: The name of the mesh.
  * @param material_name: The material that is used.
  * @param skip_material_file: Should you skip the material that are in the file?
+ * @param interleaved: Store the vertices in a single packed interleaved buffer.
+ * @param optimize: Weld and reorder the vertices and triangles (OBJ only).
+ * @param compiled: Load from (or create) the compiled mesh next to the file, the compiled mesh is
+ * memory mapped and always interleaved.
+ * @param lod_count: Number of levels of detail to generate (not for compiled meshes).
  * @return The entity id of the meshes in the level (could be more than one in case OBJ file).
  */
 std::vector<EntityId> LoadStaticMeshesFromFile(LevelInterface& level,
                                                const std::filesystem::path& file,
                                                const std::string& name,
-                                               const std::string& material_name = "");
+                                               const std::string& material_name = "",
+                                               bool interleaved                 = false,
+                                               bool optimize                    = false,
+                                               bool compiled                    = false,
+                                               std::uint32_t lod_count          = 0);
+/**
+ * @brief Read and parse a mesh file without touching the GPU (safe to call from a worker thread).
+ * @param file: The file name of the mesh (OBJ or PLY, the path should already be found).
+ * @param optimize: Weld and reorder the vertices and triangles (OBJ only).
+ * @param lod_count: Number of levels of detail to generate (the simplification happens here).
+ * @return The parsed file (obj and ply are null if the extension is unknown).
+ */
+StaticMeshFile ReadStaticMeshFile(const std::filesystem::path& file, bool optimize = false,
+                                  std::uint32_t lod_count = 0);
+/**
+ * @brief Load static meshes from an already parsed file (this is the GPU part).
+ * @param level: The level in which you want to load the mesh.
+ * @param static_mesh_file: The parsed mesh file (see ReadStaticMeshFile).
+ * @param name: The name of the mesh.
+ * @param material_name: The material that is used.
+ * @param interleaved: Store the vertices in a single packed interleaved buffer.
+ * @return The entity id of the meshes in the level (could be more than one in case OBJ file).
+ */
+std::vector<EntityId> LoadStaticMeshesFromFile(LevelInterface& level,
+                                               const StaticMeshFile& static_mesh_file,
+                                               const std::string& name,
+                                               const std::string& material_name = "",
+                                               bool interleaved                 = false);
 
 }  // namespace frame::opengl::file
@@ -5,13 +5,18 @@
 #include <set>
 #include <vector>
 
+#include "frame/file/block_compression.h"
+#include "frame/file/cache_file.h"
 #include "frame/file/file_system.h"
 #include "frame/file/image.h"
 #include "frame/json/parse_level.h"
 #include "frame/logger.h"
 #include "frame/node_matrix.h"
+#include "frame/opengl/bind_interface.h"
+#include "frame/opengl/file/load_program.h"
 #include "frame/opengl/material.h"
 #include "frame/opengl/renderer.h"
+#include "frame/opengl/scoped_bind.h"
 #include "frame/opengl/static_mesh.h"
 #include "frame/opengl/texture.h"
 #include "frame/opengl/texture_cube_map.h"
@@ -39,7 +44,7 @@ const std::array<glm::mat4, 6> views_cubemap = {
 const glm::mat4 projection_cubemap = glm::perspective(glm::radians(90.0f), 1.0f, 0.01f, 10.0f);
 const std::set<std::string> byte_extention = { "jpeg", "jpg" };
 const std::set<std::string> rgba_extention = { "png" };
-const std::set<std::string> half_extention = { "hdr", "dds" };
+const std::set<std::string> half_extention = { "hdr" };
 
 // Taken from cpp reference.
 std::size_t ReplaceAll(std::string& inout, const std::string_view what,
@@ -74,17 +79,76 @@ std::unique_ptr<frame::TextureInterface> LoadTextureFromFile(
     const std::filesystem::path& file,
     proto::PixelElementSize pixel_element_size /*= proto::PixelElementSize_BYTE()*/,
     proto::PixelStructure pixel_structure /*= proto::PixelStructure_RGB()*/) {
+    if (frame::file::IsCompressedImageFile(file)) {
+        return LoadTextureFromCompressedImage(frame::file::CompressedImage(file));
+    }
     frame::file::Image image(file, pixel_element_size, pixel_structure);
-    TextureParameter texture_parameter = { pixel_element_size, pixel_structure, image.GetSize(),
-                                           image.Data() };
+    return LoadTextureFromImage(image);
+}
+
+std::unique_ptr<frame::TextureInterface> LoadTextureFromCompressedImage(
+    const frame::file::CompressedImage& compressed_image) {
+    const auto format = compressed_image.GetFormat();
+    if (IsCompressedFormatSupported(format)) {
+        return std::make_unique<frame::opengl::Texture>(compressed_image);
+    }
+    auto& logger = Logger::GetInstance();
+    if (format == frame::file::CompressedFormatEnum::BC7 ||
+        format == frame::file::CompressedFormatEnum::ETC2_RGB ||
+        format == frame::file::CompressedFormatEnum::ETC2_RGBA) {
+        logger->error("Compressed format [{}] is not supported by the context.",
+                      static_cast<int>(format));
+        return nullptr;
+    }
+    logger->warn("Compressed format [{}] is not supported, decompressing it.",
+                 static_cast<int>(format));
+    auto rgba = frame::file::DecompressImage(compressed_image.GetLevel(0).data(),
+                                             compressed_image.GetSize(), format);
+    TextureParameter texture_parameter = { proto::PixelElementSize_BYTE(),
+                                           proto::PixelStructure_RGB_ALPHA(),
+                                           compressed_image.GetSize(), rgba.data() };
+    return std::make_unique<frame::opengl::Texture>(texture_parameter);
+}
+
+std::unique_ptr<frame::TextureInterface> LoadTextureFromImage(const ImageInterface& image) {
+    TextureParameter texture_parameter = { image.GetPixelElementSize(), image.GetPixelStructure(),
+                                           image.GetSize(), const_cast<void*>(image.Data()) };
     return std::make_unique<frame::opengl::Texture>(texture_parameter);
 }
 
 std::unique_ptr<frame::TextureInterface> LoadCubeMapTextureFromFile(
     const std::filesystem::path& file,
     proto::PixelElementSize pixel_element_size /*= proto::PixelElementSize_BYTE()*/,
-    proto::PixelStructure pixel_structure /*= proto::PixelStructure_RGB()*/) {
-    auto& logger         = Logger::GetInstance();
+    proto::PixelStructure pixel_structure /*= proto::PixelStructure_RGB()*/,
+    std::uint64_t* source_hash /*= nullptr*/) {
+    auto& logger = Logger::GetInstance();
+    if (source_hash) *source_hash = 0;
+    // Now get it from external file.
+    std::ifstream ifs(frame::file::FindFile("asset/json/equirectangular.json").string());
+    std::string inner_file_json((std::istreambuf_iterator<char>(ifs)), {});
+    // The conversion is cached, keyed by the image and the conversion level (and its shaders).
+    const auto cache_directory = frame::file::GetCacheDirectory("texture");
+    std::uint64_t hash         = 0;
+    std::filesystem::path cache_path;
+    // A missing file is reported by the loading below.
+    if (!cache_directory.empty() && std::filesystem::exists(file)) {
+        const auto pixel_element_size_name = PixelElementSize_Enum_Name(pixel_element_size.value());
+        const auto pixel_structure_name    = PixelStructure_Enum_Name(pixel_structure.value());
+        const auto program_source          = LoadProgramSourceFromName(
+            "equirectangular_cubemap", "equirectangular_cubemap", "equirectangular_cubemap");
+        hash = frame::file::HashStrings({ inner_file_json, program_source.vertex,
+                                          program_source.fragment, pixel_element_size_name,
+                                          pixel_structure_name },
+                                        frame::file::HashFile(file));
+        if (source_hash) *source_hash = hash;
+        cache_path = frame::file::GetCachePath(cache_directory, file.stem().string() + "_cubemap",
+                                               hash, ".ftex");
+        TextureCacheData texture_cache_data = {};
+        if (ReadTextureCacheFile(cache_path, hash, texture_cache_data)) {
+            logger->info("Load cube map [{}] from cache.", file.string());
+            return LoadTextureFromCacheData(texture_cache_data);
+        }
+    }
     auto equirectangular = LoadTextureFromFile(file, pixel_element_size, pixel_structure);
     if (!equirectangular) {
         logger->info("Could not load texture: [{}].", file.string());
@@ -101,9 +165,6 @@ std::unique_ptr<frame::TextureInterface> LoadCubeMapTextureFromFile(
         { "<pixel_element_size>", PixelElementSize_Enum_Name(pixel_element_size.value()) },
         { "<pixel_structure>", PixelStructure_Enum_Name(pixel_structure.value()) }
     };
-    // Now get it from external file.
-    std::ifstream ifs(frame::file::FindFile("asset/json/equirectangular.json").string());
-    std::string inner_file_json((std::istreambuf_iterator<char>(ifs)), {});
     auto level = frame::proto::ParseLevel(cube_pair_res, FillLevel(inner_file_json, filling_map));
     if (!level) {
         logger->info("Could not create level.");
@@ -134,17 +195,38 @@ std::unique_ptr<frame::TextureInterface> LoadCubeMapTextureFromFile(
     // Get the output image (cube map).
     auto maybe_output_id = level->GetIdFromName("OutputTexture");
     if (!maybe_output_id) return nullptr;
-    return level->ExtractTexture(maybe_output_id);
+    auto cube_map = level->ExtractTexture(maybe_output_id);
+    if (hash) {
+        try {
+            WriteTextureCacheFile(cache_path, hash, GetTextureCacheData(*cube_map));
+        } catch (const std::runtime_error& e) {
+            logger->warn("Could not cache cube map [{}]: {}", file.string(), e.what());
+        }
+    }
+    return cube_map;
 }
 
 std::unique_ptr<frame::TextureInterface> LoadCubeMapTextureFromFiles(
     const std::array<std::filesystem::path, 6>& files,
     proto::PixelElementSize pixel_element_size /*= proto::PixelElementSize_BYTE()*/,
-    proto::PixelStructure pixel_structure /*= proto::PixelStructure_RGB()*/) {
+    proto::PixelStructure pixel_structure /*= proto::PixelStructure_RGB()*/,
+    std::uint64_t* source_hash /*= nullptr*/) {
     std::array<std::filesystem::path, 6> final_files = {};
     for (int i = 0; i < final_files.size(); ++i) {
         final_files[i] = frame::file::FindFile(files[i]);
     }
+    if (source_hash) {
+        *source_hash = 0;
+        if (!frame::file::GetCacheDirectory("texture").empty()) {
+            std::uint64_t hash = frame::file::HashStrings(
+                { PixelElementSize_Enum_Name(pixel_element_size.value()),
+                  PixelStructure_Enum_Name(pixel_structure.value()) });
+            for (const auto& final_file : final_files) {
+                hash = frame::file::HashFile(final_file, hash);
+            }
+            *source_hash = hash;
+        }
+    }
     std::pair<std::uint32_t, std::uint32_t> img_size;
     std::array<std::unique_ptr<frame::file::Image>, 6> images;
     std::array<void*, 6> pointers      = {};
@@ -159,6 +241,101 @@ std::unique_ptr<frame::TextureInterface> LoadCubeMapTextureFromFiles(
     return std::make_unique<opengl::TextureCubeMap>(texture_parameter);
 }
 
+std::unique_ptr<TextureInterface> LoadTextureFromCacheData(
+    const TextureCacheData& texture_cache_data) {
+    TextureParameter texture_parameter = {};
+    texture_parameter.pixel_element_size.set_value(texture_cache_data.pixel_element_size);
+    texture_parameter.pixel_structure.set_value(texture_cache_data.pixel_structure);
+    texture_parameter.size = texture_cache_data.size;
+    auto* data             = const_cast<std::uint8_t*>(texture_cache_data.data.data());
+    const bool cube_map    = texture_cache_data.face_count == 6;
+    // The first level is created with the texture.
+    std::unique_ptr<TextureInterface> texture = nullptr;
+    if (cube_map) {
+        const std::size_t face_size = GetTextureCacheFaceSize(texture_cache_data, 0);
+        texture_parameter.map_type  = TextureTypeEnum::CUBMAP;
+        for (std::size_t i = 0; i < texture_parameter.array_data_ptr.size(); ++i) {
+            texture_parameter.array_data_ptr[i] = data + i * face_size;
+        }
+        texture = std::make_unique<opengl::TextureCubeMap>(texture_parameter);
+    } else {
+        texture_parameter.data_ptr = data;
+        texture                    = std::make_unique<opengl::Texture>(texture_parameter);
+    }
+    if (texture_cache_data.mip_count <= 1) return texture;
+    // Then the other mip levels.
+    const GLenum target = cube_map ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+    const auto& bind    = dynamic_cast<const BindInterface&>(*texture);
+    const auto internal_format =
+        ConvertToGLType(texture_parameter.pixel_element_size, texture_parameter.pixel_structure);
+    const auto format = ConvertToGLType(texture_parameter.pixel_structure);
+    const auto type   = ConvertToGLType(texture_parameter.pixel_element_size);
+    bind.Bind();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    std::size_t offset = GetTextureCacheFaceSize(texture_cache_data, 0) *
+                         texture_cache_data.face_count;
+    for (std::uint32_t level = 1; level < texture_cache_data.mip_count; ++level) {
+        const auto width     = std::max(texture_cache_data.size.x >> level, 1u);
+        const auto height    = std::max(texture_cache_data.size.y >> level, 1u);
+        const auto face_size = GetTextureCacheFaceSize(texture_cache_data, level);
+        for (std::uint32_t face = 0; face < texture_cache_data.face_count; ++face) {
+            glTexImage2D(cube_map ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : GL_TEXTURE_2D, level,
+                         internal_format, static_cast<GLsizei>(width),
+                         static_cast<GLsizei>(height), 0, format, type, data + offset);
+            offset += face_size;
+        }
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL,
+                    static_cast<GLint>(texture_cache_data.mip_count - 1));
+    bind.UnBind();
+    texture->SetMinFilter(proto::TextureFilter::LINEAR_MIPMAP_LINEAR);
+    return texture;
+}
+
+TextureCacheData GetTextureCacheData(const TextureInterface& texture,
+                                     std::uint32_t mip_count /* = 1*/) {
+    TextureCacheData texture_cache_data   = {};
+    texture_cache_data.pixel_element_size = texture.GetPixelElementSize();
+    texture_cache_data.pixel_structure    = texture.GetPixelStructure();
+    texture_cache_data.size               = texture.GetSize();
+    texture_cache_data.face_count         = texture.IsCubeMap() ? 6 : 1;
+    texture_cache_data.mip_count          = mip_count;
+    proto::PixelElementSize pixel_element_size;
+    pixel_element_size.set_value(texture_cache_data.pixel_element_size);
+    proto::PixelStructure pixel_structure;
+    pixel_structure.set_value(texture_cache_data.pixel_structure);
+    // Read back in the client format (half are read as float see ConvertToGLType).
+    const auto format              = ConvertToGLType(pixel_structure);
+    const auto type                = ConvertToGLType(pixel_element_size);
+    const auto& bind               = dynamic_cast<const BindInterface&>(texture);
+    const bool direct_state_access = IsDirectStateAccessSupported();
+    // Bind-to-read is only needed without direct state access.
+    std::optional<ScopedBind> scoped_bind;
+    if (!direct_state_access) scoped_bind.emplace(bind);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    for (std::uint32_t level = 0; level < mip_count; ++level) {
+        const auto face_size = GetTextureCacheFaceSize(texture_cache_data, level);
+        const auto offset    = texture_cache_data.data.size();
+        texture_cache_data.data.resize(offset + face_size * texture_cache_data.face_count);
+        auto* data = texture_cache_data.data.data() + offset;
+        if (direct_state_access) {
+            // All the faces of a level are read at once.
+            glGetTextureImage(bind.GetId(), static_cast<GLint>(level), format, type,
+                              static_cast<GLsizei>(face_size * texture_cache_data.face_count),
+                              data);
+            continue;
+        }
+        for (std::uint32_t face = 0; face < texture_cache_data.face_count; ++face) {
+            glGetTexImage(texture.IsCubeMap() ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face
+                                              : GL_TEXTURE_2D,
+                          static_cast<GLint>(level), format, type, data + face * face_size);
+        }
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    return texture_cache_data;
+}
+
 std::unique_ptr<TextureInterface> LoadTextureFromVec4(const glm::vec4& vec4) {
     std::array<float, 4> ar            = { vec4.x, vec4.y, vec4.z, vec4.w };
     TextureParameter texture_parameter = {
@@ -7,8 +7,11 @@
 #include <string>
 #include <vector>
 
+#include "frame/file/compressed_image.h"
+#include "frame/image_interface.h"
 #include "frame/json/parse_pixel.h"
 #include "frame/opengl/pixel.h"
+#include "frame/opengl/texture_cache.h"
 #include "frame/texture_interface.h"
 
 namespace frame::opengl::file {
@@ -26,7 +29,7 @@ std::unique_ptr<TextureInterface> LoadTextureFromVec4(const glm::vec4& vec4);
  */
 std::unique_ptr<TextureInterface> LoadTextureFromFloat(float f);
 /**
- * @brief Load texture from file (*.png).
+ * @brief Load texture from file (*.png, *.jpg, *.hdr or block compressed *.dds and *.ktx).
  * @param file: An image file (should be accessible from the current location).
  * @param pixel_element_size: Size of one of the element in a pixel (BYTE, SHORT, HALF, FLOAT).
  * @param pixel_element_structure: Structure of a pixel (R, RG, RGB, RGBA).
@@ -36,27 +39,61 @@ std::unique_ptr<TextureInterface> LoadTextureFromFile(
     const std::filesystem::path& file,
     proto::PixelElementSize pixel_element_size = proto::PixelElementSize_BYTE(),
     proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB());
+/**
+ * @brief Load texture from an already decoded image (see file::Image).
+ * @param image: A decoded image (the pixels are copied to the GPU).
+ * @return A unique pointer to the texture interface (or null in case of failure).
+ */
+std::unique_ptr<TextureInterface> LoadTextureFromImage(const ImageInterface& image);
+/**
+ * @brief Load texture from a block compressed image (see file::CompressedImage), if the context
+ * cannot sample the format BC1 to BC5 are decompressed on the CPU (first level only).
+ * @param compressed_image: A compressed image loaded from a DDS or KTX file.
+ * @return A unique pointer to the texture interface (or null in case of failure).
+ */
+std::unique_ptr<TextureInterface> LoadTextureFromCompressedImage(
+    const frame::file::CompressedImage& compressed_image);
 /**
  * @brief Load texture cube map from a file (*.hdr).
  * @param file: An image file (should be accessible from the current location).
  * @param pixel_element_size: Size of one of the element in a pixel (BYTE, SHORT, HALF, FLOAT).
  * @param pixel_element_structure: Structure of a pixel (R, RG, RGB, RGBA).
+ * @param source_hash[out]: If not null receive the hash of what the cube map is made from (0 if
+ * the texture cache is disabled), to key what is precomputed from it.
  * @return A unique pointer to the texture interface (or null in case of failure).
  */
 std::unique_ptr<TextureInterface> LoadCubeMapTextureFromFile(
     const std::filesystem::path& file,
     proto::PixelElementSize pixel_element_size = proto::PixelElementSize_BYTE(),
-    proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB());
+    proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB(),
+    std::uint64_t* source_hash                 = nullptr);
 /**
  * @brief Load texture from files.
  * @param files: 6 images files (should be accessible from the current location).
  * @param pixel_element_size: Size of one of the element in a pixel (BYTE, SHORT, HALF, FLOAT).
  * @param pixel_element_structure: Structure of a pixel (R, RG, RGB, RGBA).
+ * @param source_hash[out]: If not null receive the hash of the files (0 if the texture cache is
+ * disabled), to key what is precomputed from the cube map.
  * @return A unique pointer to the texture interface (or null in case of failure).
  */
 std::unique_ptr<TextureInterface> LoadCubeMapTextureFromFiles(
     const std::array<std::filesystem::path, 6>& files,
     proto::PixelElementSize pixel_element_size = proto::PixelElementSize_BYTE(),
-    proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB());
+    proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB(),
+    std::uint64_t* source_hash                 = nullptr);
+/**
+ * @brief Load a texture (2d or cube map) with its mip levels from the content of a cached texture.
+ * @param texture_cache_data: Content of the texture (see ReadTextureCacheFile).
+ * @return A unique pointer to the texture interface.
+ */
+std::unique_ptr<TextureInterface> LoadTextureFromCacheData(
+    const TextureCacheData& texture_cache_data);
+/**
+ * @brief Read back the content of a texture (2d or cube map) to be cached.
+ * @param texture: The texture to be read back (this wait for the GPU).
+ * @param mip_count: Number of mip levels to read back.
+ * @return The content of the texture (see WriteTextureCacheFile).
+ */
+TextureCacheData GetTextureCacheData(const TextureInterface& texture, std::uint32_t mip_count = 1);
 
 }  // namespace frame::opengl::file
@@ -1,14 +1,20 @@
 #include "fill.h"
 
+#include <algorithm>
 #include <fstream>
 #include <glm/ext/matrix_clip_space.hpp>
 #include <glm/ext/matrix_transform.hpp>
 
+#include "frame/file/cache_file.h"
 #include "frame/file/file_system.h"
 #include "frame/json/parse_level.h"
+#include "frame/logger.h"
+#include "frame/opengl/file/load_program.h"
+#include "frame/opengl/file/load_texture.h"
 #include "frame/opengl/material.h"
 #include "frame/opengl/renderer.h"
 #include "frame/opengl/static_mesh.h"
+#include "frame/opengl/texture_cache.h"
 #include "frame/opengl/texture_cube_map.h"
 #include "frame/proto/pixel.pb.h"
 
@@ -58,7 +64,8 @@ std::string FillLevel(const std::string& initial, const std::map<std::string, st
 }  // namespace
 
 std::unique_ptr<TextureInterface> FillIrradianceFromCubeMap(
-    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId irradiance_id) {
+    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId irradiance_id,
+    std::uint64_t source_hash /* = 0*/) {
     // Extract the already registered irradiance map to use it in the irradiance render level.
     auto irradiance = level.ExtractTexture(irradiance_id);
 
@@ -80,8 +87,37 @@ std::unique_ptr<TextureInterface> FillIrradianceFromCubeMap(
     // Now get it from external file.
     std::ifstream ifs(frame::file::FindFile("asset/json/irradiance.json").string());
     std::string inner_file_json((std::istreambuf_iterator<char>(ifs)), {});
-    auto irradiance_level =
-        frame::proto::ParseLevel(irradiance_size, FillLevel(inner_file_json, filling_map));
+    const auto irradiance_json = FillLevel(inner_file_json, filling_map);
+
+    // The irradiance is cached, keyed by the sources of the cube map and the irradiance level (and
+    // its shaders).
+    auto& logger               = Logger::GetInstance();
+    const auto cache_directory = frame::file::GetCacheDirectory("texture");
+    std::uint64_t hash         = 0;
+    std::filesystem::path cache_path;
+    if (!cache_directory.empty() && source_hash) {
+        const auto cube_map_description =
+            fmt::format("{}x{} {} {}", cube_map_size.x, cube_map_size.y,
+                        static_cast<int>(cube_map->GetPixelElementSize()),
+                        static_cast<int>(cube_map->GetPixelStructure()));
+        const auto program_source =
+            file::LoadProgramSourceFromName("irradiance_cubemap", "irradiance_cubemap",
+                                            "irradiance_cubemap");
+        hash       = frame::file::HashStrings({ cube_map_description, irradiance_json,
+                                                program_source.vertex, program_source.fragment },
+                                              source_hash);
+        cache_path =
+            frame::file::GetCachePath(cache_directory, original_irradiance_name, hash, ".ftex");
+        TextureCacheData texture_cache_data = {};
+        if (ReadTextureCacheFile(cache_path, hash, texture_cache_data)) {
+            logger->info("Load irradiance [{}] from cache.", original_irradiance_name);
+            auto cached_irradiance = file::LoadTextureFromCacheData(texture_cache_data);
+            cached_irradiance->SetName(original_irradiance_name);
+            level.AddTexture(std::move(cached_irradiance));
+            return std::move(cube_map);
+        }
+    }
+    auto irradiance_level = frame::proto::ParseLevel(irradiance_size, irradiance_json);
     if (!irradiance_level) {
         throw std::runtime_error(
             "Could not parse the irradiance_level from the json file in order to pre-compute the "
@@ -114,12 +150,162 @@ std::unique_ptr<TextureInterface> FillIrradianceFromCubeMap(
     auto filled_irradiance =
         irradiance_level->ExtractTexture(irradiance_level->GetIdFromName("IrradianceMap"));
     filled_irradiance->SetName(original_irradiance_name);
+    if (hash) {
+        try {
+            WriteTextureCacheFile(cache_path, hash, file::GetTextureCacheData(*filled_irradiance));
+        } catch (const std::runtime_error& e) {
+            logger->warn("Could not cache irradiance [{}]: {}", original_irradiance_name,
+                         e.what());
+        }
+    }
     level.AddTexture(std::move(filled_irradiance));
     auto used_cube_map = irradiance_level->ExtractTexture(new_cube_map_id);
     used_cube_map->SetName(original_cube_map_name);
     return std::move(used_cube_map);
 }
 
+std::unique_ptr<TextureInterface> FillPrefilterFromCubeMap(
+    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId prefilter_id,
+    std::uint32_t mip_count, std::uint32_t sample_count, std::uint64_t source_hash /* = 0*/) {
+    // Extract the already registered prefilter map to use it in the prefilter render level.
+    auto prefilter = level.ExtractTexture(prefilter_id);
+
+    auto original_prefilter_name = prefilter->GetName();
+    auto original_cube_map_name  = cube_map->GetName();
+
+    // Values to replace in the level json.
+    auto cube_map_size                             = cube_map->GetSize();
+    auto prefilter_size                            = prefilter->GetSize();
+    std::map<std::string, std::string> filling_map = {
+        { "<prefilter.x>", std::to_string(prefilter_size.x) },
+        { "<prefilter.y>", std::to_string(prefilter_size.y) },
+        { "<prefilter.pixel_element_size>",
+          proto::PixelElementSize_Enum_Name(prefilter->GetPixelElementSize()) },
+        { "<prefilter.pixel_structure>",
+          proto::PixelStructure_Enum_Name(prefilter->GetPixelStructure()) }
+    };
+    // The last level can't be smaller than a texel.
+    const auto level_count = [](glm::uvec2 size) {
+        std::uint32_t count = 1;
+        for (auto side = std::max(size.x, size.y); side > 1; side >>= 1) ++count;
+        return count;
+    };
+    mip_count                            = std::clamp(mip_count, 1u, level_count(prefilter_size));
+    const std::uint32_t source_mip_count = level_count(cube_map_size);
+
+    // Now get it from external file.
+    std::ifstream ifs(frame::file::FindFile("asset/json/prefilter.json").string());
+    std::string inner_file_json((std::istreambuf_iterator<char>(ifs)), {});
+    const auto prefilter_json = FillLevel(inner_file_json, filling_map);
+
+    // The prefilter is cached, keyed by the sources of the cube map and the prefilter level (and
+    // its shaders).
+    auto& logger               = Logger::GetInstance();
+    const auto cache_directory = frame::file::GetCacheDirectory("texture");
+    std::uint64_t hash         = 0;
+    std::filesystem::path cache_path;
+    if (!cache_directory.empty() && source_hash) {
+        const auto prefilter_description =
+            fmt::format("{}x{} {} {} mip {} sample {}", cube_map_size.x, cube_map_size.y,
+                        static_cast<int>(cube_map->GetPixelElementSize()),
+                        static_cast<int>(cube_map->GetPixelStructure()), mip_count, sample_count);
+        const auto program_source = file::LoadProgramSourceFromName(
+            "monte_carlo_prefilter", "monte_carlo_prefilter", "monte_carlo_prefilter");
+        hash       = frame::file::HashStrings({ prefilter_description, prefilter_json,
+                                                program_source.vertex, program_source.fragment },
+                                              source_hash);
+        cache_path =
+            frame::file::GetCachePath(cache_directory, original_prefilter_name, hash, ".ftex");
+        TextureCacheData texture_cache_data = {};
+        if (ReadTextureCacheFile(cache_path, hash, texture_cache_data)) {
+            logger->info("Load prefilter [{}] from cache.", original_prefilter_name);
+            auto cached_prefilter = file::LoadTextureFromCacheData(texture_cache_data);
+            cached_prefilter->SetName(original_prefilter_name);
+            level.AddTexture(std::move(cached_prefilter));
+            return std::move(cube_map);
+        }
+    }
+
+    // The source is read from its mip levels (filtered importance sampling), this is what allows
+    // a low sample count without aliasing.
+    auto& gl_cube_map = dynamic_cast<TextureCubeMap&>(*cube_map);
+    gl_cube_map.Bind();
+    gl_cube_map.EnableMipmap();
+    gl_cube_map.UnBind();
+    gl_cube_map.SetMinFilter(proto::TextureFilter::LINEAR_MIPMAP_LINEAR);
+
+    auto prefilter_level = frame::proto::ParseLevel(prefilter_size, prefilter_json);
+    if (!prefilter_level) {
+        throw std::runtime_error(
+            "Could not parse the prefilter_level from the json file in order to pre-compute the "
+            "IBL.");
+    }
+
+    // Add the texture to the level.
+    cube_map->SetName("CubeMap");
+    auto new_cube_map_id = prefilter_level->AddTexture(std::move(cube_map));
+
+    auto material_id = prefilter_level->GetIdFromName("PrefilterMaterial");
+    if (!material_id) throw std::runtime_error("No material id found for [PrefilterMaterial].");
+    MaterialInterface& material_ref = prefilter_level->GetMaterialFromId(material_id);
+    material_ref.AddTextureId(new_cube_map_id, "Environment");
+
+    // Allocate the mip levels of the prefilter map.
+    auto prefilter_map_id = prefilter_level->GetIdFromName("PrefilterMap");
+    auto& gl_prefilter =
+        dynamic_cast<TextureCubeMap&>(prefilter_level->GetTextureFromId(prefilter_map_id));
+    gl_prefilter.Bind();
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mip_count - 1));
+    gl_prefilter.EnableMipmap();
+    gl_prefilter.UnBind();
+    gl_prefilter.SetMinFilter(proto::TextureFilter::LINEAR_MIPMAP_LINEAR);
+
+    auto& program =
+        prefilter_level->GetProgramFromId(material_ref.GetProgramId(prefilter_level.get()));
+    program.Use();
+    program.Uniform("sample_count", static_cast<int>(std::max(sample_count, 1u)));
+    program.Uniform("source_resolution", static_cast<float>(cube_map_size.x));
+    program.Uniform("source_mip_count", static_cast<float>(source_mip_count));
+    program.UnUse();
+
+    Renderer renderer(*prefilter_level.get(), { 0, 0, prefilter_size.x, prefilter_size.y });
+    auto& mesh_ref =
+        prefilter_level->GetStaticMeshFromId(prefilter_level->GetDefaultStaticMeshCubeId());
+    renderer.FakeMesh(mesh_ref, material_ref, projection_cubemap, views_cubemap[0]);
+    for (std::uint32_t mip_level = 0; mip_level < mip_count; ++mip_level) {
+        // One roughness per level, from a mirror to a fully rough surface.
+        const float roughness =
+            (mip_count > 1) ? static_cast<float>(mip_level) / static_cast<float>(mip_count - 1)
+                            : 0.0f;
+        program.Use();
+        program.Uniform("roughness", roughness);
+        program.UnUse();
+        renderer.SetViewport({ 0, 0, std::max(prefilter_size.x >> mip_level, 1u),
+                               std::max(prefilter_size.y >> mip_level, 1u) });
+        renderer.SetMipmapTarget(static_cast<int>(mip_level));
+        for (std::uint32_t i = 0; i < 6; ++i) {
+            renderer.SetCubeMapTarget(GetTextureFrameFromPosition(i));
+            renderer.RenderMesh(mesh_ref, material_ref, projection_cubemap, views_cubemap[i]);
+        }
+    }
+
+    // Put back the prefilter map in the original level.
+    auto filled_prefilter = prefilter_level->ExtractTexture(prefilter_map_id);
+    filled_prefilter->SetName(original_prefilter_name);
+    if (hash) {
+        try {
+            WriteTextureCacheFile(cache_path, hash,
+                                  file::GetTextureCacheData(*filled_prefilter, mip_count));
+        } catch (const std::runtime_error& e) {
+            logger->warn("Could not cache prefilter [{}]: {}", original_prefilter_name, e.what());
+        }
+    }
+    level.AddTexture(std::move(filled_prefilter));
+    auto used_cube_map = prefilter_level->ExtractTexture(new_cube_map_id);
+    used_cube_map->SetName(original_cube_map_name);
+    return std::move(used_cube_map);
+}
+
 // THIS IS BROKEN
 // In case this is needed you should fix it!
 
@@ -13,10 +13,29 @@ namespace frame::opengl {
  *
  * @param cube_map: The cube map to be used.
  * @param irradiance_id: The irradiance id of the map to fill.
+ * @param source_hash: Hash of what the cube map is made from (see LoadCubeMapTextureFromFile),
+ * the irradiance is only cached if it isn't 0.
  * @return The cube map.
  */
 std::unique_ptr<TextureInterface> FillIrradianceFromCubeMap(
-    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId irradiance_id);
+    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId irradiance_id,
+    std::uint64_t source_hash = 0);
+
+/**
+ * @brief Renders the prefiltered specular map from a cube map, every mip level is the cube map
+ * convolved with the GGX lobe of a roughness (0 for the first level to 1 for the last one).
+ *
+ * @param cube_map: The cube map to be used (mipmaps are generated for the filtered sampling).
+ * @param prefilter_id: The id of the cube map to fill (its size is the one of the first level).
+ * @param mip_count: Number of mip levels to fill.
+ * @param sample_count: Number of samples per texel.
+ * @param source_hash: Hash of what the cube map is made from (see LoadCubeMapTextureFromFile),
+ * the prefilter is only cached if it isn't 0.
+ * @return The cube map.
+ */
+std::unique_ptr<TextureInterface> FillPrefilterFromCubeMap(
+    Level& level, std::unique_ptr<TextureInterface>&& cube_map, EntityId prefilter_id,
+    std::uint32_t mip_count, std::uint32_t sample_count, std::uint64_t source_hash = 0);
 
 // THIS IS BROKEN
 // In case this is needed you should fix it!
@@ -6,11 +6,18 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "frame/opengl/pixel.h"
 #include "texture.h"
 
 namespace frame::opengl {
 
-FrameBuffer::FrameBuffer() { glGenFramebuffers(1, &frame_id_); }
+FrameBuffer::FrameBuffer() {
+    if (IsDirectStateAccessSupported()) {
+        glCreateFramebuffers(1, &frame_id_);
+    } else {
+        glGenFramebuffers(1, &frame_id_);
+    }
+}
 
 FrameBuffer::~FrameBuffer() { glDeleteFramebuffers(1, &frame_id_); }
 
@@ -26,6 +33,15 @@ void FrameBuffer::UnBind() const {
 }
 
 void FrameBuffer::AttachRender(const RenderBuffer& render) const {
+    if (IsDirectStateAccessSupported()) {
+        glNamedFramebufferRenderbuffer(frame_id_, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER,
+                                       render.GetId());
+        if (glCheckNamedFramebufferStatus(frame_id_, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            auto error_pair = GetError();
+            throw std::runtime_error(fmt::format("{} - {}", error_pair.first, error_pair.second));
+        }
+        return;
+    }
     Bind();
     render.Bind();
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, render.GetId());
@@ -45,6 +61,18 @@ void FrameBuffer::AttachTexture(unsigned int texture_id,
                                         FrameTextureType::TEXTURE_2D*/
                                 ,
                                 const int mipmap /*= 0*/) const {
+    if (IsDirectStateAccessSupported()) {
+        // The faces of a cube map are its layers.
+        if (frame_texture_type == FrameTextureType::TEXTURE_2D) {
+            glNamedFramebufferTexture(frame_id_, static_cast<GLenum>(frame_color_attachment),
+                                      texture_id, mipmap);
+        } else {
+            glNamedFramebufferTextureLayer(frame_id_, static_cast<GLenum>(frame_color_attachment),
+                                           texture_id, mipmap,
+                                           static_cast<GLint>(frame_texture_type));
+        }
+        return;
+    }
     Bind();
     glFramebufferTexture2D(GL_FRAMEBUFFER, static_cast<GLenum>(frame_color_attachment),
                            GetFrameTextureType(frame_texture_type), texture_id, mipmap);
@@ -109,22 +137,32 @@ frame::opengl::FrameTextureType FrameBuffer::GetFrameTextureType(
 }
 
 void FrameBuffer::DrawBuffers(const std::uint32_t size /*= 1*/) {
-    Bind();
     assert(size < 9);
     std::vector<unsigned int> draw_buffer = {};
     for (std::uint32_t i = 0; i < size; ++i) {
         draw_buffer.emplace_back(
             static_cast<unsigned int>(FrameBuffer::GetFrameColorAttachment(i)));
     }
+    if (IsDirectStateAccessSupported()) {
+        glNamedFramebufferDrawBuffers(frame_id_, static_cast<GLsizei>(draw_buffer.size()),
+                                      draw_buffer.data());
+        return;
+    }
+    Bind();
     glDrawBuffers(static_cast<GLsizei>(draw_buffer.size()), draw_buffer.data());
     UnBind();
 }
 
 const std::pair<bool, std::string> FrameBuffer::GetError() const {
-    Bind();
     std::pair<bool, std::string> status_error;
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-    UnBind();
+    GLenum status = GL_FRAMEBUFFER_COMPLETE;
+    if (IsDirectStateAccessSupported()) {
+        status = glCheckNamedFramebufferStatus(frame_id_, GL_FRAMEBUFFER);
+    } else {
+        Bind();
+        status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        UnBind();
+    }
     switch (status) {
         case GL_FRAMEBUFFER_COMPLETE:
             status_error.second = "no error";
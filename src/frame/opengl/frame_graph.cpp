@@ -0,0 +1,163 @@
+#include "frame/opengl/frame_graph.h"
+
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <utility>
+
+namespace frame::opengl {
+
+void FrameGraph::Compile(const std::vector<DrawItem>& draw_items,
+                         const std::vector<EntityId>& root_ids,
+                         const std::map<EntityId, std::size_t>& transient_classes /* = {}*/) {
+    draw_items_.clear();
+    culled_count_ = 0;
+    texture_slots_.clear();
+    slot_classes_.clear();
+    auto segment_begin = draw_items.cbegin();
+    for (auto it = draw_items.cbegin(); it != draw_items.cend(); ++it) {
+        // A clear event is a barrier on its own.
+        if (it->mesh_id != NullId) continue;
+        Schedule(segment_begin, it);
+        draw_items_.push_back(*it);
+        segment_begin = std::next(it);
+    }
+    Schedule(segment_begin, draw_items.cend());
+    Cull(root_ids);
+    // The root textures are used after the frame so they never share their memory.
+    auto alias_classes = transient_classes;
+    for (const auto id : root_ids) alias_classes.erase(id);
+    Alias(alias_classes);
+}
+
+void FrameGraph::Schedule(std::vector<DrawItem>::const_iterator begin,
+                          std::vector<DrawItem>::const_iterator end) {
+    const auto count = static_cast<std::size_t>(std::distance(begin, end));
+    if (!count) return;
+    std::vector<std::set<std::size_t>> successors(count);
+    std::vector<std::size_t> predecessor_counts(count, 0);
+    auto add_edge = [&successors, &predecessor_counts](std::size_t from, std::size_t to) {
+        if (from != to && successors[from].insert(to).second) ++predecessor_counts[to];
+    };
+    // A texture is written by all its writers (in submission order) before it is read.
+    std::map<EntityId, std::vector<std::size_t>> writers;
+    for (std::size_t i = 0; i < count; ++i) {
+        for (const auto id : (begin + i)->output_ids) {
+            auto& texture_writers = writers[id];
+            if (!texture_writers.empty()) add_edge(texture_writers.back(), i);
+            texture_writers.push_back(i);
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& draw_item = *(begin + i);
+        for (const auto id : draw_item.input_ids) {
+            auto it = writers.find(id);
+            if (it == writers.end()) continue;
+            // A pass reading its own output is a feedback loop, it keeps its place.
+            if (std::find(draw_item.output_ids.cbegin(), draw_item.output_ids.cend(), id) !=
+                draw_item.output_ids.cend()) {
+                continue;
+            }
+            add_edge(it->second.back(), i);
+        }
+    }
+    // Ready items ordered by state so that the same state is drawn in a row when possible.
+    auto state_less = [begin](std::size_t left, std::size_t right) {
+        const auto& l = *(begin + left);
+        const auto& r = *(begin + right);
+        return std::tie(l.output_ids, l.program_id, l.material_id, l.mesh_id, left) <
+               std::tie(r.output_ids, r.program_id, r.material_id, r.mesh_id, right);
+    };
+    std::set<std::size_t, decltype(state_less)> ready(state_less);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!predecessor_counts[i]) ready.insert(i);
+    }
+    std::vector<bool> scheduled(count, false);
+    std::size_t last = count;
+    for (std::size_t scheduled_count = 0; scheduled_count < count; ++scheduled_count) {
+        if (ready.empty()) {
+            // Cycle between passes (reading each other outputs), break it in submission order.
+            std::size_t first = 0;
+            while (scheduled[first] || predecessor_counts[first] == 0) ++first;
+            predecessor_counts[first] = 0;
+            ready.insert(first);
+        }
+        // Continue with the state of the previous item, or the next one in state order.
+        auto it = (last == count) ? ready.end() : ready.lower_bound(last);
+        if (it == ready.end()) it = ready.begin();
+        last = *it;
+        ready.erase(it);
+        scheduled[last] = true;
+        draw_items_.push_back(*(begin + last));
+        for (const auto successor : successors[last]) {
+            if (scheduled[successor] || !predecessor_counts[successor]) continue;
+            if (!--predecessor_counts[successor]) ready.insert(successor);
+        }
+    }
+}
+
+void FrameGraph::Cull(const std::vector<EntityId>& root_ids) {
+    // Walk back from the end: an item is needed if it writes a needed texture, then what it
+    // reads is needed too.
+    std::set<EntityId> needed_ids(root_ids.cbegin(), root_ids.cend());
+    std::vector<DrawItem> kept_items;
+    kept_items.reserve(draw_items_.size());
+    for (auto it = draw_items_.rbegin(); it != draw_items_.rend(); ++it) {
+        const bool needed =
+            it->mesh_id == NullId ||
+            std::any_of(it->output_ids.cbegin(), it->output_ids.cend(),
+                        [&needed_ids](EntityId id) { return needed_ids.count(id) != 0; });
+        if (!needed) {
+            ++culled_count_;
+            continue;
+        }
+        needed_ids.insert(it->input_ids.cbegin(), it->input_ids.cend());
+        kept_items.push_back(std::move(*it));
+    }
+    std::reverse(kept_items.begin(), kept_items.end());
+    draw_items_ = std::move(kept_items);
+}
+
+void FrameGraph::Alias(const std::map<EntityId, std::size_t>& transient_classes) {
+    // First and last position of every transient texture in the schedule.
+    std::map<EntityId, std::pair<std::size_t, std::size_t>> lifetimes;
+    auto use = [&lifetimes, &transient_classes](EntityId id, std::size_t position) {
+        if (!transient_classes.count(id)) return;
+        auto it = lifetimes.find(id);
+        if (it == lifetimes.end()) {
+            lifetimes.emplace(id, std::make_pair(position, position));
+        } else {
+            it->second.second = position;
+        }
+    };
+    for (std::size_t i = 0; i < draw_items_.size(); ++i) {
+        for (const auto id : draw_items_[i].input_ids) use(id, i);
+        for (const auto id : draw_items_[i].output_ids) use(id, i);
+    }
+    std::vector<std::pair<EntityId, std::pair<std::size_t, std::size_t>>> sorted_lifetimes(
+        lifetimes.cbegin(), lifetimes.cend());
+    std::sort(sorted_lifetimes.begin(), sorted_lifetimes.end(),
+              [](const auto& left, const auto& right) {
+                  return std::tie(left.second.first, left.first) <
+                         std::tie(right.second.first, right.first);
+              });
+    // Greedy interval allocation, a slot is reused once its last texture is dead.
+    std::vector<std::size_t> slot_ends;
+    for (const auto& [id, lifetime] : sorted_lifetimes) {
+        const auto texture_class = transient_classes.at(id);
+        std::size_t slot         = 0;
+        while (slot < slot_classes_.size() &&
+               (slot_classes_[slot] != texture_class || slot_ends[slot] >= lifetime.first)) {
+            ++slot;
+        }
+        if (slot == slot_classes_.size()) {
+            slot_classes_.push_back(texture_class);
+            slot_ends.push_back(lifetime.second);
+        } else {
+            slot_ends[slot] = lifetime.second;
+        }
+        texture_slots_.emplace(id, slot);
+    }
+}
+
+}  // End namespace frame::opengl.
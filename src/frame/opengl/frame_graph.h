@@ -0,0 +1,74 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "frame/entity_id.h"
+#include "frame/opengl/render_queue.h"
+
+namespace frame::opengl {
+
+/**
+ * @class FrameGraph
+ * @brief Schedule the draw items of a frame from the textures they read and write: the passes are
+ * ordered so that a texture is written before it is read, the passes that do not contribute to the
+ * root textures are culled and the transient textures whose lifetimes do not overlap share the same
+ * slot (memory).
+ * @warning A transient texture is only valid inside the frame, it should never be read before it
+ * is written in the frame (no feedback from the previous frame).
+ */
+class FrameGraph {
+   public:
+    /**
+     * @brief Build the schedule of a frame.
+     * @param draw_items: Draw items in submission order (clear events stay where they are and the
+     * items are never moved across them).
+     * @param root_ids: Textures that should be produced (usually the default output texture).
+     * @param transient_classes: Transient textures with their compatibility class, only the
+     * textures of the same class (same size and format) can share a slot.
+     */
+    void Compile(const std::vector<DrawItem>& draw_items, const std::vector<EntityId>& root_ids,
+                 const std::map<EntityId, std::size_t>& transient_classes = {});
+    /**
+     * @brief Get the scheduled draw items (culled ones removed).
+     * @return The draw items in the order they should be submitted.
+     */
+    const std::vector<DrawItem>& GetDrawItems() const { return draw_items_; }
+    /**
+     * @brief Get the number of draw items culled by the last compile.
+     * @return Number of culled draw items.
+     */
+    std::size_t GetCulledCount() const { return culled_count_; }
+    /**
+     * @brief Get the slot of every transient texture used in the frame.
+     * @return Map of transient texture id to slot index.
+     */
+    const std::map<EntityId, std::size_t>& GetTextureSlots() const { return texture_slots_; }
+    /**
+     * @brief Get the compatibility class of every slot.
+     * @return Class of the slots (the index is the slot index).
+     */
+    const std::vector<std::size_t>& GetSlotClasses() const { return slot_classes_; }
+
+   protected:
+    /**
+     * @brief Order a range of draw items (without clear event) by their dependencies, the items
+     * with the same state are kept together when possible.
+     * @param begin: First item of the range.
+     * @param end: Item after the last of the range.
+     */
+    void Schedule(std::vector<DrawItem>::const_iterator begin,
+                  std::vector<DrawItem>::const_iterator end);
+    //! @brief Remove the draw items that do not contribute to the root textures.
+    void Cull(const std::vector<EntityId>& root_ids);
+    //! @brief Assign the slots of the transient textures from their lifetimes.
+    void Alias(const std::map<EntityId, std::size_t>& transient_classes);
+
+   private:
+    std::vector<DrawItem> draw_items_              = {};
+    std::size_t culled_count_                      = 0;
+    std::map<EntityId, std::size_t> texture_slots_ = {};
+    std::vector<std::size_t> slot_classes_         = {};
+};
+
+}  // End namespace frame::opengl.
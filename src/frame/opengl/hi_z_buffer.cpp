@@ -0,0 +1,175 @@
+#include "frame/opengl/hi_z_buffer.h"
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "frame/opengl/file/load_program.h"
+
+namespace frame::opengl {
+
+HiZBuffer::HiZBuffer() {
+    downsample_program_ = file::LoadProgramFromName("hi_z_downsample");
+    box_program_        = file::LoadProgramFromName("hi_z_box");
+    if (!downsample_program_ || !box_program_) {
+        throw std::runtime_error("Could not load the hierarchical depth programs.");
+    }
+    glGenFramebuffers(1, &frame_buffer_id_);
+    glGenVertexArrays(1, &vertex_array_id_);
+    // Only the depth attachment is used.
+    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_id_);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+HiZBuffer::~HiZBuffer() {
+    if (fence_) glDeleteSync(static_cast<GLsync>(fence_));
+    if (!query_ids_.empty()) {
+        glDeleteQueries(static_cast<GLsizei>(query_ids_.size()), query_ids_.data());
+    }
+    glDeleteBuffers(1, &pixel_pack_buffer_id_);
+    glDeleteTextures(1, &texture_id_);
+    glDeleteVertexArrays(1, &vertex_array_id_);
+    glDeleteFramebuffers(1, &frame_buffer_id_);
+}
+
+void HiZBuffer::CreateStorage(glm::uvec2 size) {
+    size_ = size;
+    level_sizes_.clear();
+    level_sizes_.push_back(size);
+    while (size.x > max_readback_size_ || size.y > max_readback_size_) {
+        size = glm::uvec2(std::max(1u, size.x / 2), std::max(1u, size.y / 2));
+        level_sizes_.push_back(size);
+    }
+    const auto readback_level = static_cast<GLint>(level_sizes_.size() - 1);
+    glDeleteTextures(1, &texture_id_);
+    glGenTextures(1, &texture_id_);
+    glBindTexture(GL_TEXTURE_2D, texture_id_);
+    for (GLint level = 0; level <= readback_level; ++level) {
+        glTexImage2D(GL_TEXTURE_2D, level, GL_DEPTH_COMPONENT32, level_sizes_[level].x,
+                     level_sizes_[level].y, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, readback_level);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    const glm::uvec2 readback_size = level_sizes_.back();
+    if (!pixel_pack_buffer_id_) glGenBuffers(1, &pixel_pack_buffer_id_);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_pack_buffer_id_);
+    glBufferData(GL_PIXEL_PACK_BUFFER,
+                 static_cast<GLsizeiptr>(readback_size.x) * readback_size.y * sizeof(float),
+                 nullptr, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void HiZBuffer::Build(unsigned int frame_buffer_id, glm::uvec2 size) {
+    // The GPU levels are only used for the readback.
+    if (fence_) return;
+    if (size.x != size_.x || size.y != size_.y) CreateStorage(size);
+    // Copy the depth in the first level (same format as the render buffer).
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, frame_buffer_id);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, frame_buffer_id_);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture_id_, 0);
+    glBlitFramebuffer(0, 0, size.x, size.y, 0, 0, size.x, size.y, GL_DEPTH_BUFFER_BIT,
+                      GL_NEAREST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    // The depth is only written with the depth test enabled.
+    const GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_ALWAYS);
+    glDepthMask(GL_TRUE);
+    downsample_program_->Use();
+    downsample_program_->Uniform("Depth", 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, texture_id_);
+    glBindVertexArray(vertex_array_id_);
+    for (std::size_t level = 1; level < level_sizes_.size(); ++level) {
+        // Only the previous level can be read (no feedback loop with the level written).
+        const auto previous_level = static_cast<GLint>(level - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, previous_level);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, previous_level);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                               texture_id_, static_cast<GLint>(level));
+        downsample_program_->Uniform("previous_size", glm::vec2(level_sizes_[level - 1].x,
+                                                                level_sizes_[level - 1].y));
+        glViewport(0, 0, level_sizes_[level].x, level_sizes_[level].y);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    const auto readback_level = static_cast<GLint>(level_sizes_.size() - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, readback_level);
+    // With a pack buffer bound the copy is queued and the pointer is an offset in the buffer.
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_pack_buffer_id_);
+    glGetTexImage(GL_TEXTURE_2D, readback_level, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    downsample_program_->UnUse();
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDepthFunc(GL_LESS);
+    if (!depth_test) glDisable(GL_DEPTH_TEST);
+}
+
+void HiZBuffer::Poll() {
+    if (!fence_) return;
+    const GLenum result = glClientWaitSync(static_cast<GLsync>(fence_), 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) return;
+    glDeleteSync(static_cast<GLsync>(fence_));
+    fence_ = nullptr;
+    if (result == GL_WAIT_FAILED) {
+        logger_->warn("Hierarchical depth readback fence failed.");
+        return;
+    }
+    const glm::uvec2 readback_size = level_sizes_.back();
+    std::vector<float> depths(static_cast<std::size_t>(readback_size.x) * readback_size.y);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pixel_pack_buffer_id_);
+    const void* mapping =
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0,
+                         static_cast<GLsizeiptr>(depths.size() * sizeof(float)), GL_MAP_READ_BIT);
+    if (mapping) {
+        std::memcpy(depths.data(), mapping, depths.size() * sizeof(float));
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (!mapping) {
+        logger_->warn("Could not map the hierarchical depth readback buffer.");
+        return;
+    }
+    pyramid_.Build(std::move(depths), readback_size);
+}
+
+void HiZBuffer::BeginConditionalDraw(const BoundingVolume& bounding_volume,
+                                     const glm::mat4& view_projection) {
+    if (query_index_ == query_ids_.size()) {
+        query_ids_.push_back(0);
+        glGenQueries(1, &query_ids_.back());
+    }
+    const GLuint query_id = query_ids_[query_index_++];
+    box_program_->Use();
+    box_program_->Uniform("view_projection", view_projection);
+    box_program_->Uniform("box_min", bounding_volume.min);
+    box_program_->Uniform("box_max", bounding_volume.max);
+    glBindVertexArray(vertex_array_id_);
+    // Test the box against the depth without touching anything.
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glDepthMask(GL_FALSE);
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, query_id);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glDepthMask(GL_TRUE);
+    // The GPU waits for the result, the CPU doesn't.
+    glBeginConditionalRender(query_id, GL_QUERY_WAIT);
+}
+
+void HiZBuffer::EndConditionalDraw() { glEndConditionalRender(); }
+
+}  // End namespace frame::opengl.
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+#include "frame/bounding_volume.h"
+#include "frame/hi_z_pyramid.h"
+#include "frame/logger.h"
+#include "frame/program_interface.h"
+
+namespace frame::opengl {
+
+/**
+ * @class HiZBuffer
+ * @brief Hierarchical depth buffer built on the GPU: the depth of a frame buffer is copied in a
+ * texture and reduced level by level (farthest of the texels below) by a fragment shader, down to
+ * a small level that is read back asynchronously in a HiZPyramid (so the CPU always test against
+ * the depth of a previous frame). It also re-test volumes against the depth of the current frame
+ * with occlusion queries and conditional rendering. All the calls should be made from the GL
+ * thread.
+ */
+class HiZBuffer {
+   public:
+    //! @brief Constructor load the programs and create the GL objects.
+    HiZBuffer();
+    //! @brief Destructor free the GL objects (a pending readback is lost).
+    ~HiZBuffer();
+    HiZBuffer(const HiZBuffer&)            = delete;
+    HiZBuffer& operator=(const HiZBuffer&) = delete;
+
+   public:
+    /**
+     * @brief Copy the depth of a frame buffer, reduce it and request the readback of the coarse
+     * level, nothing is done while the previous readback is pending. This leave the default
+     * frame buffer, no program and no vertex array bound.
+     * @param frame_buffer_id: Frame buffer with a depth attachment.
+     * @param size: Size of the depth attachment.
+     */
+    void Build(unsigned int frame_buffer_id, glm::uvec2 size);
+    //! @brief Land the readback in the pyramid if the GPU is done, never wait (once per frame).
+    void Poll();
+    /**
+     * @brief Get the pyramid of the last readback.
+     * @return The CPU pyramid (not valid until the first readback landed).
+     */
+    const HiZPyramid& GetPyramid() const { return pyramid_; }
+    //! @brief Reuse the occlusion queries from the beginning (once per frame).
+    void ResetQueries() { query_index_ = 0; }
+    /**
+     * @brief Draw the box of a volume against the bound depth buffer in an occlusion query and
+     * start a conditional rendering on the result: the draws until EndConditionalDraw happen only
+     * if a sample of the box passed the depth test. This change the program and vertex array.
+     * @param bounding_volume: World volume to be tested.
+     * @param view_projection: Projection times view of the camera.
+     */
+    void BeginConditionalDraw(const BoundingVolume& bounding_volume,
+                              const glm::mat4& view_projection);
+    //! @brief End the conditional rendering started by BeginConditionalDraw.
+    void EndConditionalDraw();
+
+   protected:
+    /**
+     * @brief Create the texture and the pixel pack buffer for a depth size, the readback level is
+     * the first that fit in the readback size.
+     * @param size: Size of the depth attachment.
+     */
+    void CreateStorage(glm::uvec2 size);
+
+   private:
+    // Maximum size of the level read back (the CPU compute the coarser levels).
+    static constexpr std::uint32_t max_readback_size_     = 256;
+    std::unique_ptr<ProgramInterface> downsample_program_ = nullptr;
+    std::unique_ptr<ProgramInterface> box_program_        = nullptr;
+    unsigned int frame_buffer_id_                         = 0;
+    unsigned int texture_id_                              = 0;
+    // Empty vertex array, the vertices are generated in the shaders.
+    unsigned int vertex_array_id_        = 0;
+    glm::uvec2 size_                     = glm::uvec2(0);
+    std::vector<glm::uvec2> level_sizes_ = {};
+    unsigned int pixel_pack_buffer_id_   = 0;
+    void* fence_                         = nullptr;
+    std::vector<unsigned int> query_ids_ = {};
+    std::size_t query_index_             = 0;
+    HiZPyramid pyramid_                  = {};
+    Logger& logger_                      = Logger::GetInstance();
+};
+
+}  // End namespace frame::opengl.
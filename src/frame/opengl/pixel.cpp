@@ -126,4 +126,56 @@ GLenum ConvertToGLType(const frame::proto::PixelElementSize& pixel_element_size,
     }
 }
 
+GLenum ConvertToGLType(frame::file::CompressedFormatEnum compressed_format) {
+    switch (compressed_format) {
+        case frame::file::CompressedFormatEnum::BC1:
+            return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case frame::file::CompressedFormatEnum::BC3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case frame::file::CompressedFormatEnum::BC4:
+            return GL_COMPRESSED_RED_RGTC1;
+        case frame::file::CompressedFormatEnum::BC5:
+            return GL_COMPRESSED_RG_RGTC2;
+        case frame::file::CompressedFormatEnum::BC7:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case frame::file::CompressedFormatEnum::ETC2_RGB:
+            return GL_COMPRESSED_RGB8_ETC2;
+        case frame::file::CompressedFormatEnum::ETC2_RGBA:
+            return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        default:
+            throw std::runtime_error("unknown compressed format : " +
+                                     std::to_string(static_cast<int>(compressed_format)));
+    }
+}
+
+bool IsCompressedFormatSupported(frame::file::CompressedFormatEnum compressed_format) {
+    switch (compressed_format) {
+        case frame::file::CompressedFormatEnum::BC1:
+        case frame::file::CompressedFormatEnum::BC3:
+            return GLEW_EXT_texture_compression_s3tc;
+        case frame::file::CompressedFormatEnum::BC4:
+        case frame::file::CompressedFormatEnum::BC5:
+            return GLEW_VERSION_3_0 || GLEW_ARB_texture_compression_rgtc;
+        case frame::file::CompressedFormatEnum::BC7:
+            return GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc;
+        case frame::file::CompressedFormatEnum::ETC2_RGB:
+        case frame::file::CompressedFormatEnum::ETC2_RGBA:
+            return GLEW_VERSION_4_3 || GLEW_ARB_ES3_compatibility;
+        default:
+            return false;
+    }
+}
+
+float GetMaxSupportedAnisotropy() {
+    if (!GLEW_VERSION_4_6 && !GLEW_ARB_texture_filter_anisotropic &&
+        !GLEW_EXT_texture_filter_anisotropic) {
+        return 1.0f;
+    }
+    GLfloat max_anisotropy = 1.0f;
+    glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &max_anisotropy);
+    return max_anisotropy;
+}
+
+bool IsDirectStateAccessSupported() { return GLEW_VERSION_4_5 || GLEW_ARB_direct_state_access; }
+
 }  // End namespace frame::opengl.
@@ -2,6 +2,7 @@
 
 #include <GL/glew.h>
 
+#include "frame/file/compressed_image.h"
 #include "frame/json/proto.h"
 
 namespace frame::opengl {
@@ -26,5 +27,27 @@ GLenum ConvertToGLType(const frame::proto::PixelStructure& pixel_structure);
  */
 GLenum ConvertToGLType(const frame::proto::PixelElementSize& pixel_element_size,
                        const frame::proto::PixelStructure& pixel_structure);
+/**
+ * @brief Get the GL_COMPRESSED_RGBA_S3TC_DXT5_EXT or GL_COMPRESSED_RED_RGTC1.
+ * @param compressed_format: Insert a block compressed format.
+ * @return The OpenGL corresponding internal format.
+ */
+GLenum ConvertToGLType(frame::file::CompressedFormatEnum compressed_format);
+/**
+ * @brief Check if the current context can sample a block compressed format.
+ * @param compressed_format: Insert a block compressed format.
+ * @return True if the format can be uploaded as is.
+ */
+bool IsCompressedFormatSupported(frame::file::CompressedFormatEnum compressed_format);
+/**
+ * @brief Get the maximum anisotropy supported by the driver.
+ * @return The maximum anisotropy (1 if anisotropic filtering isn't supported).
+ */
+float GetMaxSupportedAnisotropy();
+/**
+ * @brief Check if the objects can be edited without being bound (GL 4.5 direct state access).
+ * @return True if the glNamed* and glTexture* entry points are available.
+ */
+bool IsDirectStateAccessSupported();
 
 }  // End namespace frame::opengl.
@@ -0,0 +1,201 @@
+#include "frame/opengl/point_cloud_stream.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "frame/device_interface.h"
+#include "frame/node_static_mesh.h"
+#include "frame/opengl/buffer.h"
+#include "frame/opengl/static_mesh.h"
+#include "frame/uniform_interface.h"
+
+namespace frame::opengl {
+
+PointCloudStream::PointCloudStream(LevelInterface& level, const std::filesystem::path& file_name,
+                                   const std::string& name, const std::string& material_name,
+                                   const PointCloudStreamParameter& parameter /* = {}*/)
+    : level_(level), parameter_(parameter) {
+    octree_                  = std::make_unique<file::PointCloudOctree>(file_name);
+    task_pool_               = std::make_unique<TaskPool>(parameter_.thread_count);
+    slot_point_count_        = std::max(1u, octree_->GetMaxNodePointCount());
+    std::uint32_t slot_count = parameter_.slot_count;
+    if (!slot_count) {
+        slot_count = static_cast<std::uint32_t>(
+            std::min<std::uint64_t>(parameter_.point_budget / slot_point_count_ + 1,
+                                    octree_->GetNodes().size()) *
+            2);
+    }
+    slots_.resize(slot_count);
+    for (std::int32_t i = static_cast<std::int32_t>(slot_count) - 1; i >= 0; --i) {
+        free_slots_.push_back(i);
+    }
+    node_slots_.assign(octree_->GetNodes().size(), -1);
+    // The slots are allocated once, the nodes are copied in them.
+    auto vertex_buffer =
+        std::make_unique<Buffer>(BufferTypeEnum::ARRAY_BUFFER, BufferUsageEnum::DYNAMIC_DRAW);
+    vertex_buffer->SetName("vertex." + name);
+    vertex_buffer->Copy(static_cast<std::size_t>(slot_count) * slot_point_count_ *
+                        sizeof(file::PointCloudPoint));
+    vertex_buffer_id_ = level_.AddBuffer(std::move(vertex_buffer));
+    auto index_buffer = std::make_unique<Buffer>(BufferTypeEnum::ELEMENT_ARRAY_BUFFER,
+                                                 BufferUsageEnum::STREAM_DRAW);
+    index_buffer->SetName("index." + name);
+    index_buffer->Copy(static_cast<std::size_t>(
+                           std::min(parameter_.point_budget, octree_->GetPointCount())) *
+                       sizeof(std::uint32_t));
+    index_buffer_id_ = level_.AddBuffer(std::move(index_buffer));
+
+    // Point mesh with the position and the color of the points.
+    StaticMeshParameter static_mesh_parameter   = {};
+    static_mesh_parameter.vertex_buffer_id      = vertex_buffer_id_;
+    static_mesh_parameter.vertex_stride         = sizeof(file::PointCloudPoint);
+    static_mesh_parameter.index_buffer_id       = index_buffer_id_;
+    static_mesh_parameter.render_primitive_enum = proto::SceneStaticMesh::POINT;
+    static_mesh_parameter.vertex_attributes     = {
+        { 0, 3, VertexAttributeFormatEnum::FLOAT, false, 0 },
+        { 1, 3, VertexAttributeFormatEnum::UNSIGNED_BYTE, true, sizeof(glm::vec3) },
+    };
+    auto static_mesh = std::make_unique<StaticMesh>(level_, static_mesh_parameter);
+    static_mesh->SetName("mesh." + name);
+    // Nothing is drawn until the first nodes are uploaded.
+    static_mesh->SetIndexSize(0);
+    static_mesh->SetBoundingVolume(octree_->GetBoundingVolume());
+    static_mesh_id_ = level_.AddStaticMesh(std::move(static_mesh));
+
+    // Create the node corresponding to the mesh.
+    EntityId material_id = NullId;
+    if (!material_name.empty()) {
+        auto maybe_id = level_.GetIdFromName(material_name);
+        if (!maybe_id) {
+            throw std::runtime_error(fmt::format("No material [{}].", material_name));
+        }
+        material_id = maybe_id;
+    }
+    auto func = [&level](const std::string& name) -> NodeInterface* {
+        auto maybe_id = level.GetIdFromName(name);
+        if (!maybe_id) {
+            throw std::runtime_error(fmt::format("no id for name: {}", name));
+        }
+        return &level.GetSceneNodeFromId(maybe_id);
+    };
+    auto node = std::make_unique<NodeStaticMesh>(func, static_mesh_id_);
+    node->SetName(name);
+    auto node_id = level_.AddSceneNode(std::move(node));
+    if (!node_id) throw std::runtime_error(fmt::format("Could not add the node [{}].", name));
+    level_.AddMeshMaterialId(node_id, material_id);
+    logger_->info("Streaming point cloud [{}] ({} points in {} nodes, {} slots of {} points).",
+                  file_name.string(), octree_->GetPointCount(), octree_->GetNodes().size(),
+                  slot_count, slot_point_count_);
+}
+
+PointCloudStream::~PointCloudStream() {
+    // The reads use the octree.
+    task_pool_ = nullptr;
+}
+
+void PointCloudStream::PreRender(UniformInterface& uniform, DeviceInterface& device,
+                                 StaticMeshInterface& static_mesh, MaterialInterface& material) {
+    if (&static_mesh != &level_.GetStaticMeshFromId(static_mesh_id_)) return;
+    Stream(uniform.GetProjection(), uniform.GetView() * uniform.GetModel(),
+           static_cast<float>(device.GetSize().y));
+}
+
+std::size_t PointCloudStream::GetResidentNodeCount() const {
+    return slots_.size() - free_slots_.size();
+}
+
+void PointCloudStream::Stream(const glm::mat4& projection, const glm::mat4& view,
+                              float screen_height) {
+    ++frame_;
+    LandReads();
+    const auto selection = octree_->SelectNodes(projection, view, screen_height,
+                                                parameter_.point_budget, parameter_.max_error);
+    // Draw what is on the GPU and request the rest (by priority as the selection is ordered).
+    std::vector<std::uint32_t> drawn_nodes;
+    for (const auto node : selection) {
+        // Nodes emptied by the sampling of their parent only hold children.
+        if (!octree_->GetNodes()[node].point_count) continue;
+        const std::int32_t slot = node_slots_[node];
+        if (slot >= 0) {
+            slots_[slot].last_drawn_frame = frame_;
+            drawn_nodes.push_back(node);
+            continue;
+        }
+        if (reads_.count(node) || reads_.size() >= parameter_.max_pending_read_count) continue;
+        const auto* octree = octree_.get();
+        reads_.emplace(node,
+                       task_pool_->Submit([octree, node]() { return octree->ReadNode(node); }));
+    }
+    if (drawn_nodes == drawn_nodes_) return;
+    drawn_nodes_ = std::move(drawn_nodes);
+    std::vector<std::uint32_t> indices;
+    indices.reserve(drawn_point_count_);
+    for (const auto node : drawn_nodes_) {
+        const std::uint32_t first = static_cast<std::uint32_t>(node_slots_[node]) *
+                                    slot_point_count_;
+        const std::uint32_t count = octree_->GetNodes()[node].point_count;
+        for (std::uint32_t i = 0; i < count; ++i) indices.push_back(first + i);
+    }
+    drawn_point_count_ = indices.size();
+    auto& index_buffer = dynamic_cast<Buffer&>(level_.GetBufferFromId(index_buffer_id_));
+    index_buffer.Update(0, indices.size() * sizeof(std::uint32_t), indices.data());
+    level_.GetStaticMeshFromId(static_mesh_id_).SetIndexSize(indices.size() *
+                                                             sizeof(std::uint32_t));
+}
+
+void PointCloudStream::LandReads() {
+    auto& vertex_buffer        = dynamic_cast<Buffer&>(level_.GetBufferFromId(vertex_buffer_id_));
+    std::uint32_t upload_count = 0;
+    for (auto it = reads_.begin(); it != reads_.end();) {
+        if (upload_count >= parameter_.max_upload_count) break;
+        if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+        const std::uint32_t node = it->first;
+        std::vector<file::PointCloudPoint> points;
+        try {
+            points = it->second.get();
+        } catch (const std::exception& e) {
+            logger_->warn("Could not read point cloud node {}: {}", node, e.what());
+        }
+        it = reads_.erase(it);
+        if (points.empty()) continue;
+        const std::int32_t slot = AcquireSlot();
+        // Everything is in use, it will be read again.
+        if (slot < 0) continue;
+        vertex_buffer.Update(static_cast<std::size_t>(slot) * slot_point_count_ *
+                                 sizeof(file::PointCloudPoint),
+                             points.size() * sizeof(file::PointCloudPoint), points.data());
+        // Not evicted before it had a chance to be drawn.
+        slots_[slot].node             = static_cast<std::int32_t>(node);
+        slots_[slot].last_drawn_frame = frame_;
+        node_slots_[node]             = slot;
+        ++upload_count;
+    }
+}
+
+std::int32_t PointCloudStream::AcquireSlot() {
+    if (!free_slots_.empty()) {
+        const std::int32_t slot = free_slots_.back();
+        free_slots_.pop_back();
+        return slot;
+    }
+    // The nodes drawn at the previous frame are likely to be drawn again.
+    std::int32_t oldest = -1;
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(slots_.size()); ++i) {
+        if (slots_[i].last_drawn_frame + 1 >= frame_) continue;
+        if (oldest < 0 || slots_[i].last_drawn_frame < slots_[oldest].last_drawn_frame) {
+            oldest = i;
+        }
+    }
+    if (oldest < 0) return -1;
+    node_slots_[slots_[oldest].node] = -1;
+    slots_[oldest].node              = -1;
+    return oldest;
+}
+
+}  // End namespace frame::opengl.
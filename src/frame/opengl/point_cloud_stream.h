@@ -0,0 +1,158 @@
+#pragma once
+
+#include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "frame/file/point_cloud_octree.h"
+#include "frame/level_interface.h"
+#include "frame/logger.h"
+#include "frame/plugin_interface.h"
+#include "frame/task_pool.h"
+
+namespace frame::opengl {
+
+/**
+ * @class PointCloudStreamParameter
+ * @brief Parameters of the streaming of a point cloud octree.
+ */
+struct PointCloudStreamParameter {
+    //! @brief Maximum number of points drawn per frame.
+    std::uint64_t point_budget = 5000000;
+    //! @brief Projected spacing between the points (in pixels) under which a node isn't refined.
+    float max_error = 1.0f;
+    //! @brief Number of nodes kept on the GPU (0 is twice the nodes needed by the budget).
+    std::uint32_t slot_count = 0;
+    //! @brief Maximum number of nodes read from the disk at the same time.
+    std::uint32_t max_pending_read_count = 16;
+    //! @brief Maximum number of nodes uploaded to the GPU per frame.
+    std::uint32_t max_upload_count = 8;
+    //! @brief Number of threads reading the nodes.
+    std::size_t thread_count = 2;
+};
+
+/**
+ * @class PointCloudStream
+ * @brief Draw a point cloud octree bigger than the memory: every frame the nodes are selected from
+ * the camera (screen space error and point budget), the missing ones are read on worker threads
+ * and uploaded in the slots of a fixed size vertex buffer (the least recently drawn slot is
+ * reused) and the index buffer of the mesh is rewritten with the points of the resident nodes. It
+ * is a plugin (the selection is done at the pre render of its mesh) and it adds a point mesh with
+ * a position (location 0) and a normalized color (location 1) to the level.
+ */
+class PointCloudStream : public PluginInterface {
+   public:
+    /**
+     * @brief Constructor open the octree and create the buffers, the mesh and the scene node in
+     * the level (throw std::runtime_error if it fails).
+     * @param level: Level the mesh is added to (should outlive the plugin).
+     * @param file_name: Octree file (see file::BuildPointCloudOctree).
+     * @param name: Name of the mesh and of the scene node.
+     * @param material_name: Material of the mesh.
+     * @param parameter: Parameters of the streaming.
+     */
+    PointCloudStream(LevelInterface& level, const std::filesystem::path& file_name,
+                     const std::string& name, const std::string& material_name,
+                     const PointCloudStreamParameter& parameter = {});
+    //! @brief Destructor wait for the pending reads.
+    ~PointCloudStream() override;
+
+   public:
+    //! @brief Nothing to do at startup.
+    void Startup(glm::uvec2 size) override {}
+    //! @brief Events are not used.
+    bool PollEvent(void* event) override { return false; }
+    /**
+     * @brief Stream the point cloud if the mesh is the one of the point cloud.
+     * @param uniform[in, out]: The uniform data (camera and model).
+     * @param device: The device (for the size of the screen).
+     * @param static_mesh: The static mesh about to be drawn.
+     * @param material: The material associated with the mesh.
+     */
+    void PreRender(UniformInterface& uniform, DeviceInterface& device,
+                   StaticMeshInterface& static_mesh, MaterialInterface& material) override;
+    //! @brief Nothing to update after the render, always running.
+    bool Update(DeviceInterface& device, double dt = 0.0) override { return true; }
+    //! @brief Nothing to do at the end.
+    void End() override {}
+    /**
+     * @brief Get name.
+     * @return Name.
+     */
+    std::string GetName() const override { return name_; }
+    /**
+     * @brief Set name.
+     * @param name: New name.
+     */
+    void SetName(const std::string& name) override { name_ = name; }
+
+   public:
+    /**
+     * @brief Select, load and upload the nodes for a camera (called by PreRender).
+     * @param projection: Projection matrix of the camera.
+     * @param view: View matrix times model matrix of the point cloud.
+     * @param screen_height: Height of the viewport in pixels.
+     */
+    void Stream(const glm::mat4& projection, const glm::mat4& view, float screen_height);
+    /**
+     * @brief Get the mesh of the point cloud.
+     * @return Id of the static mesh in the level.
+     */
+    EntityId GetStaticMeshId() const { return static_mesh_id_; }
+    /**
+     * @brief Get the octree.
+     * @return The octree being streamed.
+     */
+    const file::PointCloudOctree& GetOctree() const { return *octree_; }
+    /**
+     * @brief Get the number of points drawn (at the last stream).
+     * @return Number of points in the index buffer.
+     */
+    std::size_t GetDrawnPointCount() const { return drawn_point_count_; }
+    /**
+     * @brief Get the number of nodes on the GPU.
+     * @return Number of nodes in the slots.
+     */
+    std::size_t GetResidentNodeCount() const;
+
+   protected:
+    //! @brief Upload the nodes read by the workers (at most max_upload_count).
+    void LandReads();
+    /**
+     * @brief Get a free slot or the least recently drawn one (not drawn at the previous frame).
+     * @return Index of the slot (-1 if all the slots are in use).
+     */
+    std::int32_t AcquireSlot();
+
+   private:
+    struct Slot {
+        std::int32_t node              = -1;
+        std::uint64_t last_drawn_frame = 0;
+    };
+    LevelInterface& level_;
+    PointCloudStreamParameter parameter_            = {};
+    std::unique_ptr<file::PointCloudOctree> octree_ = nullptr;
+    // Declared after the octree so the workers are done before it is destroyed.
+    std::unique_ptr<TaskPool> task_pool_ = nullptr;
+    EntityId static_mesh_id_             = NullId;
+    EntityId vertex_buffer_id_           = NullId;
+    EntityId index_buffer_id_            = NullId;
+    // Reads in flight per node.
+    std::map<std::uint32_t, std::future<std::vector<file::PointCloudPoint>>> reads_ = {};
+    // Number of points in a slot (the biggest node).
+    std::uint32_t slot_point_count_       = 0;
+    std::vector<Slot> slots_              = {};
+    std::vector<std::int32_t> free_slots_ = {};
+    // Slot of every node (-1 if it isn't on the GPU).
+    std::vector<std::int32_t> node_slots_   = {};
+    std::vector<std::uint32_t> drawn_nodes_ = {};
+    std::size_t drawn_point_count_          = 0;
+    std::uint64_t frame_                    = 0;
+    std::string name_                       = "PointCloudStream";
+    Logger& logger_                         = Logger::GetInstance();
+};
+
+}  // End namespace frame::opengl.
@@ -6,11 +6,33 @@
 #include <regex>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 
+#include "frame/file/cache_file.h"
 #include "frame/logger.h"
+#include "frame/opengl/uniform_block.h"
 
 namespace frame::opengl {
 
+namespace {
+
+// Names of the uniforms uploaded on every draw (indexed by UniformSlotEnum).
+constexpr std::array<std::string_view, static_cast<std::size_t>(UniformSlotEnum::COUNT)>
+    uniform_slot_names = { "projection", "view", "model", "environment_model", "time_s" };
+
+// Driver string, the cached binaries are only valid for the driver that produced them.
+std::string GetDriverString() {
+    std::string driver;
+    for (const GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+        const auto* value = glGetString(name);
+        if (value) driver += reinterpret_cast<const char*>(value);
+        driver += '\n';
+    }
+    return driver;
+}
+
+}  // End namespace.
+
 Program::Program(const std::string& name) {
     SetName(name);
     program_id_ = glCreateProgram();
@@ -24,56 +46,144 @@ void Program::AddShader(const Shader& shader) {
 }
 
 void Program::LinkShader() {
+    StartLink();
+    FinishLink();
+}
+
+void Program::StartLink() {
+    // Keep the binary available for the program cache.
+    if (IsBinarySupported()) {
+        glProgramParameteri(program_id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glLinkProgram(program_id_);
-    GLenum error = glGetError();
-    if (error != GL_NO_ERROR) {
-        std::string error_str = fmt::format("Failed to link program [{}], ",
-                                            reinterpret_cast<const char*>(gluErrorString(error)));
-        GLint program_status  = 0;
-        glGetProgramiv(program_id_, GL_LINK_STATUS, &program_status);
-        if (program_status != GL_TRUE) {
-            error_str += "and GL_LINK_STATUS is GL_FALSE!";
-            throw std::runtime_error(error_str);
-        }
-        error_str += "but GL_LINK_STATUS is GL_TRUE?";
-        logger_->warn(error_str);
+}
+
+bool Program::IsLinkCompleted() const {
+    if (!IsParallelCompileSupported()) return true;
+    GLint completed = GL_FALSE;
+    if (GLEW_KHR_parallel_shader_compile) {
+        glGetProgramiv(program_id_, GL_COMPLETION_STATUS_KHR, &completed);
+    } else {
+        glGetProgramiv(program_id_, GL_COMPLETION_STATUS_ARB, &completed);
+    }
+    return completed == GL_TRUE;
+}
+
+void Program::FinishLink() {
+    GLint program_status = 0;
+    glGetProgramiv(program_id_, GL_LINK_STATUS, &program_status);
+    if (program_status != GL_TRUE) {
+        GLint length = 0;
+        glGetProgramiv(program_id_, GL_INFO_LOG_LENGTH, &length);
+        std::string info_log(static_cast<std::size_t>(std::max(length, 1)), '\0');
+        glGetProgramInfoLog(program_id_, static_cast<GLsizei>(info_log.size()), &length,
+                            info_log.data());
+        info_log.resize(static_cast<std::size_t>(length));
+        throw std::runtime_error(fmt::format("Failed to link program [{}]: {}", name_, info_log));
     }
     for (const auto& id : attached_shaders_) {
         glDetachShader(program_id_, id);
     }
+    attached_shaders_.clear();
+    ReflectProgram();
+}
+
+bool Program::IsParallelCompileSupported() {
+    return GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+}
+
+bool Program::IsBinarySupported() {
+    if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary) return false;
+    GLint format_count = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    return format_count > 0;
+}
+
+bool Program::LinkBinary(const ProgramBinary& program_binary) {
+    glProgramBinary(program_id_, program_binary.format, program_binary.data.data(),
+                    static_cast<GLsizei>(program_binary.data.size()));
+    GLint program_status = 0;
+    glGetProgramiv(program_id_, GL_LINK_STATUS, &program_status);
+    if (program_status != GL_TRUE) return false;
+    ReflectProgram();
+    return true;
+}
+
+ProgramBinary Program::GetBinary() const {
+    ProgramBinary program_binary = {};
+    GLint length                 = 0;
+    glGetProgramiv(program_id_, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return program_binary;
+    program_binary.data.resize(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(program_id_, length, &length, &format, program_binary.data.data());
+    program_binary.data.resize(static_cast<std::size_t>(length));
+    program_binary.format = static_cast<std::uint32_t>(format);
+    return program_binary;
+}
+
+void Program::ReflectProgram() {
     CreateUniformList();
+    instance_model_location_ = glGetAttribLocation(program_id_, "in_instance_model");
+    // Programs that opted in the per frame block read it from its binding point.
+    const GLuint block_index = glGetUniformBlockIndex(program_id_, frame_uniform_block_name);
+    if (block_index != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program_id_, block_index, frame_uniform_block_binding);
+    }
 }
 
 void Program::Use() const { glUseProgram(program_id_); }
 
 void Program::Use(const UniformInterface& uniform_interface) const {
     glUseProgram(program_id_);
-    if (HasUniform("projection")) {
-        Uniform("projection", uniform_interface.GetProjection());
-    }
-    if (HasUniform("view")) {
-        Uniform("view", uniform_interface.GetView());
-    }
-    if (HasUniform("model")) {
-        Uniform("model", uniform_interface.GetModel());
-    }
-    if (HasUniform("environment_model")) {
-        Uniform("environment_model", uniform_interface.GetEnvironmentModel());
-    }
-    if (HasUniform("time_s")) {
-        Uniform("time_s", static_cast<float>(uniform_interface.GetDeltaTime()));
+    SetUniforms(uniform_interface);
+}
+
+void Program::SetUniforms(const UniformInterface& uniform_interface) const {
+    // Straight upload from the locations reflected at link time.
+    for (std::size_t i = 0; i < slot_locations_.size(); ++i) {
+        const int location = slot_locations_[i];
+        if (location == -1) continue;
+        switch (static_cast<UniformSlotEnum>(i)) {
+            case UniformSlotEnum::PROJECTION: {
+                const auto projection = uniform_interface.GetProjection();
+                glUniformMatrix4fv(location, 1, GL_FALSE, &projection[0][0]);
+                break;
+            }
+            case UniformSlotEnum::VIEW: {
+                const auto view = uniform_interface.GetView();
+                glUniformMatrix4fv(location, 1, GL_FALSE, &view[0][0]);
+                break;
+            }
+            case UniformSlotEnum::MODEL: {
+                const auto model = uniform_interface.GetModel();
+                glUniformMatrix4fv(location, 1, GL_FALSE, &model[0][0]);
+                break;
+            }
+            case UniformSlotEnum::ENVIRONMENT_MODEL: {
+                const auto environment_model = uniform_interface.GetEnvironmentModel();
+                glUniformMatrix4fv(location, 1, GL_FALSE, &environment_model[0][0]);
+                break;
+            }
+            case UniformSlotEnum::TIME_S:
+                glUniform1f(location, static_cast<float>(uniform_interface.GetDeltaTime()));
+                break;
+            default:
+                break;
+        }
     }
+    // Plugin uniforms (the lists are empty unless a plugin set values).
     for (const auto& name : uniform_interface.GetFloatNames()) {
-        if (HasUniform(name)) {
-            Uniform(name, uniform_interface.GetValueFloat(name),
-                    uniform_interface.GetSizeFromFloat(name));
-        }
+        auto it = memoize_map_.find(name);
+        if (it == memoize_map_.end()) continue;
+        UniformAtLocation(name, it->second, uniform_interface.GetValueFloat(name),
+                          uniform_interface.GetSizeFromFloat(name));
     }
     for (const auto& name : uniform_interface.GetIntNames()) {
-        if (HasUniform(name)) {
-            Uniform(name, uniform_interface.GetValueInt(name),
-                    uniform_interface.GetSizeFromInt(name));
-        }
+        auto it = memoize_map_.find(name);
+        if (it == memoize_map_.end()) continue;
+        UniformAtLocation(name, it->second, uniform_interface.GetValueInt(name),
+                          uniform_interface.GetSizeFromInt(name));
     }
 }
 
@@ -107,6 +217,11 @@ void Program::Uniform(const std::string& name, const glm::mat4 mat) const {
 
 void Program::Uniform(const std::string& name, const std::vector<float>& vector,
                       glm::uvec2 size) const {
+    UniformAtLocation(name, GetMemoizeUniformLocation(name), vector, size);
+}
+
+void Program::UniformAtLocation(const std::string& name, int location,
+                                const std::vector<float>& vector, glm::uvec2 size) const {
     if (size.y == 0 && size.x == 0) {
         if (vector.size() == 0) {
             logger_->warn("Entered a uniform [{}] without size.", name);
@@ -118,40 +233,39 @@ void Program::Uniform(const std::string& name, const std::vector<float>& vector,
     assert(vector.size() == size.x * size.y);
     if (size.y == 1) {
         if (size.x == 1) {
-            glUniform1f(GetMemoizeUniformLocation(name), vector[0]);
+            glUniform1f(location, vector[0]);
             return;
         }
-        glUniform1fv(GetMemoizeUniformLocation(name), size.x, vector.data());
+        glUniform1fv(location, size.x, vector.data());
         return;
     }
     if (size.y == 2) {
         if (size.x == 1) {
-            glUniform2f(GetMemoizeUniformLocation(name), vector[0], vector[1]);
+            glUniform2f(location, vector[0], vector[1]);
             return;
         }
         if (size.x == 2) {
-            glUniformMatrix2fv(GetMemoizeUniformLocation(name), 1, GL_FALSE, vector.data());
+            glUniformMatrix2fv(location, 1, GL_FALSE, vector.data());
             return;
         }
     }
     if (size.y == 3) {
         if (size.x == 1) {
-            glUniform3f(GetMemoizeUniformLocation(name), vector[0], vector[1], vector[2]);
+            glUniform3f(location, vector[0], vector[1], vector[2]);
             return;
         }
         if (size.x == 3) {
-            glUniformMatrix3fv(GetMemoizeUniformLocation(name), 1, GL_FALSE, vector.data());
+            glUniformMatrix3fv(location, 1, GL_FALSE, vector.data());
             return;
         }
     }
     if (size.y == 4) {
         if (size.x == 1) {
-            glUniform4f(GetMemoizeUniformLocation(name), vector[0], vector[1], vector[2],
-                        vector[3]);
+            glUniform4f(location, vector[0], vector[1], vector[2], vector[3]);
             return;
         }
         if (size.x == 4) {
-            glUniformMatrix4fv(GetMemoizeUniformLocation(name), 1, GL_FALSE, vector.data());
+            glUniformMatrix4fv(location, 1, GL_FALSE, vector.data());
             return;
         }
     }
@@ -161,6 +275,11 @@ void Program::Uniform(const std::string& name, const std::vector<float>& vector,
 
 void Program::Uniform(const std::string& name, const std::vector<std::int32_t>& vector,
                       glm::uvec2 size /*= { 0, 0 }*/) const {
+    UniformAtLocation(name, GetMemoizeUniformLocation(name), vector, size);
+}
+
+void Program::UniformAtLocation(const std::string& name, int location,
+                                const std::vector<std::int32_t>& vector, glm::uvec2 size) const {
     if (size.y == 0 && size.x == 0) {
         if (vector.size() == 0) {
             logger_->warn("Entered a uniform [{}] without size.", name);
@@ -172,29 +291,27 @@ void Program::Uniform(const std::string& name, const std::vector<std::int32_t>&
     assert(vector.size() == size.x * size.y);
     if (size.y == 1) {
         if (size.x == 1) {
-            glUniform1i(GetMemoizeUniformLocation(name), vector[0]);
+            glUniform1i(location, vector[0]);
             return;
         }
-        glUniform1iv(GetMemoizeUniformLocation(name), size.x,
-                     static_cast<const GLint*>(vector.data()));
+        glUniform1iv(location, size.x, static_cast<const GLint*>(vector.data()));
         return;
     }
     if (size.y == 2) {
         if (size.x == 1) {
-            glUniform2i(GetMemoizeUniformLocation(name), vector[0], vector[1]);
+            glUniform2i(location, vector[0], vector[1]);
             return;
         }
     }
     if (size.y == 3) {
         if (size.x == 1) {
-            glUniform3i(GetMemoizeUniformLocation(name), vector[0], vector[1], vector[2]);
+            glUniform3i(location, vector[0], vector[1], vector[2]);
             return;
         }
     }
     if (size.y == 4) {
         if (size.x == 1) {
-            glUniform4i(GetMemoizeUniformLocation(name), vector[0], vector[1], vector[2],
-                        vector[3]);
+            glUniform4i(location, vector[0], vector[1], vector[2], vector[3]);
             return;
         }
     }
@@ -282,6 +399,7 @@ void Program::UnUse() const { glUseProgram(0); }
 
 void Program::CreateUniformList() const {
     uniform_list_.clear();
+    memoize_map_.clear();
     GLint count = 0;
     glGetProgramiv(program_id_, GL_ACTIVE_UNIFORMS, &count);
     logger_->info("Uniform [{}] count: {}", name_, count);
@@ -296,6 +414,21 @@ void Program::CreateUniformList() const {
         logger_->info("Uniform: {}, type {}, size [{}].", name, type, size);
         UniformValue uniform_value = { length, size, type, name_str };
         uniform_list_.push_back(uniform_value);
+        // Uniforms in a block have no location (they are set through the buffer).
+        const int location = glGetUniformLocation(program_id_, name_str.c_str());
+        if (location == -1) continue;
+        memoize_map_.insert({ name_str, location });
+        // Arrays are reported as `name[0]` but can also be set from their name.
+        constexpr std::string_view array_suffix = "[0]";
+        if (absl::EndsWith(name_str, array_suffix)) {
+            memoize_map_.insert(
+                { name_str.substr(0, name_str.size() - array_suffix.size()), location });
+        }
+    }
+    slot_locations_.fill(-1);
+    for (std::size_t i = 0; i < uniform_slot_names.size(); ++i) {
+        auto it = memoize_map_.find(std::string(uniform_slot_names[i]));
+        if (it != memoize_map_.end()) slot_locations_[i] = it->second;
     }
 }
 
@@ -308,12 +441,8 @@ std::vector<std::string> Program::GetUniformNameList() const {
 }
 
 bool Program::HasUniform(const std::string& name) const {
-    std::vector<std::string> uniform_list = GetUniformNameList();
-    if (!std::count(uniform_list.begin(), uniform_list.end(), name)) {
-        // To solve the fact that the uniform could end with a `[0]`.
-        return std::count(uniform_list.begin(), uniform_list.end(), name + "[0]");
-    }
-    return true;
+    // The active uniforms (and the name of arrays without `[0]`) are in the map from link time.
+    return memoize_map_.count(name) != 0;
 }
 
 std::string Program::GetTemporarySceneRoot() const { return temporary_scene_root_; }
@@ -332,38 +461,120 @@ std::unique_ptr<frame::ProgramInterface> CreateProgram(const std::string& name,
                                                        std::istream& vertex_shader_code,
                                                        std::istream& pixel_shader_code,
                                                        std::istream& geometry_shader_code) {
-#ifdef _DEBUG
+    ProgramSource program_source = {};
+    program_source.name          = name;
+    program_source.vertex.assign(std::istreambuf_iterator<char>(vertex_shader_code), {});
+    program_source.fragment.assign(std::istreambuf_iterator<char>(pixel_shader_code), {});
+    program_source.geometry.assign(std::istreambuf_iterator<char>(geometry_shader_code), {});
+    auto programs = CreatePrograms({ program_source });
+    return std::move(programs.front());
+}
+
+std::vector<std::unique_ptr<frame::ProgramInterface>> CreatePrograms(
+    const std::vector<ProgramSource>& program_sources) {
     auto& logger = Logger::GetInstance();
-    logger->info("Creating program");
-#endif  // _DEBUG
-    auto program = std::make_unique<Program>(name);
-    std::string vertex_source(std::istreambuf_iterator<char>(vertex_shader_code), {});
-    Shader vertex(ShaderEnum::VERTEX_SHADER);
-    if (!vertex.LoadFromSource(vertex_source)) {
-        throw std::runtime_error(vertex.GetErrorMessage());
-    }
-    program->AddShader(vertex);
-
-    std::string pixel_source(std::istreambuf_iterator<char>(pixel_shader_code), {});
-    Shader fragment(ShaderEnum::FRAGMENT_SHADER);
-    if (!fragment.LoadFromSource(pixel_source)) {
-        throw std::runtime_error(fragment.GetErrorMessage());
-    }
-    program->AddShader(fragment);
-
-    std::string geometry_source(std::istreambuf_iterator<char>(geometry_shader_code), {});
-    if (geometry_source != "") {
-        Shader geometry(ShaderEnum::GEOMETRY_SHADER);
-        if (!geometry.LoadFromSource(geometry_source)) {
-            throw std::runtime_error(geometry.GetErrorMessage());
+    // A program being compiled with the shaders it is waiting for.
+    struct PendingProgram {
+        std::unique_ptr<Program> program             = nullptr;
+        std::vector<std::unique_ptr<Shader>> shaders = {};
+        std::uint64_t hash                           = 0;
+        std::filesystem::path cache_path             = {};
+        bool done                                    = false;
+    };
+    const auto cache_directory = frame::file::GetCacheDirectory("program");
+    const bool use_cache       = !cache_directory.empty() && Program::IsBinarySupported();
+    const std::string driver   = use_cache ? GetDriverString() : "";
+    const bool parallel        = Program::IsParallelCompileSupported();
+    logger->info("Creating {} program(s) ({} compilation).", program_sources.size(),
+                 parallel ? "parallel" : "serial");
+    if (parallel) {
+        // Let the driver choose the number of compiler threads (GLEW only loads the entry point
+        // of the extension that is present).
+        if (GLEW_KHR_parallel_shader_compile) {
+            glMaxShaderCompilerThreadsKHR(0xffffffff);
+        } else {
+            glMaxShaderCompilerThreadsARB(0xffffffff);
         }
-        program->AddShader(geometry);
     }
-    program->LinkShader();
-#ifdef _DEBUG
-    logger->info("with pointer := {}", static_cast<void*>(program.get()));
-#endif  // _DEBUG
-    return std::move(program);
+    // Check the shaders and the link, then cache the binary.
+    auto finish_program = [&logger, use_cache](PendingProgram& pending_program) {
+        for (auto& shader : pending_program.shaders) {
+            if (!shader->CheckCompile()) throw std::runtime_error(shader->GetErrorMessage());
+        }
+        pending_program.program->FinishLink();
+        pending_program.shaders.clear();
+        pending_program.done = true;
+        if (!use_cache) return;
+        const auto program_binary = pending_program.program->GetBinary();
+        if (program_binary.data.empty()) return;
+        try {
+            WriteProgramCacheFile(pending_program.cache_path, pending_program.hash,
+                                  program_binary);
+        } catch (const std::runtime_error& e) {
+            logger->warn("Could not cache program [{}]: {}",
+                         pending_program.program->GetName(), e.what());
+        }
+    };
+    std::vector<PendingProgram> pending_programs(program_sources.size());
+    for (std::size_t i = 0; i < program_sources.size(); ++i) {
+        const auto& program_source = program_sources[i];
+        auto& pending_program      = pending_programs[i];
+        pending_program.program    = std::make_unique<Program>(program_source.name);
+        // Try the binary cache first, the driver compiler is slow.
+        if (use_cache) {
+            // A change in a source or in the driver invalidate the binary.
+            pending_program.hash = frame::file::HashStrings({ driver, program_source.vertex,
+                                                              program_source.fragment,
+                                                              program_source.geometry });
+            pending_program.cache_path = frame::file::GetCachePath(
+                cache_directory, program_source.name, pending_program.hash, ".fprog");
+            ProgramBinary program_binary = {};
+            if (ReadProgramCacheFile(pending_program.cache_path, pending_program.hash,
+                                     program_binary)) {
+                if (pending_program.program->LinkBinary(program_binary)) {
+                    pending_program.done = true;
+                    continue;
+                }
+                logger->warn("Cached program [{}] rejected by the driver, compiling it.",
+                             program_source.name);
+            }
+        }
+        const std::pair<ShaderEnum, const std::string*> shader_sources[] = {
+            { ShaderEnum::VERTEX_SHADER, &program_source.vertex },
+            { ShaderEnum::FRAGMENT_SHADER, &program_source.fragment },
+            { ShaderEnum::GEOMETRY_SHADER, &program_source.geometry },
+        };
+        for (const auto& [shader_type, source] : shader_sources) {
+            if (source->empty()) continue;
+            auto shader = std::make_unique<Shader>(shader_type);
+            shader->Compile(*source);
+            pending_program.program->AddShader(*shader);
+            pending_program.shaders.push_back(std::move(shader));
+        }
+        pending_program.program->StartLink();
+        // Without the extension the driver would wait here anyway, keep the serial behavior.
+        if (!parallel) finish_program(pending_program);
+    }
+    // Poll the completion of the links, the results are only queried once done (no stall).
+    bool pending = parallel;
+    while (pending) {
+        pending = false;
+        for (auto& pending_program : pending_programs) {
+            if (pending_program.done) continue;
+            if (pending_program.program->IsLinkCompleted()) {
+                finish_program(pending_program);
+            } else {
+                pending = true;
+            }
+        }
+        if (pending) std::this_thread::yield();
+    }
+    std::vector<std::unique_ptr<frame::ProgramInterface>> programs;
+    programs.reserve(pending_programs.size());
+    for (auto& pending_program : pending_programs) {
+        programs.push_back(std::move(pending_program.program));
+    }
+    return programs;
 }
 
 }  // End namespace frame::opengl.
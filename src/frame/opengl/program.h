@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <glm/glm.hpp>
 #include <map>
 #include <memory>
@@ -8,12 +9,26 @@
 
 #include "frame/json/proto.h"
 #include "frame/logger.h"
+#include "frame/opengl/program_cache.h"
 #include "frame/opengl/shader.h"
 #include "frame/program_interface.h"
 #include "frame/uniform_interface.h"
 
 namespace frame::opengl {
 
+/**
+ * @brief Uniforms uploaded by the renderer on every draw, their locations are reflected once at
+ * link time so that the upload is a loop over a table (no name lookup).
+ */
+enum class UniformSlotEnum : std::uint8_t {
+    PROJECTION        = 0,
+    VIEW              = 1,
+    MODEL             = 2,
+    ENVIRONMENT_MODEL = 3,
+    TIME_S            = 4,
+    COUNT             = 5,
+};
+
 /**
  * @class Program
  * @brief This is containing the program and all associated functions.
@@ -36,6 +51,25 @@ class Program : public ProgramInterface {
      * @param name: New name to be set.
      */
     void SetName(const std::string& name) override { name_ = name; }
+    /**
+     * @brief Get the OpenGL id of the program.
+     * @return Id of the OpenGL program.
+     */
+    unsigned int GetId() const { return static_cast<unsigned int>(program_id_); }
+    /**
+     * @brief Get the location of the per instance model attribute (in_instance_model), programs
+     * that have it can be drawn instanced.
+     * @return Location of the attribute or -1 if the program is not instanced.
+     */
+    int GetInstanceModelLocation() const { return instance_model_location_; }
+    /**
+     * @brief Get the location of a uniform set on every draw (reflected at link time).
+     * @param uniform_slot: Uniform to get the location of.
+     * @return Location of the uniform or -1 if the program doesn't use it.
+     */
+    int GetUniformLocation(UniformSlotEnum uniform_slot) const {
+        return slot_locations_[static_cast<std::size_t>(uniform_slot)];
+    }
 
    public:
     /**
@@ -93,8 +127,38 @@ class Program : public ProgramInterface {
      * @param shader: Add a shader to the program.
      */
     void AddShader(const Shader& shader);
-    //! @brief Link shaders to a program.
+    //! @brief Link shaders to a program (wait for the result).
     void LinkShader() override;
+    //! @brief Submit the link of the shaders, return immediately (see IsLinkCompleted).
+    void StartLink();
+    /**
+     * @brief Check if the link (and the compilation of the shaders) is done, never wait.
+     * @return True if the link is done (always true without KHR_parallel_shader_compile).
+     */
+    bool IsLinkCompleted() const;
+    //! @brief Get the result of the link (wait if needed), throw std::runtime_error on failure.
+    void FinishLink();
+    /**
+     * @brief Check if the shaders can be compiled and linked in parallel by the driver.
+     * @return True if KHR_parallel_shader_compile (or the ARB version) is available.
+     */
+    static bool IsParallelCompileSupported();
+    /**
+     * @brief Check if the program binaries can be retrieved and loaded by the current context.
+     * @return True if GL 4.1 or ARB_get_program_binary with at least one binary format.
+     */
+    static bool IsBinarySupported();
+    /**
+     * @brief Link the program from a binary (see GetBinary) instead of the shaders.
+     * @param program_binary: Binary of a program linked by the same driver.
+     * @return False if the driver rejected the binary (the program should be linked from shaders).
+     */
+    bool LinkBinary(const ProgramBinary& program_binary);
+    /**
+     * @brief Get the binary of the linked program (to be cached).
+     * @return The binary of the program (empty in case it is not available).
+     */
+    ProgramBinary GetBinary() const;
     /**
      * @brief Get the list of uniforms needed by the program.
      * @return Vector of string that represent the names of uniforms.
@@ -110,6 +174,13 @@ class Program : public ProgramInterface {
      * @brief Use the program, a little bit like bind.
      */
     void Use() const override;
+    /**
+     * @brief Upload the uniforms (matrices, time and plugin uniforms) to the program, the program
+     * has to be in use (this is the second half of Use without the glUseProgram).
+     * @param uniform_interface: The way to communicate the uniform like matrices (model, view,
+     * projection) but also time and other uniform that could be needed.
+     */
+    void SetUniforms(const UniformInterface& uniform_interface) const;
     //! @brief Stop using the program, a little bit like unbind.
     void UnUse() const override;
     /**
@@ -197,10 +268,31 @@ class Program : public ProgramInterface {
      * @param texture_id: Texture id to be tested.
      */
     void ThrowIsInTextureIds(EntityId texture_id) const;
+    //! @brief Reflect the linked program (uniforms, instance attribute and uniform blocks).
+    void ReflectProgram();
     /**
-     * @brief Create the uniform value list (internal).
+     * @brief Create the uniform value list and the location table of the active uniforms
+     * (internal, called once at link time).
      */
     void CreateUniformList() const;
+    /**
+     * @brief Upload a float uniform from a vector at a location.
+     * @param name: Name of the uniform (used in errors).
+     * @param location: Location of the uniform.
+     * @param vector: Vector to be inputed into the uniform.
+     * @param size: Size of the vector (ex: 3x3 for a mat3).
+     */
+    void UniformAtLocation(const std::string& name, int location, const std::vector<float>& vector,
+                           glm::uvec2 size) const;
+    /**
+     * @brief Upload an int uniform from a vector at a location.
+     * @param name: Name of the uniform (used in errors).
+     * @param location: Location of the uniform.
+     * @param vector: Vector to be inputed into the uniform.
+     * @param size: Size of the vector (ex: 3x3 for a mat3).
+     */
+    void UniformAtLocation(const std::string& name, int location,
+                           const std::vector<std::int32_t>& vector, glm::uvec2 size) const;
 
    private:
     /**
@@ -214,6 +306,9 @@ class Program : public ProgramInterface {
     };
     const Logger& logger_                           = Logger::GetInstance();
     mutable std::map<std::string, int> memoize_map_ = {};
+    mutable std::array<int, static_cast<std::size_t>(UniformSlotEnum::COUNT)> slot_locations_ = {
+        -1, -1, -1, -1, -1
+    };
     mutable std::map<std::string, proto::Uniform::UniformEnum> uniform_float_variable_map_ = {};
     mutable std::map<std::string, proto::Uniform::UniformEnum> uniform_int_variable_map_   = {};
     mutable std::vector<UniformValue> uniform_list_                                        = {};
@@ -221,11 +316,37 @@ class Program : public ProgramInterface {
     std::string temporary_scene_root_;
     std::string name_;
     int program_id_                           = 0;
+    int instance_model_location_              = -1;
     EntityId scene_root_                      = 0;
     std::vector<EntityId> input_texture_ids_  = {};
     std::vector<EntityId> output_texture_ids_ = {};
 };
 
+/**
+ * @class ProgramSource
+ * @brief Sources of the shaders of a program (see CreatePrograms).
+ */
+struct ProgramSource {
+    //! @brief Name of the program.
+    std::string name;
+    //! @brief Source of the vertex shader.
+    std::string vertex;
+    //! @brief Source of the fragment shader.
+    std::string fragment;
+    //! @brief Source of the geometry shader (empty if none).
+    std::string geometry;
+};
+
+/**
+ * @brief Create a batch of programs, all the compilations and links are submitted before any
+ * result is checked so that the driver can run them in parallel (KHR_parallel_shader_compile),
+ * without the extension the programs are created one after the other.
+ * @param program_sources: Sources of the programs.
+ * @return The programs in the same order as the sources (throw std::runtime_error on error).
+ */
+std::vector<std::unique_ptr<frame::ProgramInterface>> CreatePrograms(
+    const std::vector<ProgramSource>& program_sources);
+
 /**
  * @brief Create a program from two streams.
  * @param name: Name of the program.
@@ -0,0 +1,50 @@
+#include "frame/opengl/program_cache.h"
+
+#include <fstream>
+
+#include "frame/file/cache_file.h"
+
+namespace frame::opengl {
+
+namespace {
+
+// Layout of the file: CacheFileHeader | BinaryHeader | binary.
+constexpr std::array<char, 4> file_magic = { 'F', 'R', 'M', 'P' };
+constexpr std::uint32_t file_version     = 1;
+
+struct BinaryHeader {
+    std::uint32_t binary_format;
+    std::uint32_t reserved;
+    std::uint64_t binary_size;
+};
+static_assert(sizeof(BinaryHeader) == 16, "BinaryHeader is written as is.");
+
+}  // End namespace.
+
+bool ReadProgramCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                          ProgramBinary& program_binary) {
+    std::ifstream ifs;
+    if (!frame::file::OpenCacheFile(file_name, { file_magic, file_version, hash }, ifs)) {
+        return false;
+    }
+    BinaryHeader header = {};
+    ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!ifs) return false;
+    program_binary.format = header.binary_format;
+    program_binary.data.resize(static_cast<std::size_t>(header.binary_size));
+    ifs.read(reinterpret_cast<char*>(program_binary.data.data()),
+             static_cast<std::streamsize>(program_binary.data.size()));
+    return static_cast<bool>(ifs);
+}
+
+void WriteProgramCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                           const ProgramBinary& program_binary) {
+    BinaryHeader header  = {};
+    header.binary_format = program_binary.format;
+    header.binary_size   = program_binary.data.size();
+    frame::file::WriteCacheFile(file_name, { file_magic, file_version, hash },
+                                { { &header, sizeof(header) },
+                                  { program_binary.data.data(), program_binary.data.size() } });
+}
+
+}  // End namespace frame::opengl.
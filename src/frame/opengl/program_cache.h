@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace frame::opengl {
+
+/**
+ * @class ProgramBinary
+ * @brief Binary of a linked program as returned by the driver (only valid for the same driver).
+ */
+struct ProgramBinary {
+    //! @brief Driver specific format of the binary.
+    std::uint32_t format = 0;
+    //! @brief Content of the binary.
+    std::vector<std::uint8_t> data = {};
+};
+
+/**
+ * @brief Read a cached program binary.
+ * @param file_name: Cached binary file.
+ * @param hash: Expected hash of the sources and the driver (see file::HashStrings).
+ * @param program_binary: Binary read from the file.
+ * @return False if the file is missing, invalid or was made for another program.
+ */
+bool ReadProgramCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                          ProgramBinary& program_binary);
+/**
+ * @brief Write a program binary in the cache (throw std::runtime_error if it fails).
+ * @param file_name: Cached binary file.
+ * @param hash: Hash of the program.
+ * @param program_binary: Binary of the program.
+ */
+void WriteProgramCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                           const ProgramBinary& program_binary);
+
+}  // End namespace frame::opengl.
@@ -8,7 +8,13 @@
 
 namespace frame::opengl {
 
-RenderBuffer::RenderBuffer() { glGenRenderbuffers(1, &render_id_); }
+RenderBuffer::RenderBuffer() {
+    if (IsDirectStateAccessSupported()) {
+        glCreateRenderbuffers(1, &render_id_);
+    } else {
+        glGenRenderbuffers(1, &render_id_);
+    }
+}
 
 RenderBuffer::~RenderBuffer() { glDeleteRenderbuffers(1, &render_id_); }
 
@@ -24,6 +30,10 @@ void RenderBuffer::UnBind() const {
 }
 
 void RenderBuffer::CreateStorage(glm::uvec2 size) const {
+    if (IsDirectStateAccessSupported()) {
+        glNamedRenderbufferStorage(render_id_, GL_DEPTH_COMPONENT32, size.x, size.y);
+        return;
+    }
     Bind();
     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT32, size.x, size.y);
     UnBind();
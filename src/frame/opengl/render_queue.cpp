@@ -0,0 +1,52 @@
+#include "frame/opengl/render_queue.h"
+
+#include <algorithm>
+#include <set>
+#include <tuple>
+
+namespace frame::opengl {
+
+namespace {
+
+// Check if any of the ids is in the set.
+bool IntersectWith(const std::vector<EntityId>& ids, const std::set<EntityId>& id_set) {
+    return std::any_of(ids.cbegin(), ids.cend(),
+                       [&id_set](EntityId id) { return id_set.count(id) != 0; });
+}
+
+}  // End namespace.
+
+void RenderQueue::Sort() {
+    auto segment_begin = draw_items_.begin();
+    std::set<EntityId> written_ids;
+    std::set<EntityId> read_ids;
+    auto sort_segment = [&written_ids, &read_ids](std::vector<DrawItem>::iterator begin,
+                                                  std::vector<DrawItem>::iterator end) {
+        std::stable_sort(begin, end, [](const DrawItem& left, const DrawItem& right) {
+            return std::tie(left.output_ids, left.occlusion_test, left.program_id,
+                            left.material_id, left.mesh_id, left.level_of_detail) <
+                   std::tie(right.output_ids, right.occlusion_test, right.program_id,
+                            right.material_id, right.mesh_id, right.level_of_detail);
+        });
+        written_ids.clear();
+        read_ids.clear();
+    };
+    for (auto it = draw_items_.begin(); it != draw_items_.end(); ++it) {
+        // A clear event is a barrier on its own.
+        if (it->mesh_id == NullId) {
+            sort_segment(segment_begin, it);
+            segment_begin = std::next(it);
+            continue;
+        }
+        // Read after write or write after read of a texture inside the segment, start a new one.
+        if (IntersectWith(it->input_ids, written_ids) || IntersectWith(it->output_ids, read_ids)) {
+            sort_segment(segment_begin, it);
+            segment_begin = it;
+        }
+        written_ids.insert(it->output_ids.cbegin(), it->output_ids.cend());
+        read_ids.insert(it->input_ids.cbegin(), it->input_ids.cend());
+    }
+    sort_segment(segment_begin, draw_items_.end());
+}
+
+}  // End namespace frame::opengl.
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "frame/entity_id.h"
+
+namespace frame::opengl {
+
+/**
+ * @class DrawItem
+ * @brief A draw request collected by the render queue during a frame.
+ */
+struct DrawItem {
+    //! @brief Node from which the draw was issued.
+    EntityId node_id = NullId;
+    //! @brief Static mesh to be drawn, NullId means this is a clear event.
+    EntityId mesh_id = NullId;
+    //! @brief Material used to draw the mesh.
+    EntityId material_id = NullId;
+    //! @brief Program used by the material.
+    EntityId program_id = NullId;
+    //! @brief Output textures of the program (the render target).
+    std::vector<EntityId> output_ids = {};
+    //! @brief Textures read by the material.
+    std::vector<EntityId> input_ids = {};
+    //! @brief Draw only if the world box passes the depth test (hidden in a previous frame).
+    bool occlusion_test = false;
+    //! @brief Level of detail of the mesh to be drawn (0 is the full resolution).
+    std::uint32_t level_of_detail = 0;
+};
+
+/**
+ * @class RenderQueue
+ * @brief Collect the draw items for a frame and sort them so that the state changes are minimal.
+ * The sort key is (output target, occlusion test, program, material, mesh, level of detail) so the
+ * items that are re-tested against the depth come after the others, but the items are never moved
+ * across a clear event or across a pass that read a texture written by another pass in the same
+ * queue.
+ */
+class RenderQueue {
+   public:
+    /**
+     * @brief Add a draw item at the end of the queue.
+     * @param draw_item: Item to be added.
+     */
+    void Push(DrawItem draw_item) { draw_items_.push_back(std::move(draw_item)); }
+    //! @brief Remove all the items from the queue (keep the memory for the next frame).
+    void Clear() { draw_items_.clear(); }
+    /**
+     * @brief Check if the queue is empty.
+     * @return True if there is no item in the queue.
+     */
+    bool Empty() const { return draw_items_.empty(); }
+    /**
+     * @brief Get the sorted (if Sort was called) list of draw items.
+     * @return The list of draw items.
+     */
+    const std::vector<DrawItem>& GetDrawItems() const { return draw_items_; }
+    //! @brief Sort the queue by state keeping the dependencies between passes.
+    void Sort();
+
+   private:
+    std::vector<DrawItem> draw_items_ = {};
+};
+
+}  // End namespace frame::opengl.
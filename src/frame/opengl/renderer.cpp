@@ -3,12 +3,16 @@
 #include <GL/glew.h>
 #include <fmt/core.h>
 
+#include <cstring>
 #include <stdexcept>
+#include <tuple>
+#include <unordered_set>
 
 #include "frame/node_matrix.h"
 #include "frame/node_static_mesh.h"
 #include "frame/opengl/file/load_program.h"
 #include "frame/opengl/material.h"
+#include "frame/opengl/program.h"
 #include "frame/opengl/static_mesh.h"
 #include "frame/opengl/texture.h"
 #include "frame/opengl/texture_cube_map.h"
@@ -34,6 +38,56 @@ const std::array<glm::mat4, 6> views_cubemap = {
 };
 // Projection cube map.
 const glm::mat4 projection_cubemap = glm::perspective(glm::radians(90.0f), 1.0f, 0.01f, 10.0f);
+// Draw the elements of a level of detail of a static mesh (the vertex array and index buffer
+// should be bound).
+void DrawElements(const StaticMeshInterface& static_mesh, std::uint32_t level_of_detail = 0,
+                  GLsizei instance_count = 1) {
+    const auto [first, count] = static_mesh.GetLevelOfDetailIndexRange(level_of_detail);
+    const void* offset        = reinterpret_cast<const void*>(
+        static_cast<std::uintptr_t>(first * static_mesh.GetIndexElementSize()));
+    const GLenum type =
+        (static_mesh.GetIndexElementSize() == sizeof(std::uint16_t)) ? GL_UNSIGNED_SHORT
+                                                                     : GL_UNSIGNED_INT;
+    GLenum primitive = GL_TRIANGLES;
+    switch (static_mesh.GetRenderPrimitive()) {
+        case proto::SceneStaticMesh::TRIANGLE:
+            primitive = GL_TRIANGLES;
+            break;
+        case proto::SceneStaticMesh::POINT:
+            primitive = GL_POINTS;
+            break;
+        case proto::SceneStaticMesh::LINE:
+            primitive = GL_LINES;
+            break;
+        default:
+            throw std::runtime_error(fmt::format(
+                "Couldn't draw primitive {}",
+                proto::SceneStaticMesh_RenderPrimitiveEnum_Name(static_mesh.GetRenderPrimitive())));
+    }
+    if (instance_count == 1) {
+        glDrawElements(primitive, static_cast<GLsizei>(count), type, offset);
+    } else {
+        glDrawElementsInstanced(primitive, static_cast<GLsizei>(count), type, offset,
+                                instance_count);
+    }
+}
+// Set the instance model attribute (4 vec4 locations) of an instanced program to a constant
+// identity, this is used when it is drawn without an instance buffer.
+void SetConstantInstanceModel(int location) {
+    if (location == -1) return;
+    const glm::mat4 identity(1.0f);
+    for (GLuint i = 0; i < 4; ++i) {
+        glDisableVertexAttribArray(location + i);
+        glVertexAttrib4fv(location + i, &identity[i][0]);
+    }
+}
+// Check if two draw items can be drawn in the same instanced call.
+bool IsSameState(const DrawItem& left, const DrawItem& right) {
+    return std::tie(left.output_ids, left.occlusion_test, left.program_id, left.material_id,
+                    left.mesh_id, left.level_of_detail) ==
+           std::tie(right.output_ids, right.occlusion_test, right.program_id, right.material_id,
+                    right.mesh_id, right.level_of_detail);
+}
 }  // namespace
 
 Renderer::Renderer(LevelInterface& level, glm::uvec4 viewport)
@@ -61,6 +115,7 @@ Renderer::Renderer(LevelInterface& level, glm::uvec4 viewport)
     if (!level_.GetMaterialFromId(display_material_id_).AddTextureId(out_texture_id, "Display")) {
         throw std::runtime_error("Couldn't add texture to material.");
     }
+    if (level_.IsFrameGraphEnabled()) CreateTransientClasses();
 }
 
 void Renderer::RenderNode(EntityId node_id, EntityId material_id, const glm::mat4& projection,
@@ -71,16 +126,10 @@ void Renderer::RenderNode(EntityId node_id, EntityId material_id, const glm::mat
     latest_time_ = t;
     // Check current node.
     auto& node = level_.GetSceneNodeFromId(node_id);
-    // Try to cast to a node static mesh.
-    auto& node_static_mesh = dynamic_cast<NodeStaticMesh&>(node);
-    auto mesh_id           = node.GetLocalMesh();
+    auto mesh_id = node.GetLocalMesh();
     // In case no mesh then this is a clear event.
     if (!mesh_id) {
-        GLbitfield bit_field       = 0;
-        std::uint32_t clean_buffer = node_static_mesh.GetCleanBuffer();
-        if (clean_buffer | proto::CleanBuffer::CLEAR_COLOR) bit_field += GL_COLOR_BUFFER_BIT;
-        if (clean_buffer | proto::CleanBuffer::CLEAR_DEPTH) bit_field += GL_DEPTH_BUFFER_BIT;
-        if (bit_field) glClear(bit_field);
+        ClearFromNode(node_id);
         return;
     }
     auto& static_mesh = level_.GetStaticMeshFromId(mesh_id);
@@ -89,7 +138,7 @@ void Renderer::RenderNode(EntityId node_id, EntityId material_id, const glm::mat
         throw std::runtime_error("No material?");
     }
     MaterialInterface& material = level_.GetMaterialFromId(material_id);
-    RenderMesh(static_mesh, material, projection, view, node.GetLocalModel(t), t);
+    RenderMesh(static_mesh, material, projection, view, level_.GetWorldModelFromId(node_id), t);
 }
 
 void Renderer::RenderMesh(StaticMeshInterface& static_mesh, MaterialInterface& material,
@@ -109,11 +158,15 @@ void Renderer::RenderMesh(StaticMeshInterface& static_mesh, MaterialInterface& m
     last_program_id_ = program_id;
     assert(program.GetOutputTextureIds().size());
 
+    SetFrameUniformBlock(projection, view, t);
     // In case the camera doesn't exist it will create a basic one.
     UniformWrapper uniform_wrapper(projection, view, model, level_.GetDefaultEnvironmentModel(), t);
     // Go through the callback.
     callback_(uniform_wrapper, static_mesh, material);
     program.Use(uniform_wrapper);
+    if (auto* gl_program = dynamic_cast<Program*>(&program)) {
+        SetConstantInstanceModel(gl_program->GetInstanceModelLocation());
+    }
 
     auto texture_out_ids = program.GetOutputTextureIds();
     auto& texture_ref    = level_.GetTextureFromId(*texture_out_ids.cbegin());
@@ -126,16 +179,15 @@ void Renderer::RenderMesh(StaticMeshInterface& static_mesh, MaterialInterface& m
         if (level_.GetTextureFromId(texture_id).IsCubeMap()) {
             auto& opengl_texture =
                 dynamic_cast<TextureCubeMap&>(level_.GetTextureFromId(texture_id));
-            // TODO(anirul): Check the mipmap level (last parameter)!
             frame_buffer_.AttachTexture(opengl_texture.GetId(),
                                         FrameBuffer::GetFrameColorAttachment(i),
-                                        FrameBuffer::GetFrameTextureType(texture_frame_), 0);
+                                        FrameBuffer::GetFrameTextureType(texture_frame_),
+                                        mipmap_level_);
         } else {
             auto& opengl_texture = dynamic_cast<Texture&>(level_.GetTextureFromId(texture_id));
-            // TODO(anirul): Check the mipmap level (last parameter)!
             frame_buffer_.AttachTexture(opengl_texture.GetId(),
                                         FrameBuffer::GetFrameColorAttachment(i),
-                                        FrameTextureType::TEXTURE_2D, 0);
+                                        FrameTextureType::TEXTURE_2D, mipmap_level_);
         }
         i++;
     }
@@ -143,13 +195,7 @@ void Renderer::RenderMesh(StaticMeshInterface& static_mesh, MaterialInterface& m
 
     std::map<std::string, std::vector<std::int32_t>> uniform_include;
     for (const auto& id : material.GetIds()) {
-        EntityId texture_id = NullId;
-        if (level_.GetEnumTypeFromId(id) == EntityTypeEnum::TEXTURE) {
-            texture_id = id;
-        } else {
-            // TODO(anirul): Find a better way to find the texture associated with the stream.
-            texture_id = id + 1;
-        }
+        EntityId texture_id = GetTextureIdFromMaterialId(id);
         // TODO(anirul): Why? id and not texture id?
         const auto p  = material.EnableTextureId(id);
         auto& texture = level_.GetTextureFromId(texture_id);
@@ -172,41 +218,15 @@ void Renderer::RenderMesh(StaticMeshInterface& static_mesh, MaterialInterface& m
     // This was crashing the driver so...
     if (static_mesh.GetIndexSize()) {
         gl_index_buffer.Bind();
-        switch (static_mesh.GetRenderPrimitive()) {
-            case proto::SceneStaticMesh::TRIANGLE:
-                glDrawElements(
-                    GL_TRIANGLES,
-                    static_cast<GLsizei>(static_mesh.GetIndexSize()) / sizeof(std::uint32_t),
-                    GL_UNSIGNED_INT, nullptr);
-                break;
-            case proto::SceneStaticMesh::POINT:
-                glDrawElements(
-                    GL_POINTS,
-                    static_cast<GLsizei>(static_mesh.GetIndexSize()) / sizeof(std::uint32_t),
-                    GL_UNSIGNED_INT, nullptr);
-                break;
-            case proto::SceneStaticMesh::LINE:
-                glDrawElements(
-                    GL_LINES,
-                    static_cast<GLsizei>(static_mesh.GetIndexSize()) / sizeof(std::uint32_t),
-                    GL_UNSIGNED_INT, nullptr);
-                break;
-            default:
-                throw std::runtime_error(fmt::format(
-                    "Couldn't draw primitive {}", proto::SceneStaticMesh_RenderPrimitiveEnum_Name(
-                                                      static_mesh.GetRenderPrimitive())));
-        }
+        DrawElements(static_mesh);
         gl_index_buffer.UnBind();
     }
     program.UnUse();
     glBindVertexArray(0);
 
     for (const auto id : material.GetIds()) {
-        EntityId texture_id = id;
-        if (level_.GetEnumTypeFromId(id) != EntityTypeEnum::TEXTURE) {
-            texture_id = id + 1;
-        }
-        auto& texture = level_.GetTextureFromId(texture_id);
+        EntityId texture_id = GetTextureIdFromMaterialId(id);
+        auto& texture       = level_.GetTextureFromId(texture_id);
         if (texture.IsCubeMap()) {
             auto& gl_texture = dynamic_cast<TextureCubeMap&>(level_.GetTextureFromId(texture_id));
             gl_texture.UnBind();
@@ -274,12 +294,36 @@ void Renderer::RenderAllMeshes(const glm::mat4& projection, const glm::mat4& vie
     latest_time_ = t;
     // This will ensure that it is only true once.
     auto first_render = std::exchange(first_render_, false);
+    // Land the texture updates (from any thread) before anything is drawn.
+    for (const auto texture_id : level_.GetAllTextures()) {
+        auto& texture = level_.GetTextureFromId(texture_id);
+        if (!texture.IsCubeMap()) dynamic_cast<Texture&>(texture).FlushUpdate();
+    }
+    render_queue_.Clear();
+    culled_count_   = 0;
+    visible_count_  = 0;
+    occluded_count_ = 0;
+    // The pyramid of a previous frame is used (if one landed), the queries are reused.
+    if (occlusion_culling_) {
+        if (!hi_z_buffer_) hi_z_buffer_ = std::make_unique<HiZBuffer>();
+        hi_z_buffer_->Poll();
+        hi_z_buffer_->ResetQueries();
+    }
+    // One query in the hierarchy of the level instead of a test per node.
+    std::unordered_set<EntityId> visible_node_ids;
+    if (frustum_culling_) {
+        const auto node_ids = level_.GetNodesInFrustum(Frustum(projection * view));
+        visible_node_ids.insert(node_ids.begin(), node_ids.end());
+    }
     for (const auto& p : level_.GetStaticMeshMaterialIds()) {
         auto [material_id, render_time_enum] = p.second;
         // Check this is a pre render action and this is the first render.
         if (render_time_enum == proto::SceneStaticMesh::PRE_RENDER) {
             auto temp_viewport = viewport_;
             if (first_render) {
+                // Pre render is immediate so submit what was queued before (nothing can be culled
+                // as the rest of the frame is not known yet).
+                FlushRenderQueue(projection, view, t, false);
                 // Now this get the image size from the environment map.
                 auto& material = level_.GetMaterialFromId(material_id);
                 auto ids       = material.GetIds();
@@ -294,10 +338,350 @@ void Renderer::RenderAllMeshes(const glm::mat4& projection, const glm::mat4& vie
             }
             viewport_ = temp_viewport;
         } else {
+            // Bail out in case of no node.
+            if (p.first == NullId) continue;
+            if (frustum_culling_ && !IsNodeVisible(visible_node_ids, p.first)) {
+                ++culled_count_;
+                continue;
+            }
+            ++visible_count_;
             // This should also call clear buffers.
-            RenderNode(p.first, material_id, projection, view, t);
+            DrawItem draw_item        = CreateDrawItem(p.first, material_id);
+            draw_item.level_of_detail = SelectLevelOfDetail(draw_item, projection, view);
+            // Hidden in a previous frame, so only drawn if the GPU find it visible now (this
+            // avoid popping when something appears from behind an occluder).
+            if (occlusion_culling_ && draw_item.mesh_id != NullId &&
+                hi_z_buffer_->GetPyramid().IsOccluded(level_.GetWorldBoundingVolumeFromId(p.first),
+                                                      projection * view)) {
+                draw_item.occlusion_test = true;
+                ++occluded_count_;
+            }
+            render_queue_.Push(std::move(draw_item));
+        }
+    }
+    FlushRenderQueue(projection, view, t);
+}
+
+std::uint32_t Renderer::SelectLevelOfDetail(const DrawItem& draw_item, const glm::mat4& projection,
+                                            const glm::mat4& view) const {
+    if (draw_item.mesh_id == NullId) return 0;
+    const auto& static_mesh = level_.GetStaticMeshFromId(draw_item.mesh_id);
+    if (static_mesh.GetLevelOfDetailCount() == 1) return 0;
+    // Without a volume the size is unknown, so the full resolution is used.
+    const auto bounding_volume = level_.GetWorldBoundingVolumeFromId(draw_item.node_id);
+    if (!bounding_volume.IsValid()) return 0;
+    return static_mesh.SelectLevelOfDetail(ComputeScreenSize(bounding_volume, projection, view));
+}
+
+bool Renderer::IsNodeVisible(const std::unordered_set<EntityId>& visible_node_ids,
+                             EntityId node_id) const {
+    if (visible_node_ids.count(node_id)) return true;
+    // Nodes without a volume (clear events, meshes without positions) are not in the hierarchy.
+    return !level_.GetWorldBoundingVolumeFromId(node_id).IsValid();
+}
+
+DrawItem Renderer::CreateDrawItem(EntityId node_id, EntityId material_id) const {
+    DrawItem draw_item{};
+    draw_item.node_id = node_id;
+    draw_item.mesh_id = level_.GetSceneNodeFromId(node_id).GetLocalMesh();
+    // In case no mesh then this is a clear event.
+    if (!draw_item.mesh_id) return draw_item;
+    // Try to find the material for the mesh.
+    if (material_id == NullId) {
+        throw std::runtime_error("No material?");
+    }
+    auto& material        = level_.GetMaterialFromId(material_id);
+    draw_item.material_id = material_id;
+    draw_item.program_id  = material.GetProgramId();
+    draw_item.output_ids  = level_.GetProgramFromId(draw_item.program_id).GetOutputTextureIds();
+    for (const auto id : material.GetIds()) {
+        draw_item.input_ids.push_back(GetTextureIdFromMaterialId(id));
+    }
+    return draw_item;
+}
+
+void Renderer::FlushRenderQueue(const glm::mat4& projection, const glm::mat4& view, double t,
+                                bool end_of_frame /* = true*/) {
+    if (render_queue_.Empty()) return;
+    // The frame graph order is final (the aliasing depends on it), never sort it again.
+    const bool use_frame_graph = end_of_frame && level_.IsFrameGraphEnabled();
+    if (use_frame_graph) {
+        CompileFrameGraph();
+    } else {
+        render_queue_.Sort();
+    }
+    // Nothing is known about the GL state at this point.
+    state_cache_.Invalidate();
+    // The matrices and time are the same for the whole queue.
+    SetFrameUniformBlock(projection, view, t);
+    // The frame buffer binding is tracked by the state cache, so the attach and draw buffers calls
+    // should not bind and unbind it.
+    frame_buffer_.LockedBind();
+    EntityId previous_material_id = NullId;
+    const auto& draw_items        = use_frame_graph ? frame_graph_.GetDrawItems()
+                                                    : render_queue_.GetDrawItems();
+    std::size_t i                 = 0;
+    // The hierarchical depth is built after the last draw of a mesh with a world volume (the
+    // screen passes that follow don't write a depth that matters).
+    std::size_t hi_z_index = draw_items.size();
+    if (end_of_frame && occlusion_culling_ && hi_z_buffer_) {
+        for (std::size_t j = 0; j < draw_items.size(); ++j) {
+            if (draw_items[j].mesh_id != NullId &&
+                level_.GetWorldBoundingVolumeFromId(draw_items[j].node_id).IsValid()) {
+                hi_z_index = j;
+            }
+        }
+    }
+    while (i < draw_items.size()) {
+        const auto& draw_item = draw_items[i];
+        if (draw_item.mesh_id == NullId) {
+            // Clear events are on the default frame buffer (as in RenderNode).
+            state_cache_.BindFrameBuffer(0);
+            ClearFromNode(draw_item.node_id);
+            ++i;
+            continue;
+        }
+        // An instanced program draws all the following items with the same state in one call,
+        // other programs draw one item at a time.
+        std::size_t end = i + 1;
+        if (!draw_item.occlusion_test &&
+            dynamic_cast<Program&>(level_.GetProgramFromId(draw_item.program_id))
+                    .GetInstanceModelLocation() != -1) {
+            while (end < draw_items.size() && IsSameState(draw_items[end], draw_item)) ++end;
+        }
+        instance_models_.clear();
+        for (std::size_t j = i; j < end; ++j) {
+            AppendInstanceModels(draw_items[j].node_id, instance_models_);
+        }
+        if (draw_item.occlusion_test) {
+            // The box is tested against the depth of the target the item is drawn to.
+            state_cache_.BindFrameBuffer(frame_buffer_.GetId());
+            state_cache_.Viewport(viewport_);
+            hi_z_buffer_->BeginConditionalDraw(
+                level_.GetWorldBoundingVolumeFromId(draw_item.node_id), projection * view);
+            state_cache_.InvalidateDraw();
+        }
+        SubmitDrawItem(draw_item, projection, view, t,
+                       previous_material_id != draw_item.material_id, instance_models_);
+        if (draw_item.occlusion_test) hi_z_buffer_->EndConditionalDraw();
+        previous_material_id = draw_item.material_id;
+        if (i <= hi_z_index && hi_z_index < end) {
+            hi_z_buffer_->Build(frame_buffer_.GetId(), glm::uvec2(viewport_.z - viewport_.x,
+                                                                  viewport_.w - viewport_.y));
+            // The frame buffer, viewport, program and vertex array were changed.
+            state_cache_.Invalidate();
+        }
+        i = end;
+    }
+    frame_buffer_.UnlockedBind();
+    logger_->debug("Render queue skipped {} GL calls.", state_cache_.GetSkippedCount());
+    state_cache_.Reset();
+    render_queue_.Clear();
+}
+
+void Renderer::SetFrameUniformBlock(const glm::mat4& projection, const glm::mat4& view,
+                                    double t) {
+    FrameUniformBlock frame_uniform_block = {};
+    frame_uniform_block.projection        = projection;
+    frame_uniform_block.view              = view;
+    frame_uniform_block.environment_model = level_.GetDefaultEnvironmentModel();
+    frame_uniform_block.time_s            = static_cast<float>(t);
+    if (frame_uniform_block_valid_ &&
+        !std::memcmp(&frame_uniform_block, &frame_uniform_block_, sizeof(FrameUniformBlock))) {
+        return;
+    }
+    frame_uniform_buffer_.Copy(sizeof(FrameUniformBlock), &frame_uniform_block);
+    glBindBufferBase(GL_UNIFORM_BUFFER, frame_uniform_block_binding, frame_uniform_buffer_.GetId());
+    frame_uniform_block_       = frame_uniform_block;
+    frame_uniform_block_valid_ = true;
+}
+
+void Renderer::CompileFrameGraph() {
+    frame_graph_.Compile(render_queue_.GetDrawItems(), { level_.GetDefaultOutputTextureId() },
+                         transient_classes_);
+    logger_->debug("Frame graph culled {} draw items.", frame_graph_.GetCulledCount());
+    // Create the memory of the slots, a slot whose class changed is recreated.
+    const auto& slot_classes = frame_graph_.GetSlotClasses();
+    if (slot_textures_.size() < slot_classes.size()) {
+        slot_textures_.resize(slot_classes.size());
+        slot_texture_classes_.resize(slot_classes.size());
+    }
+    for (std::size_t slot = 0; slot < slot_classes.size(); ++slot) {
+        if (slot_textures_[slot] && slot_texture_classes_[slot] == slot_classes[slot]) continue;
+        auto& texture = dynamic_cast<Texture&>(
+            level_.GetTextureFromId(transient_class_texture_ids_[slot_classes[slot]]));
+        TextureParameter texture_parameter = {};
+        texture_parameter.pixel_element_size.set_value(texture.GetPixelElementSize());
+        texture_parameter.pixel_structure.set_value(texture.GetPixelStructure());
+        texture_parameter.size = texture.GetSize();
+        slot_textures_[slot]   = std::make_unique<Texture>(texture_parameter);
+        slot_textures_[slot]->SetMinFilter(texture.GetMinFilter());
+        slot_textures_[slot]->SetMagFilter(texture.GetMagFilter());
+        slot_textures_[slot]->SetWrapS(texture.GetWrapS());
+        slot_textures_[slot]->SetWrapT(texture.GetWrapT());
+        slot_texture_classes_[slot] = slot_classes[slot];
+    }
+    for (const auto& [texture_id, slot] : frame_graph_.GetTextureSlots()) {
+        dynamic_cast<Texture&>(level_.GetTextureFromId(texture_id))
+            .SetAlias(slot_textures_[slot]->GetId());
+    }
+}
+
+void Renderer::CreateTransientClasses() {
+    using TextureClass = std::tuple<std::uint32_t, std::uint32_t, int, int, int, int, int, int>;
+    std::map<TextureClass, std::size_t> texture_classes;
+    for (const auto texture_id : level_.GetAllTextures()) {
+        auto& texture = level_.GetTextureFromId(texture_id);
+        if (texture.IsCubeMap() || !dynamic_cast<Texture&>(texture).IsTransient()) continue;
+        const auto size = texture.GetSize();
+        const TextureClass texture_class{ size.x,
+                                          size.y,
+                                          texture.GetPixelElementSize(),
+                                          texture.GetPixelStructure(),
+                                          texture.GetMinFilter(),
+                                          texture.GetMagFilter(),
+                                          texture.GetWrapS(),
+                                          texture.GetWrapT() };
+        auto it = texture_classes.find(texture_class);
+        if (it == texture_classes.end()) {
+            it = texture_classes.emplace(texture_class, transient_class_texture_ids_.size()).first;
+            transient_class_texture_ids_.push_back(texture_id);
+        }
+        transient_classes_.emplace(texture_id, it->second);
+    }
+}
+
+void Renderer::AppendInstanceModels(EntityId node_id, std::vector<glm::mat4>& models) const {
+    const glm::mat4 model  = level_.GetWorldModelFromId(node_id);
+    auto* node_static_mesh = dynamic_cast<NodeStaticMesh*>(&level_.GetSceneNodeFromId(node_id));
+    if (!node_static_mesh || node_static_mesh->GetInstanceModels().empty()) {
+        models.push_back(model);
+        return;
+    }
+    for (const auto& instance_model : node_static_mesh->GetInstanceModels()) {
+        models.push_back(model * instance_model);
+    }
+}
+
+void Renderer::SubmitDrawItem(const DrawItem& draw_item, const glm::mat4& projection,
+                              const glm::mat4& view, double t, bool material_changed,
+                              const std::vector<glm::mat4>& models) {
+    assert(!models.empty());
+    auto& static_mesh = level_.GetStaticMeshFromId(draw_item.mesh_id);
+    auto& material    = level_.GetMaterialFromId(draw_item.material_id);
+    auto& program     = dynamic_cast<Program&>(level_.GetProgramFromId(draw_item.program_id));
+    last_program_id_  = draw_item.program_id;
+    assert(draw_item.output_ids.size());
+
+    state_cache_.BindFrameBuffer(frame_buffer_.GetId());
+    if (static_mesh.IsClearBuffer()) {
+        glClear(GL_DEPTH_BUFFER_BIT);
+    }
+
+    // Instanced programs get the model from the instance buffer.
+    const int instance_location = program.GetInstanceModelLocation();
+    const bool instanced        = instance_location != -1 && models.size() > 1;
+    UniformWrapper uniform_wrapper(projection, view, instanced ? glm::mat4(1.0f) : models.front(),
+                                   level_.GetDefaultEnvironmentModel(), t);
+    // Go through the callback.
+    callback_(uniform_wrapper, static_mesh, material);
+    const bool program_changed = state_cache_.UseProgram(program.GetId());
+    program.SetUniforms(uniform_wrapper);
+
+    state_cache_.Viewport(viewport_);
+
+    int i = 0;
+    for (const auto& texture_id : draw_item.output_ids) {
+        auto& texture = level_.GetTextureFromId(texture_id);
+        if (texture.IsCubeMap()) {
+            auto& opengl_texture = dynamic_cast<TextureCubeMap&>(texture);
+            state_cache_.AttachTexture(frame_buffer_, opengl_texture.GetId(),
+                                       FrameBuffer::GetFrameColorAttachment(i),
+                                       FrameBuffer::GetFrameTextureType(texture_frame_),
+                                       mipmap_level_);
+        } else {
+            auto& opengl_texture = dynamic_cast<Texture&>(texture);
+            state_cache_.AttachTexture(frame_buffer_, opengl_texture.GetId(),
+                                       FrameBuffer::GetFrameColorAttachment(i),
+                                       FrameTextureType::TEXTURE_2D, mipmap_level_);
         }
+        i++;
+    }
+    state_cache_.DrawBuffers(frame_buffer_,
+                             static_cast<std::uint32_t>(draw_item.output_ids.size()));
+
+    for (const auto& id : material.GetIds()) {
+        const auto p  = material.EnableTextureId(id);
+        auto& texture = level_.GetTextureFromId(GetTextureIdFromMaterialId(id));
+        if (texture.IsCubeMap()) {
+            auto& gl_texture = dynamic_cast<TextureCubeMap&>(texture);
+            state_cache_.BindTexture(p.second, GL_TEXTURE_CUBE_MAP, gl_texture.GetId());
+        } else {
+            auto& gl_texture = dynamic_cast<Texture&>(texture);
+            state_cache_.BindTexture(p.second, GL_TEXTURE_2D, gl_texture.GetId());
+        }
+        // Sampler uniforms are kept by the program, only set them when something changed.
+        if (program_changed || material_changed) {
+            program.Uniform(p.first, p.second);
+        }
+    }
+    material.DisableAll();
+
+    // The index buffer binding is part of the vertex array state.
+    auto& gl_static_mesh = dynamic_cast<StaticMesh&>(static_mesh);
+    if (state_cache_.BindVertexArray(gl_static_mesh.GetId())) {
+        auto& gl_index_buffer =
+            dynamic_cast<Buffer&>(level_.GetBufferFromId(static_mesh.GetIndexBufferId()));
+        gl_index_buffer.Bind();
+    }
+    // This was crashing the driver so...
+    if (!static_mesh.GetIndexSize()) return;
+    if (instanced) {
+        // Upload the models and point the 4 columns of the attribute to the instance buffer.
+        instance_buffer_.Copy(models.size() * sizeof(glm::mat4), models.data());
+        instance_buffer_.Bind();
+        for (GLuint i = 0; i < 4; ++i) {
+            glEnableVertexAttribArray(instance_location + i);
+            glVertexAttribPointer(instance_location + i, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                                  reinterpret_cast<const void*>(i * sizeof(glm::vec4)));
+            glVertexAttribDivisor(instance_location + i, 1);
+        }
+        instance_buffer_.UnBind();
+        DrawElements(static_mesh, draw_item.level_of_detail, static_cast<GLsizei>(models.size()));
+        for (GLuint i = 0; i < 4; ++i) {
+            glVertexAttribDivisor(instance_location + i, 0);
+            glDisableVertexAttribArray(instance_location + i);
+        }
+        return;
+    }
+    SetConstantInstanceModel(instance_location);
+    DrawElements(static_mesh, draw_item.level_of_detail);
+    // Program that are not instanced draw the instances one by one.
+    const int model_location = program.GetUniformLocation(UniformSlotEnum::MODEL);
+    for (std::size_t i = 1; i < models.size(); ++i) {
+        if (model_location != -1) {
+            glUniformMatrix4fv(model_location, 1, GL_FALSE, &models[i][0][0]);
+        }
+        DrawElements(static_mesh, draw_item.level_of_detail);
+    }
+}
+
+void Renderer::ClearFromNode(EntityId node_id) {
+    // Try to cast to a node static mesh.
+    auto& node_static_mesh     = dynamic_cast<NodeStaticMesh&>(level_.GetSceneNodeFromId(node_id));
+    GLbitfield bit_field       = 0;
+    std::uint32_t clean_buffer = node_static_mesh.GetCleanBuffer();
+    if (clean_buffer | proto::CleanBuffer::CLEAR_COLOR) bit_field += GL_COLOR_BUFFER_BIT;
+    if (clean_buffer | proto::CleanBuffer::CLEAR_DEPTH) bit_field += GL_DEPTH_BUFFER_BIT;
+    if (bit_field) glClear(bit_field);
+}
+
+EntityId Renderer::GetTextureIdFromMaterialId(EntityId id) const {
+    if (level_.GetEnumTypeFromId(id) == EntityTypeEnum::TEXTURE) {
+        return id;
     }
+    // TODO(anirul): Find a better way to find the texture associated with the stream.
+    return id + 1;
 }
 
 double Renderer::GetLatestTime() const { return latest_time_; }
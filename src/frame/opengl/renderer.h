@@ -1,9 +1,20 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
+#include "frame/frustum.h"
+#include "frame/opengl/buffer.h"
 #include "frame/opengl/frame_buffer.h"
+#include "frame/opengl/frame_graph.h"
+#include "frame/opengl/hi_z_buffer.h"
 #include "frame/opengl/render_buffer.h"
+#include "frame/opengl/render_queue.h"
+#include "frame/opengl/state_cache.h"
+#include "frame/opengl/texture.h"
+#include "frame/opengl/uniform_block.h"
 #include "frame/program_interface.h"
 #include "frame/renderer_interface.h"
 #include "frame/static_mesh_interface.h"
@@ -48,6 +59,11 @@ class Renderer : public RendererInterface {
     void SetCubeMapTarget(frame::proto::TextureFrame texture_frame) override {
         texture_frame_ = texture_frame;
     }
+    /**
+     * @brief Set the mipmap level of the output textures (used in the render mesh method).
+     * @param mipmap_level: The mipmap level to render to (0 is the full size).
+     */
+    void SetMipmapTarget(int mipmap_level) { mipmap_level_ = mipmap_level; }
     /**
      * @brief Get the last program id.
      * @return The id of the last program used by this renderer.
@@ -90,7 +106,8 @@ class Renderer : public RendererInterface {
     void RenderNode(EntityId node_id, EntityId material_id, const glm::mat4& projection,
                     const glm::mat4& view, double dt = 0.0) override;
     /**
-     * @brief Render all meshes at a dt time.
+     * @brief Render all meshes at a dt time, the per frame meshes are collected in a render queue,
+     * sorted by state and submitted through the state cache.
      * @param dt: Delta time between the beginning of execution and now in seconds.
      */
     void RenderAllMeshes(const glm::mat4& projection, const glm::mat4& view,
@@ -112,6 +129,126 @@ class Renderer : public RendererInterface {
      * @return The latest time point for the renderer.
      */
     double GetLatestTime() const override;
+    /**
+     * @brief Enable or disable the frustum culling of the per frame meshes (enabled by default),
+     * meshes without a bounding volume are never culled.
+     * @param enable: Enable or disable the frustum culling.
+     */
+    void SetFrustumCulling(bool enable) { frustum_culling_ = enable; }
+    /**
+     * @brief Get the number of nodes rejected by the frustum culling during the last frame.
+     * @return Number of culled nodes.
+     */
+    std::size_t GetCulledCount() const { return culled_count_; }
+    /**
+     * @brief Get the number of nodes that passed the frustum culling during the last frame.
+     * @return Number of visible nodes.
+     */
+    std::size_t GetVisibleCount() const { return visible_count_; }
+    /**
+     * @brief Enable or disable the occlusion culling of the per frame meshes (disabled by default):
+     * the nodes hidden in the hierarchical depth of a previous frame are only drawn if their world
+     * box passes the depth test of the current frame (conditional rendering).
+     * @param enable: Enable or disable the occlusion culling.
+     */
+    void SetOcclusionCulling(bool enable) { occlusion_culling_ = enable; }
+    /**
+     * @brief Get the number of visible nodes found hidden by the occlusion culling during the last
+     * frame (they are still re-tested on the GPU).
+     * @return Number of occluded nodes.
+     */
+    std::size_t GetOccludedCount() const { return occluded_count_; }
+    /**
+     * @brief Get the number of nodes drawn without occlusion test during the last frame.
+     * @return Number of visible nodes that were not occluded.
+     */
+    std::size_t GetDrawnCount() const { return visible_count_ - occluded_count_; }
+
+   protected:
+    /**
+     * @brief Create a draw item from a node and a material (used to fill the render queue).
+     * @param node_id: Node to be rendered.
+     * @param material_id: Material id to be used.
+     * @return A draw item (with a NullId mesh id in case of a clear event).
+     */
+    DrawItem CreateDrawItem(EntityId node_id, EntityId material_id) const;
+    /**
+     * @brief Check a node against the result of the frustum query of the level.
+     * @param visible_node_ids: Nodes whose world volume touches the frustum.
+     * @param node_id: Node to be tested.
+     * @return False if the node has a world volume and it is outside of the frustum.
+     */
+    bool IsNodeVisible(const std::unordered_set<EntityId>& visible_node_ids,
+                       EntityId node_id) const;
+    /**
+     * @brief Select the level of detail of a draw item from the projected size of its node.
+     * @param draw_item: Item to be drawn.
+     * @param projection: Projection matrix used.
+     * @param view: View matrix used.
+     * @return The level of detail of the mesh (0 if it has none or the node has no volume).
+     */
+    std::uint32_t SelectLevelOfDetail(const DrawItem& draw_item, const glm::mat4& projection,
+                                      const glm::mat4& view) const;
+    /**
+     * @brief Sort the render queue and submit all the draw items it contains, then empty it.
+     * @param projection: Projection matrix used.
+     * @param view: View matrix used.
+     * @param dt: Delta time between the beginning of execution and now in seconds.
+     * @param end_of_frame: Is this the last flush of the frame, only then the frame graph can
+     * cull the passes (if enabled in the level).
+     */
+    void FlushRenderQueue(const glm::mat4& projection, const glm::mat4& view, double dt,
+                          bool end_of_frame = true);
+    /**
+     * @brief Write the per frame uniform block (only if it changed) and bind it to its binding
+     * point, the programs using it don't get the matrices and time uploaded per draw.
+     * @param projection: Projection matrix used.
+     * @param view: View matrix used.
+     * @param dt: Delta time between the beginning of execution and now in seconds.
+     */
+    void SetFrameUniformBlock(const glm::mat4& projection, const glm::mat4& view, double dt);
+    /**
+     * @brief Schedule the render queue with the frame graph and point the transient textures to
+     * the memory of their slot (created or recreated when needed).
+     */
+    void CompileFrameGraph();
+    /**
+     * @brief Sort the transient textures of the level by compatibility class (same size, format
+     * and filters), only textures of the same class can share their memory.
+     */
+    void CreateTransientClasses();
+    /**
+     * @brief Append the model matrices of a node (one per instance) to a list, the world model
+     * of the node is the one computed by the level for the current frame.
+     * @param node_id: Node to get the model matrices from.
+     * @param models: List the model matrices are appended to.
+     */
+    void AppendInstanceModels(EntityId node_id, std::vector<glm::mat4>& models) const;
+    /**
+     * @brief Draw an item through the state cache (only called from FlushRenderQueue), in case the
+     * program has an instance model attribute all the models are drawn in a single instanced call,
+     * otherwise there is one draw per model.
+     * @param draw_item: Item to be drawn.
+     * @param projection: Projection matrix used.
+     * @param view: View matrix used.
+     * @param dt: Delta time between the beginning of execution and now in seconds.
+     * @param material_changed: Is the material different from the previous draw.
+     * @param models: Model matrices to draw the mesh with (at least one).
+     */
+    void SubmitDrawItem(const DrawItem& draw_item, const glm::mat4& projection,
+                        const glm::mat4& view, double dt, bool material_changed,
+                        const std::vector<glm::mat4>& models);
+    /**
+     * @brief Clear the buffers from a node that has no mesh (clear event).
+     * @param node_id: Node containing the clear flags.
+     */
+    void ClearFromNode(EntityId node_id);
+    /**
+     * @brief Get the texture id from an id in a material (stream ids point to their texture).
+     * @param id: Id present in the material.
+     * @return The id of the texture.
+     */
+    EntityId GetTextureIdFromMaterialId(EntityId id) const;
 
    private:
     LevelInterface& level_;
@@ -131,11 +268,37 @@ class Renderer : public RendererInterface {
     EntityId display_material_id_ = 0;
     // Texture frame (used in render mesh).
     frame::proto::TextureFrame texture_frame_;
+    int mipmap_level_  = 0;
     bool first_render_ = true;
     // The render callback it will be called once per mesh.
     RenderCallback callback_ = [](UniformInterface&, StaticMeshInterface&, MaterialInterface&) {};
     // Tracks the renderer time.
     double latest_time_ = 0.;
+    // Per frame draw items and the GL state they are submitted through.
+    RenderQueue render_queue_ = {};
+    StateCache state_cache_   = {};
+    // Frame graph, transient textures class, representative of every class and memory of the
+    // slots (with their class).
+    FrameGraph frame_graph_                              = {};
+    std::map<EntityId, std::size_t> transient_classes_   = {};
+    std::vector<EntityId> transient_class_texture_ids_   = {};
+    std::vector<std::unique_ptr<Texture>> slot_textures_ = {};
+    std::vector<std::size_t> slot_texture_classes_       = {};
+    // Per frame uniform block (the last written content) and its buffer.
+    FrameUniformBlock frame_uniform_block_ = {};
+    bool frame_uniform_block_valid_        = false;
+    Buffer frame_uniform_buffer_{ BufferTypeEnum::UNIFORM_BUFFER, BufferUsageEnum::DYNAMIC_DRAW };
+    // Model matrices of the current instanced draw and the buffer they are streamed to.
+    std::vector<glm::mat4> instance_models_ = {};
+    Buffer instance_buffer_{ BufferTypeEnum::ARRAY_BUFFER, BufferUsageEnum::STREAM_DRAW };
+    // Frustum culling of the per frame meshes and the counters of the last frame.
+    bool frustum_culling_      = true;
+    std::size_t culled_count_  = 0;
+    std::size_t visible_count_ = 0;
+    // Occlusion culling (the buffer is created on the first frame it is enabled).
+    bool occlusion_culling_                 = false;
+    std::unique_ptr<HiZBuffer> hi_z_buffer_ = nullptr;
+    std::size_t occluded_count_             = 0;
 };
 
 }  // End namespace frame::opengl.
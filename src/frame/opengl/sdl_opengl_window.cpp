@@ -120,7 +120,7 @@ bool SDLOpenGLWindow::RunEvent(const SDL_Event& event, const double dt) {
                 return false;
             }
             case SDLK_PRINTSCREEN:
-                device_->ScreenShot("ScreenShot.png");
+                device_->ScreenShotAsync("ScreenShot.png");
                 return true;
         }
         if (key_callbacks_.count(event.key.keysym.sym)) {
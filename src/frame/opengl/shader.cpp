@@ -12,10 +12,19 @@ Shader::~Shader() {
 }
 
 bool Shader::LoadFromSource(const std::string& source) {
+    Compile(source);
+    return CheckCompile();
+}
+
+void Shader::Compile(const std::string& source) {
     id_                  = glCreateShader(static_cast<unsigned int>(type_));
     const char* c_source = source.c_str();
     glShaderSource(id_, 1, &c_source, nullptr);
     glCompileShader(id_);
+    created_ = true;
+}
+
+bool Shader::CheckCompile() {
     int result;
     glGetShaderiv(id_, GL_COMPILE_STATUS, &result);
     if (result == GL_FALSE) {
@@ -27,7 +36,6 @@ bool Shader::LoadFromSource(const std::string& source) {
         created_ = false;
         return false;
     }
-    created_       = true;
     error_message_ = "";
     return true;
 }
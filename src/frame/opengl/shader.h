@@ -32,6 +32,18 @@ class Shader {
      * @param source: Content of the shader in text form.
      */
     bool LoadFromSource(const std::string& source);
+    /**
+     * @brief Submit the compilation of a shader source without waiting for the result (the
+     * compilation can run in parallel with KHR_parallel_shader_compile).
+     * @param source: Content of the shader in text form.
+     */
+    void Compile(const std::string& source);
+    /**
+     * @brief Get the result of the compilation (wait for it if needed), in case of error the
+     * shader is deleted and the error message is set.
+     * @return True if the shader compiled.
+     */
+    bool CheckCompile();
 
    public:
     /**
@@ -0,0 +1,115 @@
+#include "frame/opengl/state_cache.h"
+
+#include <GL/glew.h>
+
+namespace frame::opengl {
+
+bool StateCache::UseProgram(unsigned int program_id) {
+    if (program_id_ == program_id) {
+        skipped_count_++;
+        return false;
+    }
+    glUseProgram(program_id);
+    program_id_ = program_id;
+    return true;
+}
+
+bool StateCache::BindVertexArray(unsigned int vertex_array_id) {
+    if (vertex_array_id_ == vertex_array_id) {
+        skipped_count_++;
+        return false;
+    }
+    glBindVertexArray(vertex_array_id);
+    vertex_array_id_ = vertex_array_id;
+    return true;
+}
+
+bool StateCache::BindTexture(unsigned int slot, unsigned int target, unsigned int texture_id) {
+    auto it = slot_texture_map_.find(slot);
+    if (it != slot_texture_map_.end() && it->second == std::make_pair(target, texture_id)) {
+        skipped_count_++;
+        return false;
+    }
+    glActiveTexture(GL_TEXTURE0 + slot);
+    // Another target was bound on this slot, remove it so it doesn't leak to the next program.
+    if (it != slot_texture_map_.end() && it->second.first != target) {
+        glBindTexture(it->second.first, 0);
+    }
+    glBindTexture(target, texture_id);
+    slot_texture_map_[slot] = { target, texture_id };
+    return true;
+}
+
+bool StateCache::BindFrameBuffer(unsigned int frame_buffer_id) {
+    if (frame_buffer_id_ == frame_buffer_id) {
+        skipped_count_++;
+        return false;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_id);
+    frame_buffer_id_ = frame_buffer_id;
+    return true;
+}
+
+bool StateCache::AttachTexture(const FrameBuffer& frame_buffer, unsigned int texture_id,
+                               FrameColorAttachment frame_color_attachment,
+                               FrameTextureType frame_texture_type, int mipmap /* = 0*/) {
+    auto value = std::make_tuple(texture_id, frame_texture_type, mipmap);
+    auto it    = attachment_map_.find(frame_color_attachment);
+    if (it != attachment_map_.end() && it->second == value) {
+        skipped_count_++;
+        return false;
+    }
+    frame_buffer.AttachTexture(texture_id, frame_color_attachment, frame_texture_type, mipmap);
+    attachment_map_[frame_color_attachment] = value;
+    return true;
+}
+
+bool StateCache::DrawBuffers(FrameBuffer& frame_buffer, std::uint32_t size) {
+    if (draw_buffer_count_ == size) {
+        skipped_count_++;
+        return false;
+    }
+    frame_buffer.DrawBuffers(size);
+    draw_buffer_count_ = size;
+    return true;
+}
+
+bool StateCache::Viewport(glm::uvec4 viewport) {
+    if (viewport_ == viewport) {
+        skipped_count_++;
+        return false;
+    }
+    glViewport(viewport.x, viewport.y, viewport.z, viewport.w);
+    viewport_ = viewport;
+    return true;
+}
+
+void StateCache::Invalidate() {
+    program_id_        = unknown_;
+    vertex_array_id_   = unknown_;
+    frame_buffer_id_   = unknown_;
+    draw_buffer_count_ = 0;
+    viewport_          = glm::uvec4(unknown_);
+    slot_texture_map_.clear();
+    attachment_map_.clear();
+    skipped_count_ = 0;
+}
+
+void StateCache::InvalidateDraw() {
+    program_id_      = unknown_;
+    vertex_array_id_ = unknown_;
+}
+
+void StateCache::Reset() {
+    for (const auto& [slot, target_texture] : slot_texture_map_) {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(target_texture.first, 0);
+    }
+    glActiveTexture(GL_TEXTURE0);
+    if (vertex_array_id_ != unknown_) glBindVertexArray(0);
+    if (program_id_ != unknown_) glUseProgram(0);
+    if (frame_buffer_id_ != unknown_) glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    Invalidate();
+}
+
+}  // End namespace frame::opengl.
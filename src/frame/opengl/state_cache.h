@@ -0,0 +1,99 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <map>
+#include <tuple>
+
+#include "frame/opengl/frame_buffer.h"
+
+namespace frame::opengl {
+
+/**
+ * @class StateCache
+ * @brief Shadow copy of the part of the OpenGL state touched by the renderer. Every call compare
+ * the requested state with the last one that was set and skip the GL call if nothing changed.
+ * @warning The cache is only valid as long as nobody else change the GL state behind its back, so
+ * call Invalidate before using it after any other GL code was executed.
+ */
+class StateCache {
+   public:
+    /**
+     * @brief Use a program (glUseProgram) if it is not already in use.
+     * @param program_id: OpenGL id of the program.
+     * @return True if the program was changed.
+     */
+    bool UseProgram(unsigned int program_id);
+    /**
+     * @brief Bind a vertex array (glBindVertexArray) if it is not already bound.
+     * @param vertex_array_id: OpenGL id of the vertex array object.
+     * @return True if the vertex array was changed.
+     */
+    bool BindVertexArray(unsigned int vertex_array_id);
+    /**
+     * @brief Bind a texture to a slot (glActiveTexture & glBindTexture) if it is not already there.
+     * @param slot: Texture unit to be used.
+     * @param target: OpenGL texture target (GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, ...).
+     * @param texture_id: OpenGL id of the texture.
+     * @return True if the texture was changed.
+     */
+    bool BindTexture(unsigned int slot, unsigned int target, unsigned int texture_id);
+    /**
+     * @brief Bind a frame buffer (glBindFramebuffer) if it is not already bound.
+     * @param frame_buffer_id: OpenGL id of the frame buffer (0 for the default one).
+     * @return True if the frame buffer was changed.
+     */
+    bool BindFrameBuffer(unsigned int frame_buffer_id);
+    /**
+     * @brief Attach a texture to the frame buffer if it is not already attached at this point.
+     * @param frame_buffer: Frame buffer to attach to (should be bound).
+     * @param texture_id: Id of the texture.
+     * @param frame_color_attachment: On which frame do you need the attachment to be made.
+     * @param frame_texture_type: What kind of texture is it normal or cubemap element.
+     * @param mipmap: Mipmap level.
+     * @return True if the attachment was changed.
+     */
+    bool AttachTexture(const FrameBuffer& frame_buffer, unsigned int texture_id,
+                       FrameColorAttachment frame_color_attachment,
+                       FrameTextureType frame_texture_type, int mipmap = 0);
+    /**
+     * @brief Set the draw buffers of the frame buffer if the count changed.
+     * @param frame_buffer: Frame buffer to set the draw buffers to (should be bound).
+     * @param size: Which draw buffer should be drawn upon [1, 8].
+     * @return True if the draw buffers were changed.
+     */
+    bool DrawBuffers(FrameBuffer& frame_buffer, std::uint32_t size);
+    /**
+     * @brief Set the viewport (glViewport) if it changed.
+     * @param viewport: Viewport top left and size.
+     * @return True if the viewport was changed.
+     */
+    bool Viewport(glm::uvec4 viewport);
+    //! @brief Forget everything (someone else touched the GL state), doesn't do any GL call.
+    void Invalidate();
+    //! @brief Forget the program and the vertex array (someone else drew with its own).
+    void InvalidateDraw();
+    //! @brief Unbind everything that was bound through the cache and forget the state.
+    void Reset();
+    /**
+     * @brief Get the number of GL calls that were skipped since the last invalidate.
+     * @return Number of skipped calls.
+     */
+    std::uint32_t GetSkippedCount() const { return skipped_count_; }
+
+   private:
+    // The value used for unknown state (can never be a valid GL name).
+    static constexpr unsigned int unknown_ = 0xffffffff;
+    unsigned int program_id_               = unknown_;
+    unsigned int vertex_array_id_          = unknown_;
+    unsigned int frame_buffer_id_          = unknown_;
+    std::uint32_t draw_buffer_count_       = 0;
+    glm::uvec4 viewport_                   = glm::uvec4(unknown_);
+    // Slot -> (target, texture id).
+    std::map<unsigned int, std::pair<unsigned int, unsigned int>> slot_texture_map_ = {};
+    // Attachment -> (texture id, texture type, mipmap).
+    std::map<FrameColorAttachment, std::tuple<unsigned int, FrameTextureType, int>>
+        attachment_map_          = {};
+    std::uint32_t skipped_count_ = 0;
+};
+
+}  // End namespace frame::opengl.
@@ -19,8 +19,15 @@ StaticMesh::StaticMesh(LevelInterface& level, const StaticMeshParameter& paramet
       normal_buffer_size_(parameter.normal_buffer_size),
       texture_buffer_id_(parameter.texture_buffer_id),
       texture_buffer_size_(parameter.texture_buffer_size),
+      vertex_buffer_id_(parameter.vertex_buffer_id),
       index_buffer_id_(parameter.index_buffer_id),
-      render_primitive_enum_(parameter.render_primitive_enum) {
+      index_element_size_(parameter.index_element_size),
+      render_primitive_enum_(parameter.render_primitive_enum),
+      level_of_detail_offsets_(parameter.level_of_detail_offsets) {
+    if (vertex_buffer_id_) {
+        CreateInterleavedAttributes(parameter);
+        return;
+    }
     if (!point_buffer_id_) throw std::runtime_error("No point buffer specified.");
     // Create a new vertex array (to render the mesh).
     glGenVertexArrays(1, &vertex_array_object_);
@@ -148,9 +155,54 @@ StaticMesh::StaticMesh(LevelInterface& level, const StaticMeshParameter& paramet
     glBindVertexArray(0);
 }
 
+void StaticMesh::CreateInterleavedAttributes(const StaticMeshParameter& parameter) {
+    if (!index_buffer_id_) throw std::runtime_error("No index buffer for interleaved mesh.");
+    if (parameter.vertex_attributes.empty()) throw std::runtime_error("No vertex attributes.");
+    // Create a new vertex array (to render the mesh).
+    glGenVertexArrays(1, &vertex_array_object_);
+    glBindVertexArray(vertex_array_object_);
+    // All the attributes point to the same buffer.
+    auto& vertex_buffer_ref = dynamic_cast<Buffer&>(level_.GetBufferFromId(vertex_buffer_id_));
+    vertex_buffer_ref.Bind();
+    for (const auto& vertex_attribute : parameter.vertex_attributes) {
+        GLenum type = GL_FLOAT;
+        switch (vertex_attribute.format) {
+            case VertexAttributeFormatEnum::FLOAT:
+                type = GL_FLOAT;
+                break;
+            case VertexAttributeFormatEnum::HALF_FLOAT:
+                type = GL_HALF_FLOAT;
+                break;
+            case VertexAttributeFormatEnum::INT_2_10_10_10_REV:
+                type = GL_INT_2_10_10_10_REV;
+                break;
+            case VertexAttributeFormatEnum::UNSIGNED_BYTE:
+                type = GL_UNSIGNED_BYTE;
+                break;
+            default:
+                throw std::runtime_error(
+                    fmt::format("Unknown vertex attribute format {}.",
+                                static_cast<int>(vertex_attribute.format)));
+        }
+        glVertexAttribPointer(vertex_attribute.location, vertex_attribute.size, type,
+                              vertex_attribute.normalized ? GL_TRUE : GL_FALSE,
+                              parameter.vertex_stride,
+                              reinterpret_cast<const void*>(
+                                  static_cast<std::uintptr_t>(vertex_attribute.offset)));
+        glEnableVertexAttribArray(vertex_attribute.location);
+    }
+    vertex_buffer_ref.UnBind();
+    index_size_ = level_.GetBufferFromId(index_buffer_id_).GetSize();
+    SetRenderPrimitive(render_primitive_enum_);
+    glBindVertexArray(0);
+}
+
 StaticMesh::~StaticMesh() {
     glDeleteVertexArrays(1, &vertex_array_object_);
     // Try to delete assigned buffers.
+    if (vertex_buffer_id_) {
+        level_.RemoveBuffer(vertex_buffer_id_);
+    }
     if (point_buffer_id_) {
         level_.RemoveBuffer(point_buffer_id_);
     }
@@ -168,6 +220,44 @@ StaticMesh::~StaticMesh() {
     }
 }
 
+std::pair<std::size_t, std::size_t> StaticMesh::GetLevelOfDetailIndexRange(
+    std::uint32_t level_of_detail) const {
+    const std::size_t index_count = index_size_ / index_element_size_;
+    if (level_of_detail_offsets_.empty()) {
+        if (level_of_detail) {
+            throw std::runtime_error(
+                fmt::format("No level of detail {} in mesh {}.", level_of_detail, name_));
+        }
+        return { 0, index_count };
+    }
+    if (level_of_detail >= level_of_detail_offsets_.size()) {
+        throw std::runtime_error(
+            fmt::format("No level of detail {} in mesh {}.", level_of_detail, name_));
+    }
+    const std::size_t end = (level_of_detail + 1 < level_of_detail_offsets_.size())
+                                ? level_of_detail_offsets_[level_of_detail + 1]
+                                : index_count;
+    return { level_of_detail_offsets_[level_of_detail],
+             end - level_of_detail_offsets_[level_of_detail] };
+}
+
+std::uint32_t StaticMesh::SelectLevelOfDetail(float screen_size) const {
+    std::uint32_t level_of_detail = 0;
+    float threshold               = 1.0f;
+    while (level_of_detail + 1 < GetLevelOfDetailCount()) {
+        if (level_of_detail_screen_sizes_.empty()) {
+            threshold *= 0.5f;
+        } else if (level_of_detail < level_of_detail_screen_sizes_.size()) {
+            threshold = level_of_detail_screen_sizes_[level_of_detail];
+        } else {
+            break;
+        }
+        if (screen_size >= threshold) break;
+        ++level_of_detail;
+    }
+    return level_of_detail;
+}
+
 void StaticMesh::Bind(const unsigned int slot /*= 0*/) const {
     if (locked_bind_) return;
     glBindVertexArray(vertex_array_object_);
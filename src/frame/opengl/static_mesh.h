@@ -59,12 +59,23 @@ class StaticMesh : public BindInterface, public StaticMeshInterface {
      * @return Current index buffer id.
      */
     EntityId GetIndexBufferId() const override { return index_buffer_id_; }
+    /**
+     * @brief Get the interleaved vertex buffer id.
+     * @return Current interleaved vertex buffer id (NullId if the attributes are in separate
+     * buffers).
+     */
+    EntityId GetVertexBufferId() const override { return vertex_buffer_id_; }
     /**
      * @brief This is the size in bytes! so if you need the element size just divide this number by
-     * the sizeof(std::int32_t).
+     * the GetIndexElementSize().
      * @return Size of the index buffer in bytes!
      */
     std::size_t GetIndexSize() const override { return index_size_; }
+    /**
+     * @brief Get the size of an index in bytes.
+     * @return Size of an index (2 or 4).
+     */
+    std::uint32_t GetIndexElementSize() const override { return index_element_size_; }
     /**
      * @brief Update the internals to the stream values.
      * @param level: A pointer to the current level.
@@ -85,6 +96,48 @@ class StaticMesh : public BindInterface, public StaticMeshInterface {
     proto::SceneStaticMesh::RenderPrimitiveEnum GetRenderPrimitive() const override {
         return render_primitive_enum_;
     }
+    /**
+     * @brief Get the bounding volume of the mesh (in mesh space).
+     * @return The bounding volume (empty if it was never computed).
+     */
+    const BoundingVolume& GetBoundingVolume() const override { return bounding_volume_; }
+    /**
+     * @brief Set the bounding volume of the mesh.
+     * @param bounding_volume: Volume around the points of the mesh (in mesh space).
+     */
+    void SetBoundingVolume(const BoundingVolume& bounding_volume) override {
+        bounding_volume_ = bounding_volume;
+    }
+    /**
+     * @brief Get the number of levels of detail in the index buffer.
+     * @return Number of levels (1 if the mesh has no level of detail).
+     */
+    std::uint32_t GetLevelOfDetailCount() const override {
+        return level_of_detail_offsets_.empty()
+                   ? 1
+                   : static_cast<std::uint32_t>(level_of_detail_offsets_.size());
+    }
+    /**
+     * @brief Get the part of the index buffer used by a level of detail.
+     * @param level_of_detail: Level (0 is the full resolution).
+     * @return First index and number of indices of the level.
+     */
+    std::pair<std::size_t, std::size_t> GetLevelOfDetailIndexRange(
+        std::uint32_t level_of_detail) const override;
+    /**
+     * @brief Set the projected screen size under which each level of detail (after the full
+     * resolution one) is used.
+     * @param screen_sizes: Decreasing fractions of the screen height.
+     */
+    void SetLevelOfDetailScreenSizes(std::vector<float> screen_sizes) override {
+        level_of_detail_screen_sizes_ = std::move(screen_sizes);
+    }
+    /**
+     * @brief Select the level of detail for a projected screen size.
+     * @param screen_size: Fraction of the screen height covered by the mesh.
+     * @return The coarsest level whose screen size is above the one of the mesh (0 if none).
+     */
+    std::uint32_t SelectLevelOfDetail(float screen_size) const override;
     //! @brief Lock the bind for RAII interface to the bind interface.
     void LockedBind() const override { locked_bind_ = true; }
     //! @brief Unlock the bind for RAII interface to the bind interface.
@@ -120,6 +173,13 @@ class StaticMesh : public BindInterface, public StaticMeshInterface {
     //! @brief From the bind interface this will unbind the current frame buffer from the context.
     void UnBind() const override;
 
+   protected:
+    /**
+     * @brief Set the attributes of the vertex array from an interleaved vertex buffer.
+     * @param parameter: The static mesh parameter (with the vertex attributes).
+     */
+    void CreateInterleavedAttributes(const StaticMeshParameter& parameter);
+
    protected:
     LevelInterface& level_;
     bool clear_depth_buffer_                                           = true;
@@ -132,11 +192,17 @@ class StaticMesh : public BindInterface, public StaticMeshInterface {
     std::uint32_t normal_buffer_size_                                  = 3;
     EntityId texture_buffer_id_                                        = NullId;
     std::uint32_t texture_buffer_size_                                 = 2;
+    EntityId vertex_buffer_id_                                         = NullId;
     EntityId index_buffer_id_                                          = NullId;
     std::size_t index_size_                                            = 0;
+    std::uint32_t index_element_size_                                  = sizeof(std::uint32_t);
     unsigned int vertex_array_object_                                  = 0;
     proto::SceneStaticMesh::RenderPrimitiveEnum render_primitive_enum_ = {};
     float point_size_                                                  = 1.0f;
+    BoundingVolume bounding_volume_                                    = {};
+    // Offset of every level of detail in the index buffer and the screen size to switch to it.
+    std::vector<std::uint32_t> level_of_detail_offsets_ = {};
+    std::vector<float> level_of_detail_screen_sizes_    = {};
     std::string name_;
 };
 
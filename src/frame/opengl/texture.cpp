@@ -1,12 +1,15 @@
 #include "frame/opengl/texture.h"
 
 #include <GL/glew.h>
+#include <fmt/core.h>
 
 #include <algorithm>
 #include <cassert>
 #include <functional>
+#include <optional>
 #include <stdexcept>
 
+#include "frame/file/mipmap.h"
 #include "frame/level.h"
 #include "frame/opengl/file/load_program.h"
 #include "frame/opengl/frame_buffer.h"
@@ -20,27 +23,142 @@ namespace frame::opengl {
 
 Texture::Texture(const TextureParameter& texture_parameter)
     : size_(texture_parameter.size),
+      transient_(texture_parameter.transient),
       pixel_element_size_(texture_parameter.pixel_element_size),
       pixel_structure_(texture_parameter.pixel_structure) {
     assert(texture_parameter.map_type == TextureTypeEnum::TEXTURE_2D);
-    CreateTexture(texture_parameter.data_ptr);
+    CreateTexture(texture_parameter);
 }
 
-void Texture::CreateTexture(const void* data /* = nullptr*/) {
-    glGenTextures(1, &texture_id_);
-    ScopedBind scoped_bind(*this);
-    SetMinFilter(proto::TextureFilter::LINEAR);
+Texture::Texture(const frame::file::CompressedImage& compressed_image)
+    : size_(compressed_image.GetSize()),
+      pixel_element_size_(proto::PixelElementSize_BYTE()),
+      pixel_structure_(frame::file::GetCompressedPixelStructure(compressed_image.GetFormat())) {
+    const bool direct_state_access = IsDirectStateAccessSupported();
+    if (direct_state_access) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture_id_);
+    } else {
+        glGenTextures(1, &texture_id_);
+    }
+    // Bind-to-edit is only needed without direct state access.
+    std::optional<ScopedBind> scoped_bind;
+    if (!direct_state_access) scoped_bind.emplace(*this);
+    const int mip_count = compressed_image.GetMipCount();
+    SetMinFilter(mip_count > 1 ? proto::TextureFilter::LINEAR_MIPMAP_LINEAR
+                               : proto::TextureFilter::LINEAR);
     SetMagFilter(proto::TextureFilter::LINEAR);
     SetWrapS(proto::TextureFilter::CLAMP_TO_EDGE);
     SetWrapT(proto::TextureFilter::CLAMP_TO_EDGE);
-    auto format = opengl::ConvertToGLType(pixel_structure_);
-    auto type   = opengl::ConvertToGLType(pixel_element_size_);
-    glTexImage2D(GL_TEXTURE_2D, 0, opengl::ConvertToGLType(pixel_element_size_, pixel_structure_),
-                 static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y), 0, format, type,
-                 data);
+    const GLenum internal_format = opengl::ConvertToGLType(compressed_image.GetFormat());
+    // The compressed levels are never resized, they can live in an immutable storage.
+    immutable_ = direct_state_access;
+    if (immutable_) {
+        glTextureStorage2D(texture_id_, mip_count, internal_format,
+                           static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y));
+    }
+    for (int level = 0; level < mip_count; ++level) {
+        const glm::uvec2 level_size = compressed_image.GetLevelSize(level);
+        const auto& data            = compressed_image.GetLevel(level);
+        if (immutable_) {
+            glCompressedTextureSubImage2D(texture_id_, level, 0, 0,
+                                          static_cast<GLsizei>(level_size.x),
+                                          static_cast<GLsizei>(level_size.y), internal_format,
+                                          static_cast<GLsizei>(data.size()), data.data());
+        } else {
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, internal_format,
+                                   static_cast<GLsizei>(level_size.x),
+                                   static_cast<GLsizei>(level_size.y), 0,
+                                   static_cast<GLsizei>(data.size()), data.data());
+        }
+    }
+    // Only the levels present in the file, the chain may stop before 1x1.
+    SetParameter(GL_TEXTURE_MAX_LEVEL, mip_count - 1);
 }
 
-Texture::~Texture() { glDeleteTextures(1, &texture_id_); }
+void Texture::CreateTexture(const TextureParameter& texture_parameter) {
+    const bool direct_state_access = IsDirectStateAccessSupported();
+    if (direct_state_access) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture_id_);
+    } else {
+        glGenTextures(1, &texture_id_);
+    }
+    // Bind-to-edit is only needed without direct state access.
+    std::optional<ScopedBind> scoped_bind;
+    if (!direct_state_access) scoped_bind.emplace(*this);
+    // Levels given by the CPU or the full chain generated on the GPU.
+    GLsizei mip_count = 1;
+    if (texture_parameter.mipmap) {
+        mip_count = texture_parameter.mip_data_ptrs.empty()
+                        ? static_cast<GLsizei>(frame::file::GetMipmapCount(size_))
+                        : static_cast<GLsizei>(texture_parameter.mip_data_ptrs.size() + 1);
+    }
+    SetMinFilter(mip_count > 1 ? proto::TextureFilter::LINEAR_MIPMAP_LINEAR
+                               : proto::TextureFilter::LINEAR);
+    SetMagFilter(proto::TextureFilter::LINEAR);
+    SetWrapS(proto::TextureFilter::CLAMP_TO_EDGE);
+    SetWrapT(proto::TextureFilter::CLAMP_TO_EDGE);
+    const auto internal_format = opengl::ConvertToGLType(pixel_element_size_, pixel_structure_);
+    const auto format          = opengl::ConvertToGLType(pixel_structure_);
+    const auto type            = opengl::ConvertToGLType(pixel_element_size_);
+    immutable_ = texture_parameter.immutable && (GLEW_VERSION_4_2 || GLEW_ARB_texture_storage);
+    // There is no direct state access version of glTexImage2D, mutable textures are bound.
+    const bool bind_to_edit = !direct_state_access || !immutable_;
+    if (bind_to_edit) Bind();
+    if (immutable_) {
+        if (direct_state_access) {
+            glTextureStorage2D(texture_id_, mip_count, internal_format,
+                               static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y));
+        } else {
+            glTexStorage2D(GL_TEXTURE_2D, mip_count, internal_format,
+                           static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y));
+        }
+    }
+    // The small levels have rows that are not aligned on 4 bytes.
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (GLsizei level = 0; level < mip_count; ++level) {
+        const void* data = nullptr;
+        if (level == 0) {
+            data = texture_parameter.data_ptr;
+        } else if (!texture_parameter.mip_data_ptrs.empty()) {
+            data = texture_parameter.mip_data_ptrs[level - 1];
+        }
+        const auto width  = static_cast<GLsizei>(std::max(size_.x >> level, 1u));
+        const auto height = static_cast<GLsizei>(std::max(size_.y >> level, 1u));
+        if (!immutable_) {
+            glTexImage2D(GL_TEXTURE_2D, level, internal_format, width, height, 0, format, type,
+                         data);
+        } else if (data && direct_state_access) {
+            glTextureSubImage2D(texture_id_, level, 0, 0, width, height, format, type, data);
+        } else if (data) {
+            glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format, type, data);
+        }
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (bind_to_edit) UnBind();
+    if (mip_count > 1) {
+        SetParameter(GL_TEXTURE_MAX_LEVEL, mip_count - 1);
+        if (texture_parameter.data_ptr && texture_parameter.mip_data_ptrs.empty()) {
+            EnableMipmap();
+        }
+    }
+    SetMaxAnisotropy(texture_parameter.max_anisotropy);
+}
+
+Texture::~Texture() {
+    if (owned_) glDeleteTextures(1, &texture_id_);
+}
+
+void Texture::SetAlias(unsigned int texture_id) {
+    if (owned_) {
+        glDeleteTextures(1, &texture_id_);
+        owned_ = false;
+    }
+    if (texture_id_ == texture_id) return;
+    texture_id_ = texture_id;
+    // The buffers used by Clear are attached to the previous memory.
+    frame_.reset();
+    render_.reset();
+}
 
 void Texture::Bind(const unsigned int slot /*= 0*/) const {
     if (locked_bind_) return;
@@ -54,62 +172,92 @@ void Texture::UnBind() const {
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
-void Texture::EnableMipmap() const { glGenerateMipmap(GL_TEXTURE_2D); }
+void Texture::EnableMipmap() const {
+    if (IsDirectStateAccessSupported()) {
+        glGenerateTextureMipmap(texture_id_);
+        return;
+    }
+    glGenerateMipmap(GL_TEXTURE_2D);
+}
 
 void Texture::SetMinFilter(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_MIN_FILTER, ConvertToGLType(texture_filter));
 }
 
 proto::TextureFilter::Enum Texture::GetMinFilter() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_MIN_FILTER));
 }
 
 void Texture::SetMagFilter(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_MAG_FILTER, ConvertToGLType(texture_filter));
 }
 
 proto::TextureFilter::Enum Texture::GetMagFilter() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_MAG_FILTER));
 }
 
 void Texture::SetWrapS(const proto::TextureFilter::Enum texture_filter) {
+    SetParameter(GL_TEXTURE_WRAP_S, ConvertToGLType(texture_filter));
+}
+
+proto::TextureFilter::Enum Texture::GetWrapS() const {
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_WRAP_S));
+}
+
+void Texture::SetWrapT(const proto::TextureFilter::Enum texture_filter) {
+    SetParameter(GL_TEXTURE_WRAP_T, ConvertToGLType(texture_filter));
+}
+
+proto::TextureFilter::Enum Texture::GetWrapT() const {
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_WRAP_T));
+}
+
+void Texture::SetMaxAnisotropy(const float max_anisotropy) {
+    const float max_supported = GetMaxSupportedAnisotropy();
+    if (max_supported <= 1.0f) return;
+    const float value = std::clamp(max_anisotropy, 1.0f, max_supported);
+    if (IsDirectStateAccessSupported()) {
+        glTextureParameterf(texture_id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, value);
+        return;
+    }
     Bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, ConvertToGLType(texture_filter));
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, value);
     UnBind();
 }
 
-proto::TextureFilter::Enum Texture::GetWrapS() const {
-    GLint filter;
+float Texture::GetMaxAnisotropy() const {
+    if (GetMaxSupportedAnisotropy() <= 1.0f) return 1.0f;
+    GLfloat max_anisotropy = 1.0f;
+    if (IsDirectStateAccessSupported()) {
+        glGetTextureParameterfv(texture_id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, &max_anisotropy);
+        return max_anisotropy;
+    }
     Bind();
-    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &filter);
+    glGetTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, &max_anisotropy);
     UnBind();
-    return ConvertFromGLType(filter);
+    return max_anisotropy;
 }
 
-void Texture::SetWrapT(const proto::TextureFilter::Enum texture_filter) {
+void Texture::SetParameter(unsigned int parameter_name, int value) const {
+    if (IsDirectStateAccessSupported()) {
+        glTextureParameteri(texture_id_, parameter_name, value);
+        return;
+    }
     Bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, ConvertToGLType(texture_filter));
+    glTexParameteri(GL_TEXTURE_2D, parameter_name, value);
     UnBind();
 }
 
-proto::TextureFilter::Enum Texture::GetWrapT() const {
-    GLint filter;
+int Texture::GetParameter(unsigned int parameter_name) const {
+    GLint value = 0;
+    if (IsDirectStateAccessSupported()) {
+        glGetTextureParameteriv(texture_id_, parameter_name, &value);
+        return value;
+    }
     Bind();
-    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, &filter);
+    glGetTexParameteriv(GL_TEXTURE_2D, parameter_name, &value);
     UnBind();
-    return ConvertFromGLType(filter);
+    return value;
 }
 
 void Texture::CreateFrameAndRenderBuffer() {
@@ -262,14 +410,73 @@ std::vector<float> Texture::GetTextureFloat() const {
 
 void Texture::Update(std::vector<std::uint8_t>&& vector, glm::uvec2 size,
                      std::uint8_t bytes_per_pixel) {
-    ScopedBind scoped_bind(*this);
-    size_ = size;
     assert(pixel_element_size_.value() == 1);
-    auto format = opengl::ConvertToGLType(pixel_structure_);
-    auto type   = opengl::ConvertToGLType(pixel_element_size_);
-    glTexImage2D(GL_TEXTURE_2D, 0, opengl::ConvertToGLType(pixel_element_size_, pixel_structure_),
-                 static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y), 0, format, type,
-                 vector.data());
+    std::lock_guard<std::mutex> lock(update_mutex_);
+    // The storage of an immutable texture can't be reallocated.
+    if (immutable_ && size != size_) {
+        throw std::runtime_error(
+            fmt::format("Cannot resize the immutable texture [{}] from {}x{} to {}x{}.", name_,
+                        size_.x, size_.y, size.x, size.y));
+    }
+    // Same size as the stream, copy directly in the mapped buffer.
+    if (update_stream_ && size == size_ && update_stream_->Write(vector.data(), vector.size())) {
+        update_pixels_.clear();
+    } else {
+        update_pixels_ = std::move(vector);
+        update_size_   = size;
+    }
+    update_dirty_ = true;
+}
+
+void Texture::FlushUpdate() {
+    if (!update_dirty_) return;
+    // A writer is copying, the update will land at the next frame.
+    std::unique_lock<std::mutex> lock(update_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) return;
+    update_dirty_ = false;
+    const bool direct_state_access = IsDirectStateAccessSupported();
+    // Bind-to-edit is only needed without direct state access.
+    std::optional<ScopedBind> scoped_bind;
+    if (!direct_state_access) scoped_bind.emplace(*this);
+    auto format    = opengl::ConvertToGLType(pixel_structure_);
+    auto type      = opengl::ConvertToGLType(pixel_element_size_);
+    auto sub_image = [this, direct_state_access, format, type](const void* pixels) {
+        if (direct_state_access) {
+            glTextureSubImage2D(texture_id_, 0, 0, 0, static_cast<GLsizei>(size_.x),
+                                static_cast<GLsizei>(size_.y), format, type, pixels);
+        } else {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size_.x),
+                            static_cast<GLsizei>(size_.y), format, type, pixels);
+        }
+    };
+    if (!update_pixels_.empty()) {
+        // The size changed reallocate the texture and the stream (immutable textures are never
+        // resized, see Update).
+        if (update_size_ != size_ && !immutable_) {
+            size_          = update_size_;
+            update_stream_ = nullptr;
+            // There is no direct state access version of glTexImage2D.
+            Bind();
+            glTexImage2D(GL_TEXTURE_2D, 0,
+                         opengl::ConvertToGLType(pixel_element_size_, pixel_structure_),
+                         static_cast<GLsizei>(size_.x), static_cast<GLsizei>(size_.y), 0, format,
+                         type, nullptr);
+            UnBind();
+        }
+        if (!update_stream_ && TextureStream::IsSupported()) {
+            update_stream_ = std::make_unique<TextureStream>(update_pixels_.size());
+        }
+        // No stream (or no free slot) upload from the memory.
+        if (!update_stream_ ||
+            !update_stream_->Write(update_pixels_.data(), update_pixels_.size())) {
+            sub_image(update_pixels_.data());
+            update_pixels_.clear();
+            return;
+        }
+        update_pixels_.clear();
+    }
+    if (!update_stream_) return;
+    update_stream_->Upload(sub_image);
 }
 
 }  // End namespace frame::opengl.
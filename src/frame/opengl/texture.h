@@ -1,15 +1,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "frame/file/compressed_image.h"
 #include "frame/json/parse_pixel.h"
 #include "frame/json/proto.h"
 #include "frame/opengl/frame_buffer.h"
@@ -17,6 +20,7 @@
 #include "frame/opengl/program.h"
 #include "frame/opengl/render_buffer.h"
 #include "frame/opengl/scoped_bind.h"
+#include "frame/opengl/texture_stream.h"
 #include "frame/texture_interface.h"
 
 namespace frame::opengl {
@@ -32,6 +36,12 @@ class Texture : public TextureInterface, public BindInterface {
      * @param Parameter for creating the texture.
      */
     Texture(const TextureParameter& texture_parameter);
+    /**
+     * @brief Constructor upload a block compressed image (and its mip chain) as is, the format
+     * has to be supported by the context (see IsCompressedFormatSupported).
+     * @param compressed_image: Compressed image loaded from a DDS or KTX file.
+     */
+    explicit Texture(const frame::file::CompressedImage& compressed_image);
     //! @brief Destructor this will free memory on the GPU also!
     virtual ~Texture();
 
@@ -125,11 +135,36 @@ class Texture : public TextureInterface, public BindInterface {
      */
     proto::TextureFilter::Enum GetWrapT() const override;
     /**
-     * @brief Copy the texture input to the texture.
+     * @brief Set the maximum anisotropy used when sampling at a grazing angle (ignored if the
+     * driver doesn't support anisotropic filtering).
+     * @param max_anisotropy: From 1 (isotropic) to the maximum supported (usually 16).
+     */
+    void SetMaxAnisotropy(float max_anisotropy) override;
+    /**
+     * @brief Get the maximum anisotropy.
+     * @return The maximum anisotropy (1 if not supported).
+     */
+    float GetMaxAnisotropy() const override;
+    /**
+     * @brief Copy the texture input to the texture, this can be called from any thread and never
+     * call GL: the pixels are copied in a mapped pixel buffer and land in the texture at the next
+     * FlushUpdate (the previous image is used until then). Throw std::runtime_error if the size
+     * of an immutable texture changes.
      * @param vector: Vector of uint32_t containing the RGBA values of the texture.
      */
     void Update(std::vector<std::uint8_t>&& vector, glm::uvec2 size,
                 std::uint8_t bytes_per_pixel) override;
+    /**
+     * @brief Transfer the latest update (see Update) to the texture, should be called from the GL
+     * thread (the renderer call it at the start of every frame), never wait on a writer.
+     */
+    void FlushUpdate();
+    /**
+     * @brief Make the texture use the memory of another one (used by the frame graph to share the
+     * memory of transient textures), the storage of the texture is released the first time.
+     * @param texture_id: OpenGL id of a texture with the same size, format and filters.
+     */
+    void SetAlias(unsigned int texture_id);
 
    public:
     /**
@@ -142,6 +177,11 @@ class Texture : public TextureInterface, public BindInterface {
      * @return Id of the OpenGL texture.
      */
     unsigned int GetId() const override { return texture_id_; }
+    /**
+     * @brief Check if the texture is only valid inside a frame (see TextureParameter).
+     * @return True if the texture memory can be shared by the frame graph.
+     */
+    bool IsTransient() const { return transient_; }
     /**
      * @brief Get the size of the current texture.
      * @return The size of the texture.
@@ -183,10 +223,10 @@ class Texture : public TextureInterface, public BindInterface {
             const proto::PixelStructure pixel_structure      = proto::PixelStructure_RGB())
         : pixel_element_size_(pixel_element_size), pixel_structure_(pixel_structure) {}
     /**
-     * @brief Fill a texture with a data pointer, the size has to be set first!
-     * @param data: pixel used to fill up (or null for don't care).
+     * @brief Allocate (and fill) the texture and its mip chain, the size has to be set first!
+     * @param texture_parameter: Pixels (or null for don't care) and storage options.
      */
-    void CreateTexture(const void* data = nullptr);
+    void CreateTexture(const TextureParameter& texture_parameter);
     //! @brief Lock the bind for RAII interface to the bind interface.
     void LockedBind() const override { locked_bind_ = true; }
     //! @brief Unlock the bind for RAII interface to the bind interface.
@@ -195,17 +235,40 @@ class Texture : public TextureInterface, public BindInterface {
    protected:
     //! Create a render and a frame buffer for internal rendering (used in Clear).
     void CreateFrameAndRenderBuffer();
+    /**
+     * @brief Set a parameter of the texture (without binding it with direct state access).
+     * @param parameter_name: OpenGL name of the parameter (GL_TEXTURE_MIN_FILTER, ...).
+     * @param value: Value of the parameter.
+     */
+    void SetParameter(unsigned int parameter_name, int value) const;
+    /**
+     * @brief Get a parameter of the texture (without binding it with direct state access).
+     * @param parameter_name: OpenGL name of the parameter (GL_TEXTURE_MIN_FILTER, ...).
+     * @return Value of the parameter.
+     */
+    int GetParameter(unsigned int parameter_name) const;
     friend class ScopedBind;
 
    private:
     unsigned int texture_id_ = 0;
     glm::uvec2 size_         = glm::uvec2(0, 0);
+    bool transient_          = false;
+    // Allocated with glTexStorage2D (cannot be resized).
+    bool immutable_ = false;
+    // False once the texture is an alias (the memory belong to the frame graph).
+    bool owned_ = true;
     const proto::PixelElementSize pixel_element_size_;
     const proto::PixelStructure pixel_structure_;
     mutable bool locked_bind_             = false;
     std::unique_ptr<RenderBuffer> render_ = nullptr;
     std::unique_ptr<FrameBuffer> frame_   = nullptr;
     std::string name_;
+    // Streaming of the updates, the lock protect the stream and the pending update.
+    std::mutex update_mutex_;
+    std::atomic<bool> update_dirty_               = false;
+    std::vector<std::uint8_t> update_pixels_      = {};
+    glm::uvec2 update_size_                       = glm::uvec2(0, 0);
+    std::unique_ptr<TextureStream> update_stream_ = nullptr;
 };
 
 }  // End namespace frame::opengl.
@@ -0,0 +1,129 @@
+#include "frame/opengl/texture_cache.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include "frame/file/cache_file.h"
+
+namespace frame::opengl {
+
+namespace {
+
+// Layout of the file: CacheFileHeader | TextureHeader | data.
+constexpr std::array<char, 4> file_magic = { 'F', 'R', 'M', 'T' };
+constexpr std::uint32_t file_version     = 2;
+
+struct TextureHeader {
+    std::uint32_t pixel_element_size;
+    std::uint32_t pixel_structure;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t face_count;
+    std::uint32_t mip_count;
+    std::uint64_t data_size;
+};
+static_assert(sizeof(TextureHeader) == 32, "TextureHeader is written as is.");
+
+// Size of an element in the client format (the half are uploaded and read back as float).
+std::size_t GetElementSize(proto::PixelElementSize::Enum pixel_element_size) {
+    switch (pixel_element_size) {
+        case proto::PixelElementSize::BYTE:
+            return 1;
+        case proto::PixelElementSize::SHORT:
+            return 2;
+        case proto::PixelElementSize::HALF:
+            [[fallthrough]];
+        case proto::PixelElementSize::FLOAT:
+            return 4;
+        default:
+            throw std::runtime_error(fmt::format("Invalid pixel element size [{}].",
+                                                 static_cast<int>(pixel_element_size)));
+    }
+}
+
+// Number of components of a pixel.
+std::size_t GetComponentCount(proto::PixelStructure::Enum pixel_structure) {
+    switch (pixel_structure) {
+        case proto::PixelStructure::GREY:
+            return 1;
+        case proto::PixelStructure::GREY_ALPHA:
+            return 2;
+        case proto::PixelStructure::RGB:
+            [[fallthrough]];
+        case proto::PixelStructure::BGR:
+            return 3;
+        case proto::PixelStructure::RGB_ALPHA:
+            [[fallthrough]];
+        case proto::PixelStructure::BGR_ALPHA:
+            return 4;
+        default:
+            throw std::runtime_error(fmt::format("Invalid pixel structure [{}].",
+                                                 static_cast<int>(pixel_structure)));
+    }
+}
+
+}  // End namespace.
+
+std::size_t GetTextureCacheFaceSize(const TextureCacheData& texture_cache_data,
+                                    std::uint32_t mip_level) {
+    const std::size_t width  = std::max(texture_cache_data.size.x >> mip_level, 1u);
+    const std::size_t height = std::max(texture_cache_data.size.y >> mip_level, 1u);
+    return width * height * GetComponentCount(texture_cache_data.pixel_structure) *
+           GetElementSize(texture_cache_data.pixel_element_size);
+}
+
+bool ReadTextureCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                          TextureCacheData& texture_cache_data) {
+    std::ifstream ifs;
+    if (!frame::file::OpenCacheFile(file_name, { file_magic, file_version, hash }, ifs)) {
+        return false;
+    }
+    TextureHeader header = {};
+    ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!ifs || !proto::PixelElementSize::Enum_IsValid(header.pixel_element_size) ||
+        !proto::PixelStructure::Enum_IsValid(header.pixel_structure)) {
+        return false;
+    }
+    texture_cache_data.pixel_element_size =
+        static_cast<proto::PixelElementSize::Enum>(header.pixel_element_size);
+    texture_cache_data.pixel_structure =
+        static_cast<proto::PixelStructure::Enum>(header.pixel_structure);
+    texture_cache_data.size       = { header.width, header.height };
+    texture_cache_data.face_count = header.face_count;
+    texture_cache_data.mip_count  = header.mip_count;
+    // The content should match the format (a truncated or corrupted file is never used).
+    std::size_t data_size = 0;
+    try {
+        for (std::uint32_t i = 0; i < texture_cache_data.mip_count; ++i) {
+            data_size += GetTextureCacheFaceSize(texture_cache_data, i) * header.face_count;
+        }
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+    if (header.data_size != data_size) return false;
+    texture_cache_data.data.resize(static_cast<std::size_t>(header.data_size));
+    ifs.read(reinterpret_cast<char*>(texture_cache_data.data.data()),
+             static_cast<std::streamsize>(texture_cache_data.data.size()));
+    return static_cast<bool>(ifs);
+}
+
+void WriteTextureCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                           const TextureCacheData& texture_cache_data) {
+    TextureHeader header      = {};
+    header.pixel_element_size = static_cast<std::uint32_t>(texture_cache_data.pixel_element_size);
+    header.pixel_structure    = static_cast<std::uint32_t>(texture_cache_data.pixel_structure);
+    header.width              = texture_cache_data.size.x;
+    header.height             = texture_cache_data.size.y;
+    header.face_count         = texture_cache_data.face_count;
+    header.mip_count          = texture_cache_data.mip_count;
+    header.data_size          = texture_cache_data.data.size();
+    frame::file::WriteCacheFile(
+        file_name, { file_magic, file_version, hash },
+        { { &header, sizeof(header) },
+          { texture_cache_data.data.data(), texture_cache_data.data.size() } });
+}
+
+}  // End namespace frame::opengl.
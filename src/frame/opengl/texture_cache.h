@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/proto/pixel.pb.h"
+
+namespace frame::opengl {
+
+/**
+ * @class TextureCacheData
+ * @brief Content of a precomputed texture (cube map conversion, irradiance, prefilter, ...), the
+ * mip levels are stored one after the other (each with all its faces) in the client format of the
+ * texture (see ConvertToGLType).
+ */
+struct TextureCacheData {
+    //! @brief Size of one element of a pixel.
+    proto::PixelElementSize::Enum pixel_element_size = proto::PixelElementSize::BYTE;
+    //! @brief Structure of a pixel.
+    proto::PixelStructure::Enum pixel_structure = proto::PixelStructure::RGB;
+    //! @brief Size of a face.
+    glm::uvec2 size = { 0, 0 };
+    //! @brief Number of faces (6 for a cube map).
+    std::uint32_t face_count = 1;
+    //! @brief Number of mip levels.
+    std::uint32_t mip_count = 1;
+    //! @brief Content of the faces.
+    std::vector<std::uint8_t> data = {};
+};
+
+/**
+ * @brief Get the size of one face of a mip level in the client format (half are stored as float).
+ * @param texture_cache_data: Format and size of the texture (the data is not used).
+ * @param mip_level: Mip level (0 is the full size).
+ * @return Size in bytes of one face of the mip level.
+ */
+std::size_t GetTextureCacheFaceSize(const TextureCacheData& texture_cache_data,
+                                    std::uint32_t mip_level);
+/**
+ * @brief Read a cached texture.
+ * @param file_name: Cached texture file.
+ * @param hash: Expected hash of the sources of the texture (see file::HashStrings).
+ * @param texture_cache_data: Texture read from the file.
+ * @return False if the file is missing, invalid or was made from other sources.
+ */
+bool ReadTextureCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                          TextureCacheData& texture_cache_data);
+/**
+ * @brief Write a texture in the cache (throw std::runtime_error if it fails).
+ * @param file_name: Cached texture file.
+ * @param hash: Hash of the texture.
+ * @param texture_cache_data: Content of the texture.
+ */
+void WriteTextureCacheFile(const std::filesystem::path& file_name, std::uint64_t hash,
+                           const TextureCacheData& texture_cache_data);
+
+}  // End namespace frame::opengl.
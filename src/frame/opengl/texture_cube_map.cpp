@@ -66,89 +66,97 @@ void TextureCubeMap::UnBind() const {
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 }
 
-void TextureCubeMap::EnableMipmap() const { glGenerateMipmap(GL_TEXTURE_CUBE_MAP); }
+void TextureCubeMap::EnableMipmap() const {
+    if (IsDirectStateAccessSupported()) {
+        glGenerateTextureMipmap(texture_id_);
+        return;
+    }
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+}
 
 void TextureCubeMap::SetMinFilter(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_MIN_FILTER, ConvertToGLType(texture_filter));
 }
 
 frame::proto::TextureFilter::Enum TextureCubeMap::GetMinFilter() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_MIN_FILTER));
 }
 
 void TextureCubeMap::SetMagFilter(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_MAG_FILTER, ConvertToGLType(texture_filter));
 }
 
 frame::proto::TextureFilter::Enum TextureCubeMap::GetMagFilter() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_MAG_FILTER));
 }
 
 void TextureCubeMap::SetWrapS(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_WRAP_S, ConvertToGLType(texture_filter));
 }
 
 frame::proto::TextureFilter::Enum TextureCubeMap::GetWrapS() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_WRAP_S));
 }
 
 void TextureCubeMap::SetWrapT(const proto::TextureFilter::Enum texture_filter) {
-    Bind();
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, ConvertToGLType(texture_filter));
-    UnBind();
+    SetParameter(GL_TEXTURE_WRAP_T, ConvertToGLType(texture_filter));
 }
 
 frame::proto::TextureFilter::Enum TextureCubeMap::GetWrapT() const {
-    GLint filter;
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_WRAP_T));
+}
+
+void TextureCubeMap::SetMaxAnisotropy(const float max_anisotropy) {
+    const float max_supported = GetMaxSupportedAnisotropy();
+    if (max_supported <= 1.0f) return;
+    const float value = std::clamp(max_anisotropy, 1.0f, max_supported);
+    if (IsDirectStateAccessSupported()) {
+        glTextureParameterf(texture_id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, value);
+        return;
+    }
     Bind();
-    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, &filter);
+    glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, value);
     UnBind();
-    return ConvertFromGLType(filter);
 }
 
-void TextureCubeMap::SetWrapR(const proto::TextureFilter::Enum texture_filter) {
+float TextureCubeMap::GetMaxAnisotropy() const {
+    if (GetMaxSupportedAnisotropy() <= 1.0f) return 1.0f;
+    GLfloat max_anisotropy = 1.0f;
+    if (IsDirectStateAccessSupported()) {
+        glGetTextureParameterfv(texture_id_, GL_TEXTURE_MAX_ANISOTROPY_EXT, &max_anisotropy);
+        return max_anisotropy;
+    }
     Bind();
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, ConvertToGLType(texture_filter));
+    glGetTexParameterfv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, &max_anisotropy);
     UnBind();
+    return max_anisotropy;
+}
+
+void TextureCubeMap::SetWrapR(const proto::TextureFilter::Enum texture_filter) {
+    SetParameter(GL_TEXTURE_WRAP_R, ConvertToGLType(texture_filter));
 }
 
 proto::TextureFilter::Enum TextureCubeMap::GetWrapR() const {
-    GLint filter;
-    Bind();
-    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, &filter);
-    UnBind();
-    return ConvertFromGLType(filter);
+    return ConvertFromGLType(GetParameter(GL_TEXTURE_WRAP_R));
 }
 
 void TextureCubeMap::CreateTextureCubeMap(
 		const std::array<void*, 6> cube_map/* =
 			{ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr }*/)
 	{
-    glGenTextures(1, &texture_id_);
-    ScopedBind scoped_bind(*this);
+    if (IsDirectStateAccessSupported()) {
+        glCreateTextures(GL_TEXTURE_CUBE_MAP, 1, &texture_id_);
+    } else {
+        glGenTextures(1, &texture_id_);
+    }
     SetMinFilter(proto::TextureFilter::LINEAR);
     SetMagFilter(proto::TextureFilter::LINEAR);
     SetWrapS(proto::TextureFilter::CLAMP_TO_EDGE);
     SetWrapT(proto::TextureFilter::CLAMP_TO_EDGE);
     SetWrapR(proto::TextureFilter::CLAMP_TO_EDGE);
+    // The faces stay mutable (the mip chain is allocated later by glGenerateMipmap) and there is
+    // no direct state access version of glTexImage2D.
+    ScopedBind scoped_bind(*this);
     for (unsigned int i : { 0, 1, 2, 3, 4, 5 }) {
         glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0,
                      opengl::ConvertToGLType(pixel_element_size_, pixel_structure_),
@@ -208,6 +216,28 @@ frame::proto::TextureFilter::Enum TextureCubeMap::ConvertFromGLType(int gl_filte
     throw std::runtime_error("invalid texture filter : " + std::to_string(gl_filter));
 }
 
+void TextureCubeMap::SetParameter(unsigned int parameter_name, int value) const {
+    if (IsDirectStateAccessSupported()) {
+        glTextureParameteri(texture_id_, parameter_name, value);
+        return;
+    }
+    Bind();
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, parameter_name, value);
+    UnBind();
+}
+
+int TextureCubeMap::GetParameter(unsigned int parameter_name) const {
+    GLint value = 0;
+    if (IsDirectStateAccessSupported()) {
+        glGetTextureParameteriv(texture_id_, parameter_name, &value);
+        return value;
+    }
+    Bind();
+    glGetTexParameteriv(GL_TEXTURE_CUBE_MAP, parameter_name, &value);
+    UnBind();
+    return value;
+}
+
 void TextureCubeMap::CreateFrameAndRenderBuffer() {
     frame_  = std::make_unique<FrameBuffer>();
     render_ = std::make_unique<RenderBuffer>();
@@ -135,6 +135,17 @@ class TextureCubeMap : public TextureInterface, public BindInterface {
      * @return The way the texture is wrap could be any of (REPEAT, CLAMP_TO_EDGE, MIRRORED_REPEAT).
      */
     proto::TextureFilter::Enum GetWrapT() const override;
+    /**
+     * @brief Set the maximum anisotropy used when sampling at a grazing angle (ignored if the
+     * driver doesn't support anisotropic filtering).
+     * @param max_anisotropy: From 1 (isotropic) to the maximum supported (usually 16).
+     */
+    void SetMaxAnisotropy(float max_anisotropy) override;
+    /**
+     * @brief Get the maximum anisotropy.
+     * @return The maximum anisotropy (1 if not supported).
+     */
+    float GetMaxAnisotropy() const override;
     /**
      * @brief Set the wrapping on the t size of the texture (vertical) this will decide how the
      * texture is treated in case you overflow in this direction.
@@ -220,6 +231,18 @@ class TextureCubeMap : public TextureInterface, public BindInterface {
    protected:
     //! Create a render and a frame buffer for internal rendering (used in Clear).
     void CreateFrameAndRenderBuffer();
+    /**
+     * @brief Set a parameter of the texture (without binding it with direct state access).
+     * @param parameter_name: OpenGL name of the parameter (GL_TEXTURE_MIN_FILTER, ...).
+     * @param value: Value of the parameter.
+     */
+    void SetParameter(unsigned int parameter_name, int value) const;
+    /**
+     * @brief Get a parameter of the texture (without binding it with direct state access).
+     * @param parameter_name: OpenGL name of the parameter (GL_TEXTURE_MIN_FILTER, ...).
+     * @return Value of the parameter.
+     */
+    int GetParameter(unsigned int parameter_name) const;
     friend class ScopedBind;
 
    private:
@@ -0,0 +1,101 @@
+#include "frame/opengl/texture_readback.h"
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "frame/opengl/pixel.h"
+
+namespace frame::opengl {
+
+TextureReadback::~TextureReadback() {
+    for (auto& pending_readback : pending_readbacks_) {
+        glDeleteSync(static_cast<GLsync>(pending_readback.fence));
+        glDeleteBuffers(1, &pending_readback.buffer.id);
+    }
+    for (auto& buffer : free_buffers_) glDeleteBuffers(1, &buffer.id);
+}
+
+std::future<std::vector<std::uint8_t>> TextureReadback::Request(const Texture& texture) {
+    proto::PixelStructure pixel_structure{};
+    pixel_structure.set_value(texture.GetPixelStructure());
+    const auto texture_size = texture.GetSize();
+    const std::size_t size  = static_cast<std::size_t>(texture_size.x) *
+                             static_cast<std::size_t>(texture_size.y) *
+                             static_cast<std::size_t>(pixel_structure.value());
+    PendingReadback pending_readback = {};
+    pending_readback.size            = size;
+    // Reuse a buffer big enough or create a new one.
+    auto it = std::find_if(free_buffers_.begin(), free_buffers_.end(),
+                           [size](const PixelPackBuffer& buffer) { return buffer.size >= size; });
+    if (it != free_buffers_.end()) {
+        pending_readback.buffer = *it;
+        free_buffers_.erase(it);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pending_readback.buffer.id);
+    } else {
+        pending_readback.buffer.size = size;
+        glGenBuffers(1, &pending_readback.buffer.id);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pending_readback.buffer.id);
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+    }
+    // With a pack buffer bound the copy is queued and the pointer is an offset in the buffer.
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    texture.Bind();
+    glGetTexImage(GL_TEXTURE_2D, 0, ConvertToGLType(pixel_structure), GL_UNSIGNED_BYTE, nullptr);
+    texture.UnBind();
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    pending_readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    auto future            = pending_readback.promise.get_future();
+    pending_readbacks_.push_back(std::move(pending_readback));
+    return future;
+}
+
+void TextureReadback::Poll() {
+    // The requests are fulfilled in order (the GPU execute them in order).
+    while (!pending_readbacks_.empty() && FulfillFront(0)) {
+    }
+}
+
+void TextureReadback::Finish() {
+    while (!pending_readbacks_.empty()) {
+        // Wait one second at a time.
+        FulfillFront(1'000'000'000);
+    }
+}
+
+bool TextureReadback::FulfillFront(std::uint64_t timeout) {
+    auto& pending_readback = pending_readbacks_.front();
+    const GLenum result    = glClientWaitSync(static_cast<GLsync>(pending_readback.fence),
+                                              GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    if (result == GL_TIMEOUT_EXPIRED) return false;
+    glDeleteSync(static_cast<GLsync>(pending_readback.fence));
+    if (result == GL_WAIT_FAILED) {
+        pending_readback.promise.set_exception(
+            std::make_exception_ptr(std::runtime_error("Readback fence failed.")));
+    } else {
+        std::vector<std::uint8_t> pixels(pending_readback.size);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pending_readback.buffer.id);
+        const void* mapping = glMapBufferRange(
+            GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(pending_readback.size),
+            GL_MAP_READ_BIT);
+        if (mapping) {
+            std::memcpy(pixels.data(), mapping, pending_readback.size);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (mapping) {
+            pending_readback.promise.set_value(std::move(pixels));
+        } else {
+            pending_readback.promise.set_exception(
+                std::make_exception_ptr(std::runtime_error("Could not map readback buffer.")));
+        }
+    }
+    free_buffers_.push_back(pending_readback.buffer);
+    pending_readbacks_.pop_front();
+    return true;
+}
+
+}  // End namespace frame::opengl.
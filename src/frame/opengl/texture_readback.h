@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <vector>
+
+#include "frame/opengl/texture.h"
+
+namespace frame::opengl {
+
+/**
+ * @class TextureReadback
+ * @brief Asynchronous download of textures: the pixels are copied in a pixel pack buffer by the
+ * GPU and a fence tell when they can be mapped without waiting. All the calls should be made from
+ * the GL thread.
+ */
+class TextureReadback {
+   public:
+    //! @brief Default constructor.
+    TextureReadback() = default;
+    //! @brief Destructor free the buffers (the pending requests are broken).
+    ~TextureReadback();
+    TextureReadback(const TextureReadback&)            = delete;
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+   public:
+    /**
+     * @brief Request the pixels of a texture, this return immediately.
+     * @param texture: Texture to be read (the pixels are converted to bytes).
+     * @return A future to the pixels (ready after a Poll once the GPU is done).
+     */
+    std::future<std::vector<std::uint8_t>> Request(const Texture& texture);
+    //! @brief Fulfill the requests the GPU is done with, never wait (call it once per frame).
+    void Poll();
+    //! @brief Wait for the GPU and fulfill all the pending requests.
+    void Finish();
+    /**
+     * @brief Get the number of requests not yet fulfilled.
+     * @return Number of pending requests.
+     */
+    std::size_t GetPendingCount() const { return pending_readbacks_.size(); }
+
+   protected:
+    /**
+     * @brief Try to fulfill the oldest request.
+     * @param timeout: Time to wait for the GPU in nanoseconds (0 to never wait).
+     * @return True if the request was fulfilled.
+     */
+    bool FulfillFront(std::uint64_t timeout);
+
+   private:
+    struct PixelPackBuffer {
+        unsigned int id  = 0;
+        std::size_t size = 0;
+    };
+    struct PendingReadback {
+        PixelPackBuffer buffer = {};
+        std::size_t size       = 0;
+        void* fence            = nullptr;
+        std::promise<std::vector<std::uint8_t>> promise;
+    };
+    std::vector<PixelPackBuffer> free_buffers_     = {};
+    std::deque<PendingReadback> pending_readbacks_ = {};
+};
+
+}  // End namespace frame::opengl.
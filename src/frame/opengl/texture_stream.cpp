@@ -0,0 +1,92 @@
+#include "frame/opengl/texture_stream.h"
+
+#include <GL/glew.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace frame::opengl {
+
+namespace {
+
+constexpr GLbitfield map_flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+}  // End namespace.
+
+TextureStream::TextureStream(std::size_t slot_size, std::size_t slot_count /* = 4*/)
+    : slot_size_(slot_size), slots_(std::max<std::size_t>(slot_count, 1)) {
+    if (!IsSupported()) throw std::runtime_error("Buffer storage is not supported.");
+    const auto total_size = static_cast<GLsizeiptr>(slot_size_ * slots_.size());
+    glGenBuffers(1, &buffer_id_);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id_);
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, total_size, nullptr, map_flags);
+    mapping_ = static_cast<std::uint8_t*>(
+        glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, total_size, map_flags));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (!mapping_) {
+        glDeleteBuffers(1, &buffer_id_);
+        throw std::runtime_error(
+            fmt::format("Could not map a texture stream of {} bytes.", total_size));
+    }
+}
+
+TextureStream::~TextureStream() {
+    for (auto& slot : slots_) {
+        if (slot.fence) glDeleteSync(static_cast<GLsync>(slot.fence));
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id_);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &buffer_id_);
+}
+
+bool TextureStream::IsSupported() { return GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage; }
+
+bool TextureStream::Write(const void* data, std::size_t size) {
+    if (size > slot_size_) return false;
+    // Prefer the slot that was written but not uploaded (it is stale now).
+    auto it = std::find_if(slots_.begin(), slots_.end(), [](const Slot& slot) {
+        return slot.state == SlotStateEnum::WRITTEN;
+    });
+    if (it == slots_.end()) {
+        it = std::find_if(slots_.begin(), slots_.end(),
+                          [](const Slot& slot) { return slot.state == SlotStateEnum::FREE; });
+    }
+    if (it == slots_.end()) return false;
+    std::memcpy(mapping_ + std::distance(slots_.begin(), it) * slot_size_, data, size);
+    it->state = SlotStateEnum::WRITTEN;
+    return true;
+}
+
+bool TextureStream::Upload(const std::function<void(const void* offset)>& upload) {
+    RetireSlots();
+    auto it = std::find_if(slots_.begin(), slots_.end(), [](const Slot& slot) {
+        return slot.state == SlotStateEnum::WRITTEN;
+    });
+    if (it == slots_.end()) return false;
+    const std::size_t offset = std::distance(slots_.begin(), it) * slot_size_;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_id_);
+    upload(reinterpret_cast<const void*>(offset));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    // The slot can be written again once the GPU has read it.
+    it->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    it->state = SlotStateEnum::IN_FLIGHT;
+    return true;
+}
+
+void TextureStream::RetireSlots() {
+    for (auto& slot : slots_) {
+        if (slot.state != SlotStateEnum::IN_FLIGHT) continue;
+        // Never wait, a slot still in use is checked again at the next upload.
+        const GLenum result = glClientWaitSync(static_cast<GLsync>(slot.fence), 0, 0);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+            glDeleteSync(static_cast<GLsync>(slot.fence));
+            slot.fence = nullptr;
+            slot.state = SlotStateEnum::FREE;
+        }
+    }
+}
+
+}  // End namespace frame::opengl.
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace frame::opengl {
+
+/**
+ * @class TextureStream
+ * @brief Ring of pixel unpack buffers persistently mapped in memory, used to upload pixels to a
+ * texture without stalling: the pixels are copied in a slot of the mapping (no GL call) and the
+ * transfer to the texture is done later from the buffer with a fence to know when the slot can be
+ * reused.
+ * @warning Write and Upload should not be called at the same time (the texture lock them).
+ */
+class TextureStream {
+   public:
+    /**
+     * @brief Constructor create and map the buffer (should be called from the GL thread).
+     * @param slot_size: Size in bytes of a slot (the size of an image).
+     * @param slot_count: Number of slots in the ring.
+     */
+    explicit TextureStream(std::size_t slot_size, std::size_t slot_count = 4);
+    //! @brief Destructor unmap and free the buffer and the fences.
+    ~TextureStream();
+    TextureStream(const TextureStream&)            = delete;
+    TextureStream& operator=(const TextureStream&) = delete;
+
+   public:
+    /**
+     * @brief Check if the persistent mapping is supported by the current context.
+     * @return True if buffer storage is available (GL 4.4 or ARB_buffer_storage).
+     */
+    static bool IsSupported();
+    /**
+     * @brief Get the size of a slot.
+     * @return Size in bytes of a slot.
+     */
+    std::size_t GetSlotSize() const { return slot_size_; }
+    /**
+     * @brief Copy pixels in a slot that is not used by the GPU, no GL call so this can be called
+     * from any thread. A slot written but not yet uploaded is overwritten (only the latest image
+     * matter).
+     * @param data: Pixels to be copied.
+     * @param size: Size in bytes of the pixels (should not be bigger than the slot size).
+     * @return False if all the slots are still used by the GPU (nothing was copied).
+     */
+    bool Write(const void* data, std::size_t size);
+    /**
+     * @brief Upload the latest written slot (should be called from the GL thread), the buffer is
+     * bound as the pixel unpack buffer while the upload function is called.
+     * @param upload: Function issuing the texture transfer (glTexSubImage2D) from the offset.
+     * @return True if something was uploaded.
+     */
+    bool Upload(const std::function<void(const void* offset)>& upload);
+
+   protected:
+    //! @brief Release the slots whose transfer is finished (GL thread).
+    void RetireSlots();
+
+   private:
+    enum class SlotStateEnum : std::uint8_t {
+        FREE,
+        WRITTEN,
+        IN_FLIGHT,
+    };
+    struct Slot {
+        SlotStateEnum state = SlotStateEnum::FREE;
+        void* fence         = nullptr;
+    };
+    unsigned int buffer_id_  = 0;
+    std::uint8_t* mapping_   = nullptr;
+    std::size_t slot_size_   = 0;
+    std::vector<Slot> slots_ = {};
+};
+
+}  // End namespace frame::opengl.
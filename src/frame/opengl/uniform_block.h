@@ -0,0 +1,33 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace frame::opengl {
+
+//! @brief Name of the per frame uniform block in the shaders.
+constexpr const char* frame_uniform_block_name = "FrameUniforms";
+//! @brief Binding point of the per frame uniform block.
+constexpr unsigned int frame_uniform_block_binding = 0;
+
+/**
+ * @class FrameUniformBlock
+ * @brief Content of the per frame uniform block (std140 layout), the shaders opt in with:
+ * `layout(std140) uniform FrameUniforms { mat4 projection; mat4 view; mat4 environment_model;
+ * float time_s; };`, it is written once per frame by the renderer instead of being uploaded to
+ * every program for every draw.
+ */
+struct FrameUniformBlock {
+    //! @brief Projection matrix.
+    glm::mat4 projection = glm::mat4(1.0f);
+    //! @brief View matrix.
+    glm::mat4 view = glm::mat4(1.0f);
+    //! @brief Environment model matrix.
+    glm::mat4 environment_model = glm::mat4(1.0f);
+    //! @brief Time in seconds (padded to a vec4 as in std140).
+    float time_s     = 0.0f;
+    float padding[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+static_assert(sizeof(FrameUniformBlock) == 208, "FrameUniformBlock should match std140 layout.");
+
+}  // End namespace frame::opengl.
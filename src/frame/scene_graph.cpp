@@ -0,0 +1,112 @@
+#include "frame/scene_graph.h"
+
+#include <fmt/core.h>
+
+#include <stdexcept>
+
+namespace frame {
+
+void SceneGraph::Build(
+    const std::vector<std::tuple<EntityId, EntityId, const NodeInterface*>>& nodes) {
+    // Children (as index in the nodes vector) of every node and the roots.
+    std::unordered_map<EntityId, std::uint32_t> input_index_map;
+    for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+        input_index_map.insert({ std::get<0>(nodes[i]), i });
+    }
+    std::vector<std::vector<std::uint32_t>> input_children(nodes.size());
+    std::vector<std::uint32_t> queue;
+    queue.reserve(nodes.size());
+    for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+        const EntityId parent_id = std::get<1>(nodes[i]);
+        if (parent_id == NullId) {
+            queue.push_back(i);
+            continue;
+        }
+        auto it = input_index_map.find(parent_id);
+        if (it == input_index_map.end()) {
+            throw std::runtime_error(fmt::format("No parent node with id #{} for node #{}.",
+                                                 parent_id, std::get<0>(nodes[i])));
+        }
+        input_children[it->second].push_back(i);
+    }
+    // Breadth first walk, the queue end up being the new order.
+    std::vector<std::uint32_t> parent_indices(nodes.size(), no_parent_);
+    std::vector<std::uint32_t> first_child_indices(nodes.size(), 0);
+    std::vector<std::uint32_t> child_counts(nodes.size(), 0);
+    for (std::uint32_t i = 0; i < queue.size(); ++i) {
+        const auto& children   = input_children[queue[i]];
+        first_child_indices[i] = static_cast<std::uint32_t>(queue.size());
+        child_counts[i]        = static_cast<std::uint32_t>(children.size());
+        for (const auto child : children) {
+            parent_indices[queue.size()] = i;
+            queue.push_back(child);
+        }
+    }
+    if (queue.size() != nodes.size()) {
+        throw std::runtime_error(
+            fmt::format("Cycle in the scene tree ({} nodes out of {} are reachable).",
+                        queue.size(), nodes.size()));
+    }
+    ids_.clear();
+    nodes_.clear();
+    id_index_map_.clear();
+    for (std::uint32_t i = 0; i < queue.size(); ++i) {
+        const auto& node = nodes[queue[i]];
+        ids_.push_back(std::get<0>(node));
+        nodes_.push_back(std::get<2>(node));
+        id_index_map_.insert({ std::get<0>(node), i });
+    }
+    parent_indices_      = std::move(parent_indices);
+    first_child_indices_ = std::move(first_child_indices);
+    child_counts_        = std::move(child_counts);
+    local_models_.assign(nodes.size(), glm::mat4(1.0f));
+    world_models_.assign(nodes.size(), glm::mat4(1.0f));
+    dirty_flags_.assign(nodes.size(), 1);
+    needs_full_update_ = true;
+}
+
+std::size_t SceneGraph::Update(double dt) {
+    updated_ids_.clear();
+    for (std::uint32_t i = 0; i < nodes_.size(); ++i) {
+        const glm::mat4 local_model = nodes_[i]->GetLocalTransform(dt);
+        const auto parent_index     = parent_indices_[i];
+        // Parents are always before their children so their flag is already set for this pass.
+        bool dirty = needs_full_update_ || local_model != local_models_[i] ||
+                     (parent_index != no_parent_ && dirty_flags_[parent_index]);
+        dirty_flags_[i] = dirty;
+        if (!dirty) continue;
+        local_models_[i] = local_model;
+        world_models_[i] = (parent_index == no_parent_)
+                               ? local_model
+                               : world_models_[parent_index] * local_model;
+        updated_ids_.push_back(ids_[i]);
+    }
+    needs_full_update_ = false;
+    return updated_ids_.size();
+}
+
+const glm::mat4& SceneGraph::GetWorldModel(EntityId id) const {
+    return world_models_[GetIndex(id)];
+}
+
+std::vector<EntityId> SceneGraph::GetChildList(EntityId id) const {
+    const auto index = GetIndex(id);
+    const auto begin = ids_.cbegin() + first_child_indices_[index];
+    return std::vector<EntityId>(begin, begin + child_counts_[index]);
+}
+
+EntityId SceneGraph::GetParentId(EntityId id) const {
+    const auto parent_index = parent_indices_[GetIndex(id)];
+    if (parent_index == no_parent_) return NullId;
+    return ids_[parent_index];
+}
+
+std::uint32_t SceneGraph::GetIndex(EntityId id) const {
+    auto it = id_index_map_.find(id);
+    if (it == id_index_map_.end()) {
+        throw std::runtime_error(fmt::format("No node with id #{} in the scene graph.", id));
+    }
+    return it->second;
+}
+
+}  // End namespace frame.
@@ -0,0 +1,38 @@
+#include "frame/task_pool.h"
+
+#include <algorithm>
+
+namespace frame {
+
+TaskPool::TaskPool(std::size_t thread_count /* = std::thread::hardware_concurrency()*/) {
+    thread_count = std::max<std::size_t>(thread_count, 1);
+    threads_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this]() { Run(); });
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+void TaskPool::Run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+            if (stop_ && tasks_.empty()) return;
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+        task();
+    }
+}
+
+}  // End namespace frame.
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace frame {
+
+/**
+ * @class TaskPool
+ * @brief A fixed set of worker threads executing tasks in submission order, used to run the CPU
+ * side of the loading (file reading and decoding) away from the thread owning the GL context.
+ */
+class TaskPool {
+   public:
+    /**
+     * @brief Constructor start the worker threads.
+     * @param thread_count: Number of worker threads (at least 1).
+     */
+    explicit TaskPool(std::size_t thread_count = std::thread::hardware_concurrency());
+    //! @brief Destructor wait for all the submitted tasks to be finished.
+    ~TaskPool();
+    TaskPool(const TaskPool&)            = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+   public:
+    /**
+     * @brief Submit a task to the workers.
+     * @param function: Task to be executed (any exception is forwarded to the future).
+     * @return A future to the result of the task.
+     */
+    template <typename F>
+    std::future<std::invoke_result_t<F>> Submit(F&& function) {
+        using Result = std::invoke_result_t<F>;
+        auto task    = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+        auto future  = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace([task]() { (*task)(); });
+        }
+        condition_.notify_one();
+        return future;
+    }
+    /**
+     * @brief Get the number of worker threads.
+     * @return Number of worker threads.
+     */
+    std::size_t GetThreadCount() const { return threads_.size(); }
+
+   protected:
+    //! @brief Worker loop, pop and execute tasks until the pool is stopped.
+    void Run();
+
+   private:
+    std::vector<std::thread> threads_        = {};
+    std::queue<std::function<void()>> tasks_ = {};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+};
+
+}  // End namespace frame.
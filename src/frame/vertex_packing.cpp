@@ -0,0 +1,191 @@
+#include "frame/vertex_packing.h"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace frame {
+
+namespace {
+
+// Copy a value at the cursor and move the cursor after it.
+template <typename T>
+void Write(std::uint8_t*& cursor, const T& value) {
+    std::memcpy(cursor, &value, sizeof(T));
+    cursor += sizeof(T);
+}
+
+// Pack a component in [-1, 1] into a signed normalized 10 bit integer.
+std::uint32_t PackSnorm10(float value) {
+    const auto integer =
+        static_cast<std::int32_t>(std::round(std::clamp(value, -1.0f, 1.0f) * 511.0f));
+    return static_cast<std::uint32_t>(integer) & 0x3ff;
+}
+
+// Unpack a signed normalized 10 bit integer into [-1, 1].
+float UnpackSnorm10(std::uint32_t value) {
+    auto integer = static_cast<std::int32_t>(value & 0x3ff);
+    if (integer & 0x200) integer -= 0x400;
+    return std::max(static_cast<float>(integer) / 511.0f, -1.0f);
+}
+
+// Add an attribute at the end of the vertex (the stride is the offset of the next attribute).
+void AddAttribute(InterleavedVertices& interleaved_vertices, std::uint32_t size,
+                  VertexAttributeFormatEnum format, bool normalized, std::uint32_t byte_size) {
+    const auto location =
+        static_cast<std::uint32_t>(interleaved_vertices.vertex_attributes.size());
+    interleaved_vertices.vertex_attributes.push_back(
+        { location, size, format, normalized, interleaved_vertices.vertex_stride });
+    interleaved_vertices.vertex_stride += byte_size;
+}
+
+}  // End namespace.
+
+std::uint16_t PackHalfFloat(float value) {
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const std::uint32_t sign     = (bits >> 16) & 0x8000;
+    const std::uint32_t exponent = (bits >> 23) & 0xff;
+    std::uint32_t mantissa       = bits & 0x7fffff;
+    // Infinity and NaN.
+    if (exponent == 0xff) {
+        return static_cast<std::uint16_t>(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+    }
+    const int half_exponent = static_cast<int>(exponent) - 127 + 15;
+    // Too big, overflow to infinity.
+    if (half_exponent >= 0x1f) return static_cast<std::uint16_t>(sign | 0x7c00);
+    if (half_exponent <= 0) {
+        // Too small even for a denormal.
+        if (half_exponent < -10) return static_cast<std::uint16_t>(sign);
+        // Denormal, add the implicit bit and shift it in place.
+        mantissa |= 0x800000;
+        const int shift               = 14 - half_exponent;
+        std::uint32_t half_mantissa   = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const std::uint32_t halfway   = 1u << (shift - 1);
+        // Round to nearest even.
+        if (remainder > halfway || (remainder == halfway && (half_mantissa & 1))) half_mantissa++;
+        return static_cast<std::uint16_t>(sign | half_mantissa);
+    }
+    std::uint32_t half =
+        sign | (static_cast<std::uint32_t>(half_exponent) << 10) | (mantissa >> 13);
+    // Round to nearest even (a carry in the exponent is still correct).
+    const std::uint32_t remainder = mantissa & 0x1fff;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) half++;
+    return static_cast<std::uint16_t>(half);
+}
+
+float UnpackHalfFloat(std::uint16_t value) {
+    const std::uint32_t sign     = static_cast<std::uint32_t>(value & 0x8000) << 16;
+    const std::uint32_t exponent = (value >> 10) & 0x1f;
+    std::uint32_t mantissa       = value & 0x3ff;
+    std::uint32_t bits           = sign;
+    if (exponent == 0x1f) {
+        bits |= 0x7f800000 | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits |= ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    } else if (mantissa != 0) {
+        // Denormal, normalize it.
+        std::uint32_t shift = 0;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            shift++;
+        }
+        bits |= ((127 - 14 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+    }
+    float result = 0.0f;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+std::uint32_t PackNormal(glm::vec3 normal) {
+    return PackSnorm10(normal.x) | (PackSnorm10(normal.y) << 10) | (PackSnorm10(normal.z) << 20);
+}
+
+glm::vec3 UnpackNormal(std::uint32_t packed) {
+    return glm::vec3(UnpackSnorm10(packed), UnpackSnorm10(packed >> 10),
+                     UnpackSnorm10(packed >> 20));
+}
+
+InterleavedVertices InterleaveVertices(const std::vector<float>& points,
+                                       const std::vector<float>& colors,
+                                       const std::vector<float>& normals,
+                                       const std::vector<float>& texture_coordinates,
+                                       const std::vector<std::uint32_t>& indices,
+                                       const VertexPackingParameter& parameter /* = {}*/) {
+    const std::size_t vertex_count = points.size() / 3;
+    if (points.size() % 3 || (!colors.empty() && colors.size() != points.size()) ||
+        (!normals.empty() && normals.size() != points.size()) ||
+        (!texture_coordinates.empty() && texture_coordinates.size() != vertex_count * 2)) {
+        throw std::runtime_error(
+            fmt::format("Invalid vertex sizes: points {}, colors {}, normals {}, textures {}.",
+                        points.size(), colors.size(), normals.size(), texture_coordinates.size()));
+    }
+    const bool pack_normal     = parameter.pack_normal && !normals.empty();
+    const bool half_texture    = parameter.half_float_texture_coordinate;
+    InterleavedVertices result = {};
+    // Describe the attributes, locations are in the same order as the separate buffers.
+    AddAttribute(result, 3, VertexAttributeFormatEnum::FLOAT, false, 3 * sizeof(float));
+    if (!colors.empty()) {
+        AddAttribute(result, 3, VertexAttributeFormatEnum::FLOAT, false, 3 * sizeof(float));
+    }
+    if (!normals.empty()) {
+        if (pack_normal) {
+            AddAttribute(result, 4, VertexAttributeFormatEnum::INT_2_10_10_10_REV, true,
+                         sizeof(std::uint32_t));
+        } else {
+            AddAttribute(result, 3, VertexAttributeFormatEnum::FLOAT, true, 3 * sizeof(float));
+        }
+    }
+    if (!texture_coordinates.empty()) {
+        if (half_texture) {
+            AddAttribute(result, 2, VertexAttributeFormatEnum::HALF_FLOAT, false,
+                         2 * sizeof(std::uint16_t));
+        } else {
+            AddAttribute(result, 2, VertexAttributeFormatEnum::FLOAT, false, 2 * sizeof(float));
+        }
+    }
+    // Fill the vertices in the same order as the attributes.
+    result.vertices.resize(vertex_count * result.vertex_stride);
+    std::uint8_t* cursor = result.vertices.data();
+    for (std::size_t i = 0; i < vertex_count; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) Write(cursor, points[i * 3 + j]);
+        if (!colors.empty()) {
+            for (std::size_t j = 0; j < 3; ++j) Write(cursor, colors[i * 3 + j]);
+        }
+        if (!normals.empty()) {
+            if (pack_normal) {
+                Write(cursor, PackNormal(glm::vec3(normals[i * 3], normals[i * 3 + 1],
+                                                   normals[i * 3 + 2])));
+            } else {
+                for (std::size_t j = 0; j < 3; ++j) Write(cursor, normals[i * 3 + j]);
+            }
+        }
+        if (!texture_coordinates.empty()) {
+            for (std::size_t j = 0; j < 2; ++j) {
+                if (half_texture) {
+                    Write(cursor, PackHalfFloat(texture_coordinates[i * 2 + j]));
+                } else {
+                    Write(cursor, texture_coordinates[i * 2 + j]);
+                }
+            }
+        }
+    }
+    // 16 bit indices if all the vertices can be addressed.
+    if (parameter.short_index && vertex_count <= 0x10000) {
+        result.index_element_size = sizeof(std::uint16_t);
+        result.indices.resize(indices.size() * sizeof(std::uint16_t));
+        cursor = result.indices.data();
+        for (const auto index : indices) Write(cursor, static_cast<std::uint16_t>(index));
+    } else {
+        result.index_element_size = sizeof(std::uint32_t);
+        result.indices.resize(indices.size() * sizeof(std::uint32_t));
+        std::memcpy(result.indices.data(), indices.data(), result.indices.size());
+    }
+    return result;
+}
+
+}  // End namespace frame.
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/static_mesh_interface.h"
+
+namespace frame {
+
+/**
+ * @class VertexPackingParameter
+ * @brief Describe how the vertices are packed in an interleaved buffer.
+ */
+struct VertexPackingParameter {
+    //! @brief Pack the normals as signed normalized 10:10:10:2 (instead of 3 floats).
+    bool pack_normal = true;
+    //! @brief Store the texture coordinates as half floats (instead of 2 floats).
+    bool half_float_texture_coordinate = true;
+    //! @brief Use 16 bit indices if the vertex count allows it.
+    bool short_index = true;
+};
+
+/**
+ * @class InterleavedVertices
+ * @brief Result of the packing, a vertex buffer, an index buffer and their descriptions.
+ */
+struct InterleavedVertices {
+    //! @brief Interleaved vertex data.
+    std::vector<std::uint8_t> vertices = {};
+    //! @brief Size of a vertex in bytes.
+    std::uint32_t vertex_stride = 0;
+    //! @brief Attributes in the vertex (location are point, color, normal, texture in order).
+    std::vector<VertexAttribute> vertex_attributes = {};
+    //! @brief Index data.
+    std::vector<std::uint8_t> indices = {};
+    //! @brief Size of an index in bytes (2 or 4).
+    std::uint32_t index_element_size = sizeof(std::uint32_t);
+};
+
+/**
+ * @brief Convert a float to a half float (IEEE 754 binary16, round to nearest).
+ * @param value: Float value.
+ * @return Half float bits.
+ */
+std::uint16_t PackHalfFloat(float value);
+/**
+ * @brief Convert a half float to a float.
+ * @param value: Half float bits.
+ * @return Float value.
+ */
+float UnpackHalfFloat(std::uint16_t value);
+/**
+ * @brief Pack a normal into a signed normalized 10:10:10:2 integer (GL_INT_2_10_10_10_REV).
+ * @param normal: Normal to be packed (components are clamped to [-1, 1]).
+ * @return The packed normal (w is 0).
+ */
+std::uint32_t PackNormal(glm::vec3 normal);
+/**
+ * @brief Unpack a normal from a signed normalized 10:10:10:2 integer.
+ * @param packed: The packed normal.
+ * @return The normal.
+ */
+glm::vec3 UnpackNormal(std::uint32_t packed);
+/**
+ * @brief Interleave the vertex attributes in a single buffer.
+ * @param points: Points (3 floats per vertex, mandatory).
+ * @param colors: Colors (3 floats per vertex or empty).
+ * @param normals: Normals (3 floats per vertex or empty).
+ * @param texture_coordinates: Texture coordinates (2 floats per vertex or empty).
+ * @param indices: Indices.
+ * @param parameter: How the vertices should be packed.
+ * @return The interleaved vertices and indices.
+ */
+InterleavedVertices InterleaveVertices(const std::vector<float>& points,
+                                       const std::vector<float>& colors,
+                                       const std::vector<float>& normals,
+                                       const std::vector<float>& texture_coordinates,
+                                       const std::vector<std::uint32_t>& indices,
+                                       const VertexPackingParameter& parameter = {});
+
+}  // End namespace frame.
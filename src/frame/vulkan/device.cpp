@@ -98,6 +98,20 @@ void Device::ScreenShot(const std::string& file) const {
     throw std::runtime_error("Not implemented!");
 }
 
+std::future<void> Device::ScreenShotAsync(const std::string& file) {
+    throw std::runtime_error("Not implemented!");
+}
+
+void Device::StartCapture(const std::string& file_pattern, std::uint32_t every_n_frames) {
+    throw std::runtime_error("Not implemented!");
+}
+
+void Device::StopCapture() { throw std::runtime_error("Not implemented!"); }
+
+std::future<std::vector<std::uint8_t>> Device::ReadTextureAsync(EntityId texture_id) {
+    throw std::runtime_error("Not implemented!");
+}
+
 std::unique_ptr<frame::BufferInterface> Device::CreatePointBuffer(std::vector<float>&& vector) {
     throw std::runtime_error("Not implemented!");
 }
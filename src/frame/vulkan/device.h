@@ -88,6 +88,26 @@ class Device : public DeviceInterface {
      * dropped at the path where the software is run.
      */
     void ScreenShot(const std::string& file) const final;
+    /**
+     * @brief Make a screenshot of the current frame without stalling.
+     * @param file: File name to write the screenshot to (*.png).
+     * @return A future that is ready once the file is written.
+     */
+    std::future<void> ScreenShotAsync(const std::string& file) final;
+    /**
+     * @brief Start to capture every Nth frame to an image sequence.
+     * @param file_pattern: Pattern of the file names, formatted with the frame number.
+     * @param every_n_frames: Capture one frame every N frames.
+     */
+    void StartCapture(const std::string& file_pattern, std::uint32_t every_n_frames = 1) final;
+    //! @brief Stop the capture started with StartCapture.
+    void StopCapture() final;
+    /**
+     * @brief Read the pixels of a texture without stalling.
+     * @param texture_id: Id of the texture to be read.
+     * @return A future to the pixels.
+     */
+    std::future<std::vector<std::uint8_t>> ReadTextureAsync(EntityId texture_id) final;
     /**
      * @brief Create a point buffer from a vector of floats.
      * @param device: A pointer to a device.
@@ -0,0 +1,81 @@
+// Compare the cost of the level storage (slot map) against the std::map it replaced, for random
+// lookups and for iteration, from 10k to 1M entities.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "frame/slot_map.h"
+
+namespace {
+
+// Stand in for a resource (only the pointer is stored in the level).
+struct Resource {
+    std::int64_t value = 0;
+};
+
+// Number of random lookups per run.
+constexpr std::size_t lookup_count = 1'000'000;
+
+// Time a function in milliseconds.
+template <typename Function>
+double TimeMs(Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void RunBenchmark(std::size_t entity_count) {
+    frame::EntityIdAllocator id_allocator;
+    std::map<frame::EntityId, std::unique_ptr<Resource>> id_map;
+    frame::SlotMap<std::unique_ptr<Resource>> slot_map;
+    std::vector<frame::EntityId> ids;
+    ids.reserve(entity_count);
+    for (std::size_t i = 0; i < entity_count; ++i) {
+        const auto id = id_allocator.Allocate();
+        ids.push_back(id);
+        id_map.insert({ id, std::make_unique<Resource>(Resource{ id }) });
+        slot_map.Insert(id, std::make_unique<Resource>(Resource{ id }));
+    }
+    std::vector<frame::EntityId> lookup_ids(lookup_count);
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<std::size_t> distribution(0, entity_count - 1);
+    std::generate(lookup_ids.begin(), lookup_ids.end(),
+                  [&] { return ids[distribution(generator)]; });
+    // The sums are printed so the loops can't be optimized away.
+    std::int64_t map_sum  = 0;
+    std::int64_t slot_sum = 0;
+    // Random lookups.
+    const double map_find = TimeMs([&] {
+        for (const auto id : lookup_ids) map_sum += id_map.at(id)->value;
+    });
+    const double slot_find = TimeMs([&] {
+        for (const auto id : lookup_ids) slot_sum += slot_map.At(id)->value;
+    });
+    // Iteration over all the entities.
+    const double map_iter = TimeMs([&] {
+        for (const auto& [id, resource] : id_map) map_sum += resource->value;
+    });
+    const double slot_iter = TimeMs([&] {
+        for (const auto& resource : slot_map.GetValues()) slot_sum += resource->value;
+    });
+    std::cout << entity_count << " entities:\n"
+              << "  lookup    map " << map_find << " ms, slot map " << slot_find << " ms\n"
+              << "  iteration map " << map_iter << " ms, slot map " << slot_iter << " ms\n"
+              << "  (checksum " << map_sum << " " << slot_sum << ")\n";
+}
+
+}  // namespace
+
+int main() {
+    for (const std::size_t entity_count : { 10'000, 100'000, 1'000'000 }) {
+        RunBenchmark(entity_count);
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "frame/bounding_volume_test.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "frame/vertex_packing.h"
+
+namespace test {
+
+TEST_F(BoundingVolumeTest, ComputeBoundingVolumeTest) {
+    EXPECT_FALSE(frame::BoundingVolume{}.IsValid());
+    EXPECT_FALSE(frame::ComputeBoundingVolume(std::vector<float>{}).IsValid());
+    const std::vector<float> points = { -1, 0, 0, 1, 2, 0, 0, 0, 4 };
+    auto bounding_volume            = frame::ComputeBoundingVolume(points);
+    ASSERT_TRUE(bounding_volume.IsValid());
+    EXPECT_EQ(glm::vec3(-1, 0, 0), bounding_volume.min);
+    EXPECT_EQ(glm::vec3(1, 2, 4), bounding_volume.max);
+    EXPECT_EQ(glm::vec3(0, 1, 2), bounding_volume.center);
+    // Farthest point from the center is (1, 2, 0) or (-1, 0, 0) (sqrt(6)).
+    EXPECT_FLOAT_EQ(std::sqrt(6.0f), bounding_volume.radius);
+    // Same volume from the interleaved buffer.
+    const std::vector<float> normals = { 0, 0, 1, 0, 0, 1, 0, 0, 1 };
+    auto interleaved = frame::InterleaveVertices(points, {}, normals, {}, { 0, 1, 2 });
+    auto interleaved_bounding_volume = frame::ComputeBoundingVolume(
+        interleaved.vertices.data(), interleaved.vertices.size(), interleaved.vertex_stride);
+    EXPECT_EQ(bounding_volume.min, interleaved_bounding_volume.min);
+    EXPECT_EQ(bounding_volume.max, interleaved_bounding_volume.max);
+    EXPECT_FLOAT_EQ(bounding_volume.radius, interleaved_bounding_volume.radius);
+}
+
+TEST_F(BoundingVolumeTest, TransformBoundingVolumeTest) {
+    auto bounding_volume = frame::ComputeBoundingVolume({ -1, -1, -1, 1, 1, 1 });
+    auto moved           = frame::TransformBoundingVolume(
+        bounding_volume, glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(10, 0, 0)),
+                                    glm::vec3(2.0f)));
+    EXPECT_EQ(glm::vec3(8, -2, -2), moved.min);
+    EXPECT_EQ(glm::vec3(12, 2, 2), moved.max);
+    EXPECT_EQ(glm::vec3(10, 0, 0), moved.center);
+    EXPECT_FLOAT_EQ(bounding_volume.radius * 2.0f, moved.radius);
+    // A 45 degrees rotation around z makes the box wider (sqrt(2) for a unit box).
+    auto rotated = frame::TransformBoundingVolume(
+        bounding_volume,
+        glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+    EXPECT_NEAR(std::sqrt(2.0f), rotated.max.x, 1e-5f);
+    EXPECT_NEAR(1.0f, rotated.max.z, 1e-5f);
+    EXPECT_FLOAT_EQ(bounding_volume.radius, rotated.radius);
+    EXPECT_FALSE(frame::TransformBoundingVolume({}, glm::mat4(1.0f)).IsValid());
+}
+
+TEST_F(BoundingVolumeTest, MergeBoundingVolumeTest) {
+    auto left  = frame::ComputeBoundingVolume({ -1, -1, -1, 1, 1, 1 });
+    auto right = frame::ComputeBoundingVolume({ 3, -1, -1, 5, 1, 1 });
+    auto merge = frame::MergeBoundingVolume(left, right);
+    EXPECT_EQ(glm::vec3(-1, -1, -1), merge.min);
+    EXPECT_EQ(glm::vec3(5, 1, 1), merge.max);
+    EXPECT_NEAR(2.0f, merge.center.x, 1e-5f);
+    EXPECT_NEAR(2.0f + left.radius, merge.radius, 1e-5f);
+    // Empty volumes are ignored and inner spheres are kept as is.
+    EXPECT_EQ(left.max, frame::MergeBoundingVolume({}, left).max);
+    auto inner = frame::ComputeBoundingVolume({ 0, 0, 0, 0.1f, 0.1f, 0.1f });
+    EXPECT_EQ(left.radius, frame::MergeBoundingVolume(left, inner).radius);
+}
+
+TEST_F(BoundingVolumeTest, ComputeScreenSizeTest) {
+    // Unit sphere 10 units in front of a 90 degrees camera.
+    const auto bounding_volume = frame::ComputeBoundingVolume({ -1, 0, -10, 1, 0, -10 });
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    glm::mat4 view          = glm::mat4(1.0f);
+    const float screen_size = frame::ComputeScreenSize(bounding_volume, projection, view);
+    EXPECT_NEAR(0.1f, screen_size, 1e-5f);
+    // Twice as far is half the size.
+    view = glm::translate(view, glm::vec3(0.0f, 0.0f, -10.0f));
+    EXPECT_NEAR(screen_size * 0.5f, frame::ComputeScreenSize(bounding_volume, projection, view),
+                1e-5f);
+    EXPECT_FLOAT_EQ(0.0f, frame::ComputeScreenSize({}, projection, view));
+}
+
+}  // End namespace test.
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/bounding_volume.h"
+
+namespace test {
+
+class BoundingVolumeTest : public testing::Test {
+   public:
+    BoundingVolumeTest() = default;
+};
+
+}  // End namespace test.
@@ -0,0 +1,106 @@
+#include "frame/bvh_test.h"
+
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "frame/camera.h"
+
+namespace test {
+
+namespace {
+
+// Unit box around a position.
+frame::BoundingVolume MakeBox(glm::vec3 position) {
+    return frame::ComputeBoundingVolume({ position.x - 0.5f, position.y - 0.5f, position.z - 0.5f,
+                                          position.x + 0.5f, position.y + 0.5f,
+                                          position.z + 0.5f });
+}
+
+// Grid of 10 x 10 x 10 boxes spaced by 3 (ids start at 1).
+std::vector<std::pair<frame::EntityId, frame::BoundingVolume>> MakeGrid() {
+    std::vector<std::pair<frame::EntityId, frame::BoundingVolume>> items;
+    for (int i = 0; i < 1000; ++i) {
+        const glm::vec3 position(i % 10 * 3.0f, i / 10 % 10 * 3.0f, i / 100 * 3.0f);
+        items.push_back({ i + 1, MakeBox(position) });
+    }
+    return items;
+}
+
+std::vector<frame::EntityId> Sorted(std::vector<frame::EntityId> ids) {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+}  // End namespace.
+
+TEST_F(BvhTest, EmptyBvhTest) {
+    bvh_.Build({ { 1, frame::BoundingVolume{} } });
+    EXPECT_EQ(0, bvh_.GetSize());
+    EXPECT_EQ(0, bvh_.GetDepth());
+    EXPECT_FALSE(bvh_.Contains(1));
+    EXPECT_TRUE(bvh_.QueryBox(glm::vec3(-100.0f), glm::vec3(100.0f)).empty());
+    EXPECT_EQ(frame::NullId, bvh_.Raycast(glm::vec3(0.0f), glm::vec3(0, 0, -1)).id);
+}
+
+TEST_F(BvhTest, QueryBvhTest) {
+    const auto items = MakeGrid();
+    bvh_.Build(items);
+    EXPECT_EQ(1000, bvh_.GetSize());
+    // Balanced enough (a perfect tree over 1000 leaves has 11 levels).
+    EXPECT_GE(16, bvh_.GetDepth());
+    // Range query against a brute force over all the items.
+    const glm::vec3 min(2.0f, 2.0f, 2.0f);
+    const glm::vec3 max(7.0f, 4.0f, 10.0f);
+    std::vector<frame::EntityId> expected;
+    for (const auto& [id, bounding_volume] : items) {
+        if (bounding_volume.min.x <= max.x && bounding_volume.max.x >= min.x &&
+            bounding_volume.min.y <= max.y && bounding_volume.max.y >= min.y &&
+            bounding_volume.min.z <= max.z && bounding_volume.max.z >= min.z) {
+            expected.push_back(id);
+        }
+    }
+    EXPECT_EQ(2 * 1 * 3, expected.size());
+    EXPECT_EQ(expected, Sorted(bvh_.QueryBox(min, max)));
+    // Frustum query against the frustum test of each item.
+    frame::Camera camera(glm::vec3(13.5f, 13.5f, 40.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+                         glm::vec3(0.0f, 1.0f, 0.0f), 30.0f, 1.0f, 0.1f, 100.0f);
+    frame::Frustum frustum(camera.ComputeProjection() * camera.ComputeView());
+    expected.clear();
+    for (const auto& [id, bounding_volume] : items) {
+        if (frustum.IsBoxVisible(bounding_volume.min, bounding_volume.max)) expected.push_back(id);
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_GT(items.size(), expected.size());
+    EXPECT_EQ(expected, Sorted(bvh_.QueryFrustum(frustum)));
+}
+
+TEST_F(BvhTest, RaycastBvhTest) {
+    bvh_.Build({ { 1, MakeBox(glm::vec3(0, 0, -10)) },
+                 { 2, MakeBox(glm::vec3(0, 0, -5)) },
+                 { 3, MakeBox(glm::vec3(0, 0, -15)) },
+                 { 4, MakeBox(glm::vec3(5, 0, -2)) } });
+    auto hit = bvh_.Raycast(glm::vec3(0.0f), glm::vec3(0, 0, -1));
+    EXPECT_EQ(2, hit.id);
+    EXPECT_FLOAT_EQ(4.5f, hit.distance);
+    hit = bvh_.Raycast(glm::vec3(0.0f), glm::vec3(1, 0, 0));
+    EXPECT_EQ(frame::NullId, hit.id);
+    // Starting inside a box.
+    hit = bvh_.Raycast(glm::vec3(0, 0, -10), glm::vec3(0, 0, 1));
+    EXPECT_EQ(1, hit.id);
+    EXPECT_FLOAT_EQ(0.0f, hit.distance);
+}
+
+TEST_F(BvhTest, UpdateBvhTest) {
+    bvh_.Build(MakeGrid());
+    const glm::vec3 far_away(100.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(bvh_.QueryBox(far_away, far_away).empty());
+    // Move the first box far from the grid, the parents are refitted.
+    bvh_.Update(1, MakeBox(far_away));
+    EXPECT_EQ(std::vector<frame::EntityId>{ 1 }, bvh_.QueryBox(far_away, far_away));
+    EXPECT_TRUE(bvh_.QueryBox(glm::vec3(0.0f), glm::vec3(0.0f)).empty());
+    EXPECT_EQ(1, bvh_.Raycast(glm::vec3(200.0f, 0.0f, 0.0f), glm::vec3(-1, 0, 0)).id);
+    EXPECT_THROW(bvh_.Update(1001, MakeBox(far_away)), std::runtime_error);
+    EXPECT_THROW(bvh_.Update(1, frame::BoundingVolume{}), std::runtime_error);
+}
+
+}  // End namespace test.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/bvh.h"
+
+namespace test {
+
+class BvhTest : public testing::Test {
+   public:
+    BvhTest() = default;
+
+   protected:
+    frame::Bvh bvh_ = {};
+};
+
+}  // End namespace test.
@@ -37,4 +37,21 @@ namespace test {
 		EXPECT_TRUE(camera_);
 	}
 
+	TEST_F(CameraTest, RayDirectionCameraTest)
+	{
+		camera_ = std::make_shared<frame::Camera>(
+			glm::vec3(0.f, 0.f, 3.f),
+			glm::vec3(0.f, 0.f, -1.f),
+			glm::vec3(0.f, 1.f, 0.f),
+			90.f,
+			1.f);
+		// Center of the screen is the front, the top right corner is at 45 degrees on both axis.
+		glm::vec3 center = camera_->ComputeRayDirection({ 50.f, 50.f }, { 100.f, 100.f });
+		EXPECT_NEAR(-1.f, center.z, 1e-4);
+		glm::vec3 corner = camera_->ComputeRayDirection({ 100.f, 0.f }, { 100.f, 100.f });
+		EXPECT_NEAR(corner.x, corner.y, 1e-4);
+		EXPECT_NEAR(corner.x, -corner.z, 1e-4);
+		EXPECT_LT(0.f, corner.x);
+	}
+
 } // End namespace test.
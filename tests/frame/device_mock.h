@@ -20,6 +20,11 @@ class DeviceMock : public frame::DeviceInterface {
     MOCK_METHOD(frame::LevelInterface*, GetLevel, (), (override));
     MOCK_METHOD(void*, GetDeviceContext, (), (const, override));
     MOCK_METHOD(void, ScreenShot, ((const std::string&)), (const, override));
+    MOCK_METHOD(std::future<void>, ScreenShotAsync, ((const std::string&)), (override));
+    MOCK_METHOD(void, StartCapture, ((const std::string&), (std::uint32_t)), (override));
+    MOCK_METHOD(void, StopCapture, (), (override));
+    MOCK_METHOD(std::future<std::vector<std::uint8_t>>, ReadTextureAsync, ((frame::EntityId)),
+                (override));
     MOCK_METHOD(frame::DeviceEnum, GetDeviceEnum, (), (const, override));
     MOCK_METHOD(std::unique_ptr<frame::BufferInterface>, CreatePointBuffer,
                 ((std::vector<float> &&)), (override));
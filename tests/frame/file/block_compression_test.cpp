@@ -0,0 +1,92 @@
+#include "frame/file/block_compression_test.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace test {
+
+namespace {
+
+int MaxError(const std::vector<std::uint8_t>& expected, const std::vector<std::uint8_t>& result,
+             int channel_count) {
+    int max_error = 0;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        if (static_cast<int>(i % 4) >= channel_count) continue;
+        max_error = std::max(max_error, std::abs(expected[i] - result[i]));
+    }
+    return max_error;
+}
+
+}  // End namespace.
+
+TEST_F(BlockCompressionTest, SolidColorTest) {
+    const glm::uvec2 size = { 4, 4 };
+    // Exactly representable in 5:6:5.
+    std::vector<std::uint8_t> rgba;
+    for (int i = 0; i < 16; ++i) {
+        rgba.insert(rgba.end(), { 255, 0, 255, 255 });
+    }
+    const auto blocks = frame::file::CompressImage(rgba.data(), size,
+                                                   frame::file::CompressedFormatEnum::BC1);
+    ASSERT_EQ(8, blocks.size());
+    const auto result =
+        frame::file::DecompressImage(blocks.data(), size, frame::file::CompressedFormatEnum::BC1);
+    EXPECT_EQ(rgba, result);
+}
+
+TEST_F(BlockCompressionTest, GradientTest) {
+    const glm::uvec2 size = { 32, 12 };
+    std::vector<std::uint8_t> rgba;
+    for (std::uint32_t y = 0; y < size.y; ++y) {
+        for (std::uint32_t x = 0; x < size.x; ++x) {
+            rgba.push_back(static_cast<std::uint8_t>(x * 8));
+            rgba.push_back(static_cast<std::uint8_t>(y * 16));
+            rgba.push_back(static_cast<std::uint8_t>(128));
+            rgba.push_back(static_cast<std::uint8_t>(255 - x * 4));
+        }
+    }
+    struct Case {
+        frame::file::CompressedFormatEnum format;
+        int channel_count;
+        int tolerance;
+    };
+    for (const auto& test_case : { Case{ frame::file::CompressedFormatEnum::BC1, 3, 24 },
+                                   Case{ frame::file::CompressedFormatEnum::BC3, 4, 24 },
+                                   Case{ frame::file::CompressedFormatEnum::BC4, 1, 4 },
+                                   Case{ frame::file::CompressedFormatEnum::BC5, 2, 4 } }) {
+        const auto blocks = frame::file::CompressImage(rgba.data(), size, test_case.format);
+        EXPECT_EQ(frame::file::GetCompressedImageSize(test_case.format, size), blocks.size());
+        const auto result = frame::file::DecompressImage(blocks.data(), size, test_case.format);
+        ASSERT_EQ(rgba.size(), result.size());
+        EXPECT_GE(test_case.tolerance, MaxError(rgba, result, test_case.channel_count));
+    }
+}
+
+TEST_F(BlockCompressionTest, UnsupportedFormatTest) {
+    const std::vector<std::uint8_t> rgba(4 * 4 * 4, 0);
+    EXPECT_THROW(frame::file::CompressImage(rgba.data(), { 4, 4 },
+                                            frame::file::CompressedFormatEnum::BC7),
+                 std::runtime_error);
+}
+
+TEST_F(BlockCompressionTest, DownsampleImageTest) {
+    const std::vector<std::uint8_t> rgba = { 0,  0,  0,  0,  10, 20, 30, 40,
+                                             20, 40, 60, 80, 30, 60, 90, 120 };
+    const auto result = frame::file::DownsampleImage(rgba.data(), { 2, 2 });
+    const std::vector<std::uint8_t> expected = { 15, 30, 45, 60 };
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(BlockCompressionTest, CompressImageWithMipmapsTest) {
+    const glm::uvec2 size = { 16, 4 };
+    const std::vector<std::uint8_t> rgba(size.x * size.y * 4, 128);
+    const auto compressed = frame::file::CompressImageWithMipmaps(
+        rgba.data(), size, frame::file::CompressedFormatEnum::BC4);
+    ASSERT_EQ(5, compressed.GetMipCount());
+    EXPECT_EQ(1, compressed.GetLevelSize(4).x);
+    EXPECT_EQ(1, compressed.GetLevelSize(4).y);
+    EXPECT_EQ(8, compressed.GetLevel(4).size());
+}
+
+}  // End namespace test.
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/file/block_compression.h"
+
+namespace test {
+
+class BlockCompressionTest : public testing::Test {
+   public:
+    BlockCompressionTest() = default;
+};
+
+}  // End namespace test.
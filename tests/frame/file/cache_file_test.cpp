@@ -0,0 +1,70 @@
+#include "frame/file/cache_file_test.h"
+
+#include <fstream>
+#include <vector>
+
+namespace test {
+
+TEST_F(CacheFileTest, HashCacheFileTest) {
+    const auto hash = frame::file::HashStrings({ "vertex", "fragment" });
+    EXPECT_EQ(hash, frame::file::HashStrings({ "vertex", "fragment" }));
+    // Any change in the strings, their split or what came before change the hash.
+    EXPECT_NE(hash, frame::file::HashStrings({ "vertex", "fragmenT" }));
+    EXPECT_NE(hash, frame::file::HashStrings({ "vertexf", "ragment" }));
+    EXPECT_NE(hash, frame::file::HashStrings({ "vertex", "fragment" }, hash));
+    const auto file_name = cache_directory_ / "source.txt";
+    std::filesystem::create_directories(cache_directory_);
+    {
+        std::ofstream ofs(file_name, std::ios::binary);
+        ofs << "vertexfragment";
+    }
+    EXPECT_EQ(frame::file::HashBytes("vertexfragment", 14), frame::file::HashFile(file_name));
+    EXPECT_NE(frame::file::HashFile(file_name), frame::file::HashFile(file_name, 1));
+    EXPECT_THROW(frame::file::HashFile(cache_directory_ / "missing.txt"), std::runtime_error);
+}
+
+TEST_F(CacheFileTest, CacheDirectoryTest) {
+    EXPECT_EQ("frame_test_cache", frame::file::GetCacheDirectory("test").filename());
+    frame::file::SetCacheDirectory("test", cache_directory_);
+    EXPECT_EQ(cache_directory_, frame::file::GetCacheDirectory("test"));
+    // Other caches are not affected.
+    EXPECT_EQ("frame_other_cache", frame::file::GetCacheDirectory("other").filename());
+    frame::file::SetCacheDirectory("test", {});
+    EXPECT_TRUE(frame::file::GetCacheDirectory("test").empty());
+    const auto path = frame::file::GetCachePath(cache_directory_, "name", 0x2a, ".ext");
+    EXPECT_EQ(cache_directory_, path.parent_path());
+    EXPECT_EQ("name.000000000000002a.ext", path.filename());
+}
+
+TEST_F(CacheFileTest, ReadWriteCacheFileTest) {
+    const auto file_name                      = cache_directory_ / "sub" / "test.cache";
+    const frame::file::CacheFileHeader header = { { 'T', 'E', 'S', 'T' }, 1, 42 };
+    std::ifstream ifs;
+    EXPECT_FALSE(frame::file::OpenCacheFile(file_name, header, ifs));
+    const std::vector<std::uint8_t> first  = { 1, 2, 3 };
+    const std::vector<std::uint8_t> second = { 4, 5 };
+    frame::file::WriteCacheFile(
+        file_name, header, { { first.data(), first.size() }, { second.data(), second.size() } });
+    EXPECT_FALSE(std::filesystem::exists(file_name.string() + ".tmp"));
+    ASSERT_TRUE(frame::file::OpenCacheFile(file_name, header, ifs));
+    std::vector<std::uint8_t> content(5);
+    ifs.read(reinterpret_cast<char*>(content.data()), content.size());
+    EXPECT_TRUE(ifs);
+    EXPECT_EQ(std::vector<std::uint8_t>({ 1, 2, 3, 4, 5 }), content);
+    // A file of another type, version or made from other sources is never used.
+    for (auto other : { frame::file::CacheFileHeader{ { 'T', 'E', 'S', 'X' }, 1, 42 },
+                        frame::file::CacheFileHeader{ { 'T', 'E', 'S', 'T' }, 2, 42 },
+                        frame::file::CacheFileHeader{ { 'T', 'E', 'S', 'T' }, 1, 43 } }) {
+        std::ifstream other_ifs;
+        EXPECT_FALSE(frame::file::OpenCacheFile(file_name, other, other_ifs));
+    }
+    // Neither is a file too small to hold a header.
+    {
+        std::ofstream ofs(file_name, std::ios::binary | std::ios::trunc);
+        ofs << "TEST";
+    }
+    std::ifstream truncated_ifs;
+    EXPECT_FALSE(frame::file::OpenCacheFile(file_name, header, truncated_ifs));
+}
+
+}  // End namespace test.
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "frame/file/cache_file.h"
+
+namespace test {
+
+class CacheFileTest : public testing::Test {
+   public:
+    CacheFileTest() = default;
+    ~CacheFileTest() override { std::filesystem::remove_all(cache_directory_); }
+
+   protected:
+    const std::filesystem::path cache_directory_ =
+        std::filesystem::temp_directory_path() / "frame_cache_file_test";
+};
+
+}  // End namespace test.
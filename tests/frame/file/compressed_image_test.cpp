@@ -0,0 +1,153 @@
+#include "frame/file/compressed_image_test.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "frame/file/block_compression.h"
+
+namespace test {
+
+namespace {
+
+std::vector<std::uint8_t> MakeGradient(glm::uvec2 size) {
+    std::vector<std::uint8_t> rgba;
+    for (std::uint32_t y = 0; y < size.y; ++y) {
+        for (std::uint32_t x = 0; x < size.x; ++x) {
+            rgba.push_back(static_cast<std::uint8_t>(x * 255 / (size.x - 1)));
+            rgba.push_back(static_cast<std::uint8_t>(y * 255 / (size.y - 1)));
+            rgba.push_back(static_cast<std::uint8_t>((x + y) * 4));
+            rgba.push_back(static_cast<std::uint8_t>(255 - y * 8));
+        }
+    }
+    return rgba;
+}
+
+}  // End namespace.
+
+TEST_F(CompressedImageTest, CompressedSizeTest) {
+    using frame::file::CompressedFormatEnum;
+    EXPECT_EQ(8, frame::file::GetCompressedBlockSize(CompressedFormatEnum::BC1));
+    EXPECT_EQ(16, frame::file::GetCompressedBlockSize(CompressedFormatEnum::BC3));
+    EXPECT_EQ(8, frame::file::GetCompressedBlockSize(CompressedFormatEnum::BC4));
+    EXPECT_EQ(16, frame::file::GetCompressedBlockSize(CompressedFormatEnum::BC5));
+    EXPECT_EQ(16, frame::file::GetCompressedBlockSize(CompressedFormatEnum::BC7));
+    EXPECT_EQ(8, frame::file::GetCompressedBlockSize(CompressedFormatEnum::ETC2_RGB));
+    EXPECT_EQ(16, frame::file::GetCompressedBlockSize(CompressedFormatEnum::ETC2_RGBA));
+    // Partial blocks are rounded up.
+    EXPECT_EQ(2 * 2 * 8, frame::file::GetCompressedImageSize(CompressedFormatEnum::BC1, { 5, 8 }));
+    EXPECT_EQ(16, frame::file::GetCompressedImageSize(CompressedFormatEnum::BC3, { 1, 1 }));
+    EXPECT_TRUE(frame::file::IsCompressedImageFile("texture.DDS"));
+    EXPECT_TRUE(frame::file::IsCompressedImageFile("texture.ktx"));
+    EXPECT_FALSE(frame::file::IsCompressedImageFile("texture.png"));
+}
+
+TEST_F(CompressedImageTest, SaveAndLoadDdsTest) {
+    const glm::uvec2 size = { 16, 8 };
+    const auto rgba       = MakeGradient(size);
+    const auto compressed = frame::file::CompressImageWithMipmaps(
+        rgba.data(), size, frame::file::CompressedFormatEnum::BC3);
+    ASSERT_EQ(5, compressed.GetMipCount());
+    compressed.SaveToDdsFile(file_name_);
+    frame::file::CompressedImage loaded(file_name_, false);
+    EXPECT_EQ(frame::file::CompressedFormatEnum::BC3, loaded.GetFormat());
+    EXPECT_EQ(size.x, loaded.GetSize().x);
+    EXPECT_EQ(size.y, loaded.GetSize().y);
+    ASSERT_EQ(compressed.GetMipCount(), loaded.GetMipCount());
+    for (int i = 0; i < loaded.GetMipCount(); ++i) {
+        EXPECT_EQ(compressed.GetLevel(i), loaded.GetLevel(i));
+    }
+}
+
+TEST_F(CompressedImageTest, LoadKtxTest) {
+    const std::filesystem::path ktx_file =
+        std::filesystem::temp_directory_path() / "frame_compressed_image_test.ktx";
+    const std::uint8_t identifier[12] = { 0xAB, 'K',  'T',  'X',  ' ', '1',
+                                          '1',  0xBB, '\r', '\n', 0x1A, '\n' };
+    // Endianness, type, type size, format, internal format (RGTC1), base internal format, width,
+    // height, depth, array elements, faces, mip levels and key value size.
+    const std::uint32_t header[13] = { 0x04030201, 0, 1, 0, 0x8DBB, 0x1903, 4, 4, 0, 0, 1, 1, 0 };
+    const std::uint32_t image_size = 8;
+    const std::uint8_t block[8]    = { 200, 100, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC };
+    {
+        std::ofstream ofs(ktx_file, std::ios::binary);
+        ofs.write(reinterpret_cast<const char*>(identifier), sizeof(identifier));
+        ofs.write(reinterpret_cast<const char*>(header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(&image_size), sizeof(image_size));
+        ofs.write(reinterpret_cast<const char*>(block), sizeof(block));
+    }
+    frame::file::CompressedImage loaded(ktx_file, false);
+    std::filesystem::remove(ktx_file);
+    EXPECT_EQ(frame::file::CompressedFormatEnum::BC4, loaded.GetFormat());
+    EXPECT_EQ(4, loaded.GetSize().x);
+    EXPECT_EQ(4, loaded.GetSize().y);
+    ASSERT_EQ(1, loaded.GetMipCount());
+    ASSERT_EQ(sizeof(block), loaded.GetLevel(0).size());
+    EXPECT_EQ(0, std::memcmp(block, loaded.GetLevel(0).data(), sizeof(block)));
+}
+
+TEST_F(CompressedImageTest, InvalidMipCountTest) {
+    const auto compressed = frame::file::CompressImageWithMipmaps(
+        MakeGradient({ 8, 8 }).data(), { 8, 8 }, frame::file::CompressedFormatEnum::BC1);
+    compressed.SaveToDdsFile(file_name_);
+    // More levels than the chain of a 8x8 image (it would shift the size by more than 32 bits),
+    // with enough data for all of them so it isn't rejected as truncated.
+    {
+        std::fstream fs(file_name_, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint32_t mip_count = 40;
+        fs.seekp(4 + 24);
+        fs.write(reinterpret_cast<const char*>(&mip_count), sizeof(mip_count));
+        const std::vector<char> padding(mip_count * 8, 0);
+        fs.seekp(0, std::ios::end);
+        fs.write(padding.data(), padding.size());
+    }
+    EXPECT_THROW(frame::file::CompressedImage(file_name_, false), std::runtime_error);
+}
+
+TEST_F(CompressedImageTest, FlipVerticallyTest) {
+    const glm::uvec2 size = { 8, 8 };
+    const auto rgba       = MakeGradient(size);
+    for (auto format : { frame::file::CompressedFormatEnum::BC1,
+                         frame::file::CompressedFormatEnum::BC3,
+                         frame::file::CompressedFormatEnum::BC4,
+                         frame::file::CompressedFormatEnum::BC5 }) {
+        auto compressed = frame::file::CompressImageWithMipmaps(rgba.data(), size, format);
+        compressed.SaveToDdsFile(file_name_);
+        frame::file::CompressedImage flipped(file_name_);
+        ASSERT_EQ(compressed.GetMipCount(), flipped.GetMipCount());
+        for (int i = 0; i < flipped.GetMipCount(); ++i) {
+            const glm::uvec2 level_size = compressed.GetLevelSize(i);
+            const auto expected =
+                frame::file::DecompressImage(compressed.GetLevel(i).data(), level_size, format);
+            const auto result =
+                frame::file::DecompressImage(flipped.GetLevel(i).data(), level_size, format);
+            for (std::uint32_t y = 0; y < level_size.y; ++y) {
+                for (std::uint32_t x = 0; x < level_size.x * 4; ++x) {
+                    EXPECT_EQ(expected[y * level_size.x * 4 + x],
+                              result[(level_size.y - 1 - y) * level_size.x * 4 + x]);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(CompressedImageTest, CannotFlipVerticallyTest) {
+    const glm::uvec2 size = { 4, 6 };
+    const auto rgba       = MakeGradient(size);
+    auto compressed       = frame::file::CompressedImage(
+        frame::file::CompressedFormatEnum::BC1, size,
+        { frame::file::CompressImage(rgba.data(), size, frame::file::CompressedFormatEnum::BC1) });
+    EXPECT_FALSE(compressed.CanFlipVertically());
+    EXPECT_THROW(compressed.FlipVertically(), std::runtime_error);
+}
+
+TEST_F(CompressedImageTest, InvalidFileTest) {
+    EXPECT_THROW(frame::file::CompressedImage("frame_missing_compressed_image.dds"),
+                 std::runtime_error);
+    EXPECT_THROW(frame::file::CompressedImage(frame::file::CompressedFormatEnum::BC1, { 4, 4 },
+                                              { std::vector<std::uint8_t>(4) }),
+                 std::runtime_error);
+}
+
+}  // End namespace test.
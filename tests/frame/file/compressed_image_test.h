@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "frame/file/compressed_image.h"
+
+namespace test {
+
+class CompressedImageTest : public testing::Test {
+   public:
+    CompressedImageTest() = default;
+    ~CompressedImageTest() override { std::filesystem::remove(file_name_); }
+
+   protected:
+    std::filesystem::path file_name_ =
+        std::filesystem::temp_directory_path() / "frame_compressed_image_test.dds";
+};
+
+}  // End namespace test.
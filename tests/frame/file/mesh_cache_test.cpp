@@ -0,0 +1,62 @@
+#include "frame/file/mesh_cache_test.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "frame/vertex_packing.h"
+
+namespace test {
+
+TEST_F(MeshCacheTest, WriteAndReadCompiledMeshTest) {
+    const std::vector<float> points                = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0 };
+    const std::vector<float> normals               = { 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1 };
+    const std::vector<float> textures              = { 0, 0, 1, 0, 1, 1, 0, 1 };
+    const std::vector<std::uint32_t> indices       = { 0, 1, 2, 0, 2, 3 };
+    std::vector<frame::InterleavedVertices> meshes = {
+        frame::InterleaveVertices(points, {}, normals, textures, indices),
+        frame::InterleaveVertices(points, {}, {}, {}, indices),
+    };
+    frame::file::WriteCompiledMeshFile(file_name_, 0x1234, meshes);
+    frame::file::CompiledMeshFile compiled_file(file_name_);
+    EXPECT_EQ(0x1234, compiled_file.GetSourceHash());
+    ASSERT_EQ(meshes.size(), compiled_file.GetMeshes().size());
+    for (std::size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh = compiled_file.GetMeshes()[i];
+        EXPECT_EQ(meshes[i].vertex_stride, mesh.vertex_stride);
+        EXPECT_EQ(meshes[i].index_element_size, mesh.index_element_size);
+        ASSERT_EQ(meshes[i].vertex_attributes.size(), mesh.vertex_attributes.size());
+        for (std::size_t j = 0; j < mesh.vertex_attributes.size(); ++j) {
+            EXPECT_EQ(meshes[i].vertex_attributes[j].location, mesh.vertex_attributes[j].location);
+            EXPECT_EQ(meshes[i].vertex_attributes[j].format, mesh.vertex_attributes[j].format);
+            EXPECT_EQ(meshes[i].vertex_attributes[j].offset, mesh.vertex_attributes[j].offset);
+        }
+        // Blobs are aligned and identical.
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(mesh.vertices) % 16);
+        ASSERT_EQ(meshes[i].vertices.size(), mesh.vertex_size);
+        EXPECT_EQ(0, std::memcmp(meshes[i].vertices.data(), mesh.vertices, mesh.vertex_size));
+        ASSERT_EQ(meshes[i].indices.size(), mesh.index_size);
+        EXPECT_EQ(0, std::memcmp(meshes[i].indices.data(), mesh.indices, mesh.index_size));
+    }
+}
+
+TEST_F(MeshCacheTest, InvalidCompiledMeshTest) {
+    {
+        std::ofstream ofs(file_name_, std::ios::binary);
+        ofs << "This is not a compiled mesh file at all.";
+    }
+    EXPECT_THROW(frame::file::CompiledMeshFile compiled_file(file_name_), std::runtime_error);
+}
+
+TEST_F(MeshCacheTest, CompiledMeshPathTest) {
+    {
+        std::ofstream ofs(file_name_, std::ios::binary);
+        ofs << "v 0 0 0";
+    }
+    const auto hash = frame::file::HashFile(file_name_);
+    const auto path = frame::file::GetCompiledMeshPath("asset/model/apple.obj", hash);
+    EXPECT_EQ(std::filesystem::path("asset/model"), path.parent_path());
+    EXPECT_EQ(".fmesh", path.extension());
+    EXPECT_NE(path, frame::file::GetCompiledMeshPath("asset/model/apple.obj", hash + 1));
+}
+
+}  // End namespace test.
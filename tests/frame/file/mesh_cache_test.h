@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "frame/file/mesh_cache.h"
+
+namespace test {
+
+class MeshCacheTest : public testing::Test {
+   public:
+    MeshCacheTest() = default;
+    ~MeshCacheTest() override { std::filesystem::remove(file_name_); }
+
+   protected:
+    std::filesystem::path file_name_ =
+        std::filesystem::temp_directory_path() / "frame_mesh_cache_test.fmesh";
+};
+
+}  // End namespace test.
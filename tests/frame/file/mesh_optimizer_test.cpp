@@ -0,0 +1,90 @@
+#include "frame/file/mesh_optimizer_test.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+
+namespace test {
+
+namespace {
+
+// Sorted list of triangles (each one rotated so the smallest index is first).
+std::vector<std::array<std::uint32_t, 3>> GetTriangles(const std::vector<std::uint32_t>& indices) {
+    std::vector<std::array<std::uint32_t, 3>> triangles;
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        std::array<std::uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()),
+                    triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+}  // End namespace.
+
+TEST_F(MeshOptimizerTest, WeldVerticesTest) {
+    CreateGrid(8);
+    // Unweld the grid, every corner of every triangle is a new vertex.
+    std::vector<glm::vec3> corners;
+    std::vector<std::uint32_t> corner_indices;
+    for (const auto index : indices_) {
+        corner_indices.push_back(static_cast<std::uint32_t>(corners.size()));
+        corners.push_back(positions_[index]);
+    }
+    frame::file::WeldVertices(corners, corner_indices);
+    EXPECT_EQ(positions_.size(), corners.size());
+    ASSERT_EQ(indices_.size(), corner_indices.size());
+    for (std::size_t i = 0; i < indices_.size(); ++i) {
+        EXPECT_EQ(positions_[indices_[i]], corners[corner_indices[i]]);
+    }
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexCacheTest) {
+    CreateGrid(32);
+    // Shuffle the triangles to make the cache useless.
+    std::vector<std::uint32_t> order(indices_.size() / 3);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    std::vector<std::uint32_t> shuffled;
+    for (const auto triangle : order) {
+        shuffled.insert(shuffled.end(), indices_.begin() + triangle * 3,
+                        indices_.begin() + triangle * 3 + 3);
+    }
+    const float acmr_before = frame::file::ComputeAcmr(shuffled, positions_.size());
+    auto optimized          = shuffled;
+    frame::file::OptimizeVertexCache(optimized, positions_.size());
+    const float acmr_after = frame::file::ComputeAcmr(optimized, positions_.size());
+    EXPECT_LT(acmr_after, acmr_before);
+    EXPECT_LT(acmr_after, 1.0f);
+    EXPECT_EQ(GetTriangles(shuffled), GetTriangles(optimized));
+}
+
+TEST_F(MeshOptimizerTest, OptimizeOverdrawTest) {
+    CreateGrid(32);
+    frame::file::OptimizeVertexCache(indices_, positions_.size());
+    const float acmr_before = frame::file::ComputeAcmr(indices_, positions_.size());
+    auto optimized          = indices_;
+    frame::file::OptimizeOverdraw(optimized, positions_, 1.05f);
+    EXPECT_LE(frame::file::ComputeAcmr(optimized, positions_.size()), acmr_before * 1.05f);
+    EXPECT_EQ(GetTriangles(indices_), GetTriangles(optimized));
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexFetchTest) {
+    CreateGrid(4);
+    std::reverse(indices_.begin(), indices_.end());
+    const auto original = indices_;
+    const auto remap    = frame::file::OptimizeVertexFetch(indices_, positions_.size());
+    const auto vertices = frame::file::RemapVertices(positions_, remap);
+    EXPECT_EQ(positions_.size(), vertices.size());
+    // Vertices are now in the order of first use.
+    std::uint32_t next_vertex = 0;
+    for (std::size_t i = 0; i < indices_.size(); ++i) {
+        EXPECT_EQ(positions_[original[i]], vertices[indices_[i]]);
+        if (indices_[i] == next_vertex) next_vertex++;
+        EXPECT_LT(indices_[i], next_vertex);
+    }
+}
+
+}  // End namespace test.
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/file/mesh_optimizer.h"
+
+namespace test {
+
+class MeshOptimizerTest : public testing::Test {
+   public:
+    MeshOptimizerTest() = default;
+
+   protected:
+    // Create a regular grid of size x size quads (2 triangles per quad).
+    void CreateGrid(std::uint32_t size) {
+        positions_.clear();
+        indices_.clear();
+        for (std::uint32_t y = 0; y <= size; ++y) {
+            for (std::uint32_t x = 0; x <= size; ++x) {
+                positions_.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            }
+        }
+        for (std::uint32_t y = 0; y < size; ++y) {
+            for (std::uint32_t x = 0; x < size; ++x) {
+                const std::uint32_t i = y * (size + 1) + x;
+                indices_.insert(indices_.end(), { i, i + 1, i + size + 1 });
+                indices_.insert(indices_.end(), { i + 1, i + size + 2, i + size + 1 });
+            }
+        }
+    }
+
+   protected:
+    std::vector<glm::vec3> positions_   = {};
+    std::vector<std::uint32_t> indices_ = {};
+};
+
+}  // End namespace test.
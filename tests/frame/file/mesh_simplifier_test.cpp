@@ -0,0 +1,68 @@
+#include "frame/file/mesh_simplifier_test.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace test {
+
+namespace {
+
+// Signed area (seen from +z) of the triangles of a flat mesh, the smallest one goes in min_area.
+float ComputeArea(const std::vector<std::uint32_t>& indices,
+                  const std::vector<glm::vec3>& positions, float& min_area) {
+    float area = 0.0f;
+    min_area   = std::numeric_limits<float>::max();
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        const glm::vec3 normal =
+            glm::cross(positions[indices[i + 1]] - positions[indices[i]],
+                       positions[indices[i + 2]] - positions[indices[i]]);
+        area += normal.z * 0.5f;
+        min_area = std::min(min_area, normal.z * 0.5f);
+    }
+    return area;
+}
+
+}  // End namespace.
+
+TEST_F(MeshSimplifierTest, SimplifyMeshTest) {
+    CreateGridWithSeam(16);
+    const std::size_t target = indices_.size() / 4;
+    const auto simplified    = frame::file::SimplifyMesh(indices_, positions_, target);
+    EXPECT_FALSE(simplified.empty());
+    EXPECT_LE(simplified.size(), target);
+    EXPECT_EQ(0, simplified.size() % 3);
+    for (const auto index : simplified) ASSERT_LT(index, positions_.size());
+    // No hole (the seam didn't open, the borders stayed) and no triangle flipped.
+    float min_area = 0.0f;
+    EXPECT_FLOAT_EQ(16.0f * 16.0f, ComputeArea(simplified, positions_, min_area));
+    EXPECT_GT(min_area, 0.0f);
+}
+
+TEST_F(MeshSimplifierTest, LevelOfDetailMeshSimplifierTest) {
+    CreateGridWithSeam(16);
+    const auto level_of_detail_indices =
+        frame::file::BuildLevelOfDetailIndices(indices_, positions_, 4);
+    const auto& offsets = level_of_detail_indices.offsets;
+    ASSERT_EQ(4, offsets.size());
+    EXPECT_EQ(0, offsets[0]);
+    EXPECT_EQ(indices_.size(), offsets[1]);
+    EXPECT_TRUE(std::equal(indices_.begin(), indices_.end(),
+                           level_of_detail_indices.indices.begin()));
+    for (std::size_t level = 1; level < offsets.size(); ++level) {
+        const std::size_t end = (level + 1 < offsets.size())
+                                    ? offsets[level + 1]
+                                    : level_of_detail_indices.indices.size();
+        // Every level has at most half the triangles of the previous one.
+        EXPECT_LE((end - offsets[level]) * 2, offsets[level] - offsets[level - 1]);
+        const std::vector<std::uint32_t> level_indices(
+            level_of_detail_indices.indices.begin() + offsets[level],
+            level_of_detail_indices.indices.begin() + end);
+        float min_area = 0.0f;
+        EXPECT_FLOAT_EQ(16.0f * 16.0f, ComputeArea(level_indices, positions_, min_area));
+    }
+    // Nothing left to simplify in a single triangle.
+    const auto single = frame::file::BuildLevelOfDetailIndices({ 0, 1, 2 }, positions_, 4);
+    EXPECT_EQ(1, single.offsets.size());
+}
+
+}  // End namespace test.
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "frame/file/mesh_simplifier.h"
+
+namespace test {
+
+class MeshSimplifierTest : public testing::Test {
+   public:
+    MeshSimplifierTest() = default;
+
+   protected:
+    // Create a regular grid of size x size quads (2 triangles per quad) facing +z, the vertices of
+    // the middle column are duplicated (as a seam of texture coordinates would do).
+    void CreateGridWithSeam(std::uint32_t size) {
+        positions_.clear();
+        indices_.clear();
+        for (std::uint32_t y = 0; y <= size; ++y) {
+            for (std::uint32_t x = 0; x <= size; ++x) {
+                positions_.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            }
+        }
+        const std::uint32_t seam = size / 2;
+        std::vector<std::uint32_t> seam_indices;
+        for (std::uint32_t y = 0; y <= size; ++y) {
+            seam_indices.push_back(static_cast<std::uint32_t>(positions_.size()));
+            positions_.push_back(positions_[y * (size + 1) + seam]);
+        }
+        // The left half uses the duplicated vertices on the seam.
+        auto vertex = [&](std::uint32_t x, std::uint32_t y, bool left) {
+            return (left && x == seam) ? seam_indices[y] : y * (size + 1) + x;
+        };
+        for (std::uint32_t y = 0; y < size; ++y) {
+            for (std::uint32_t x = 0; x < size; ++x) {
+                const bool left = x < seam;
+                indices_.insert(indices_.end(), { vertex(x, y, left), vertex(x + 1, y, left),
+                                                  vertex(x, y + 1, left) });
+                indices_.insert(indices_.end(), { vertex(x + 1, y, left),
+                                                  vertex(x + 1, y + 1, left),
+                                                  vertex(x, y + 1, left) });
+            }
+        }
+    }
+
+   protected:
+    std::vector<glm::vec3> positions_   = {};
+    std::vector<std::uint32_t> indices_ = {};
+};
+
+}  // End namespace test.
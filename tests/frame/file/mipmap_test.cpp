@@ -0,0 +1,63 @@
+#include "frame/file/mipmap_test.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace test {
+
+TEST_F(MipmapTest, GetMipmapCountTest) {
+    EXPECT_EQ(1, frame::file::GetMipmapCount({ 1, 1 }));
+    EXPECT_EQ(2, frame::file::GetMipmapCount({ 2, 1 }));
+    EXPECT_EQ(11, frame::file::GetMipmapCount({ 1024, 512 }));
+    EXPECT_EQ(10, frame::file::GetMipmapCount({ 640, 480 }));
+}
+
+TEST_F(MipmapTest, BoxFilterTest) {
+    const std::vector<std::uint8_t> pixels = { 0, 10, 20, 30, 40, 50, 60, 70 };
+    // 2x2 with 2 channels.
+    const auto result = frame::file::DownsampleLevel(pixels.data(), { 2, 2 }, 2,
+                                                     frame::proto::MipmapFilter::BOX);
+    const std::vector<std::uint8_t> expected = { 30, 40 };
+    EXPECT_EQ(expected, result);
+}
+
+TEST_F(MipmapTest, SrgbFilterTest) {
+    // Black and white average to the middle gray in linear space (188 in sRGB), alpha is linear.
+    const std::vector<std::uint8_t> pixels = { 0,   0,   0,   0,   255, 255, 255, 255,
+                                               0,   0,   0,   0,   255, 255, 255, 255 };
+    const auto result = frame::file::DownsampleLevel(pixels.data(), { 2, 2 }, 4,
+                                                     frame::proto::MipmapFilter::SRGB);
+    ASSERT_EQ(4, result.size());
+    EXPECT_EQ(188, result[0]);
+    EXPECT_EQ(188, result[1]);
+    EXPECT_EQ(188, result[2]);
+    EXPECT_EQ(128, result[3]);
+}
+
+TEST_F(MipmapTest, NormalFilterTest) {
+    // Two opposite tilts average to a unit normal pointing up (and not a shorter vector).
+    const std::vector<std::uint8_t> pixels = { 218, 128, 218, 38, 128, 218,
+                                               218, 128, 218, 38, 128, 218 };
+    const auto result = frame::file::DownsampleLevel(pixels.data(), { 2, 2 }, 3,
+                                                     frame::proto::MipmapFilter::NORMAL);
+    ASSERT_EQ(3, result.size());
+    EXPECT_NEAR(128, result[0], 1);
+    EXPECT_NEAR(128, result[1], 1);
+    EXPECT_EQ(255, result[2]);
+}
+
+TEST_F(MipmapTest, GenerateMipmapsTest) {
+    const glm::uvec2 size = { 8, 2 };
+    const std::vector<std::uint8_t> pixels(size.x * size.y * 3, 100);
+    const auto levels = frame::file::GenerateMipmaps(pixels.data(), size, 3,
+                                                     frame::proto::MipmapFilter::BOX);
+    ASSERT_EQ(3, levels.size());
+    EXPECT_EQ(4 * 1 * 3, levels[0].size());
+    EXPECT_EQ(2 * 1 * 3, levels[1].size());
+    EXPECT_EQ(1 * 1 * 3, levels[2].size());
+    for (const auto& level : levels) {
+        for (auto value : level) EXPECT_EQ(100, value);
+    }
+}
+
+}  // End namespace test.
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/file/mipmap.h"
+
+namespace test {
+
+class MipmapTest : public testing::Test {
+   public:
+    MipmapTest() = default;
+};
+
+}  // End namespace test.
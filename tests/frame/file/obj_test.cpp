@@ -51,4 +51,22 @@ TEST_F(ObjTest, ObjGetMaterialTest) {
     }
 }
 
+TEST_F(ObjTest, ObjOptimizeTest) {
+    ASSERT_FALSE(obj_);
+    obj_ =
+        std::make_unique<frame::file::Obj>(frame::file::FindFile("asset/model/apple.obj"), true);
+    EXPECT_TRUE(obj_);
+    EXPECT_NE(0, obj_->GetMeshes().size());
+    for (const auto& element : obj_->GetMeshes()) {
+        const auto& stats = element.GetOptimizerStats();
+        EXPECT_EQ(stats.vertex_count_after, element.GetVertices().size());
+        // Every corner was a vertex, welding should at least divide the count by 3.
+        EXPECT_LT(stats.vertex_count_after * 3, stats.vertex_count_before);
+        EXPECT_LT(stats.acmr_after, stats.acmr_before);
+        for (const auto index : element.GetIndices()) {
+            EXPECT_LT(index, element.GetVertices().size());
+        }
+    }
+}
+
 }  // End namespace test.
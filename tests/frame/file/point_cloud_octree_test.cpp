@@ -0,0 +1,126 @@
+#include "frame/file/point_cloud_octree_test.h"
+
+#include <algorithm>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <set>
+#include <tuple>
+
+#include "frame/camera.h"
+
+namespace test {
+
+namespace {
+
+// Points on the faces of a 10 x 10 x 10 box with a color per face.
+std::vector<frame::file::PointCloudPoint> CreateBoxPoints(std::size_t count) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(0.0f, 10.0f);
+    std::vector<frame::file::PointCloudPoint> points(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        glm::vec3 position(distribution(generator), distribution(generator),
+                           distribution(generator));
+        const int face     = static_cast<int>(i % 6);
+        position[face % 3] = (face < 3) ? 0.0f : 10.0f;
+        points[i].position = position;
+        points[i].color    = 0xff000000 | (face * 40);
+    }
+    return points;
+}
+
+std::vector<std::tuple<float, float, float, std::uint32_t>> SortPoints(
+    const std::vector<frame::file::PointCloudPoint>& points) {
+    std::vector<std::tuple<float, float, float, std::uint32_t>> result;
+    for (const auto& point : points) {
+        result.emplace_back(point.position.x, point.position.y, point.position.z, point.color);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // End namespace.
+
+TEST_F(PointCloudOctreeTest, BuildPointCloudOctreeTest) {
+    const auto points = CreateBoxPoints(30000);
+    WritePly(points);
+    frame::file::PointCloudOctreeParameter parameter = {};
+    parameter.max_node_point_count                   = 1000;
+    parameter.sampling_grid_size                     = 16;
+    parameter.max_chunk_point_count                  = 4000;
+    parameter.counting_grid_level                    = 3;
+    frame::file::BuildPointCloudOctree(ply_file_name_, octree_file_name_, parameter);
+    // The chunk files are removed.
+    EXPECT_FALSE(std::filesystem::exists(octree_file_name_.string() + ".0.chunk"));
+    frame::file::PointCloudOctree octree(octree_file_name_);
+    EXPECT_EQ(points.size(), octree.GetPointCount());
+    EXPECT_FLOAT_EQ(10.0f / 16.0f, octree.GetSpacing(0));
+    const auto& nodes = octree.GetNodes();
+    ASSERT_LT(1, nodes.size());
+    EXPECT_EQ(0, nodes.front().level);
+    // Every point is in exactly one node, and inside the cube of its node.
+    std::vector<frame::file::PointCloudPoint> read_points;
+    for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        if (i > 0) {
+            ASSERT_LE(0, node.parent);
+            EXPECT_EQ(nodes[node.parent].level + 1, node.level);
+        }
+        EXPECT_LE(node.point_count, octree.GetMaxNodePointCount());
+        const auto node_points = octree.ReadNode(i);
+        ASSERT_EQ(node.point_count, node_points.size());
+        for (const auto& point : node_points) {
+            const glm::vec3 epsilon(1e-4f);
+            EXPECT_TRUE(glm::all(glm::greaterThanEqual(point.position,
+                                                       node.bounding_volume.min - epsilon)));
+            EXPECT_TRUE(glm::all(glm::lessThanEqual(point.position,
+                                                    node.bounding_volume.max + epsilon)));
+        }
+        read_points.insert(read_points.end(), node_points.begin(), node_points.end());
+    }
+    EXPECT_EQ(SortPoints(points), SortPoints(read_points));
+}
+
+TEST_F(PointCloudOctreeTest, SelectPointCloudOctreeTest) {
+    WritePly(CreateBoxPoints(30000), true);
+    frame::file::PointCloudOctreeParameter parameter = {};
+    parameter.max_node_point_count                   = 500;
+    parameter.sampling_grid_size                     = 16;
+    frame::file::BuildPointCloudOctree(ply_file_name_, octree_file_name_, parameter);
+    frame::file::PointCloudOctree octree(octree_file_name_);
+    const auto& nodes = octree.GetNodes();
+    frame::Camera camera(glm::vec3(5.0f, 5.0f, 40.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+                         glm::vec3(0.0f, 1.0f, 0.0f), 60.0f, 1.0f, 0.1f, 1000.0f);
+    const glm::mat4 projection = camera.ComputeProjection();
+    const glm::mat4 view       = camera.ComputeView();
+    // Without error and budget limits everything is selected.
+    auto selection = octree.SelectNodes(projection, view, 1000.0f, 1000000, 0.0f);
+    EXPECT_EQ(nodes.size(), selection.size());
+    // A coarse error only selects the root.
+    selection = octree.SelectNodes(projection, view, 1000.0f, 1000000, 1000.0f);
+    ASSERT_EQ(1, selection.size());
+    EXPECT_EQ(0, selection.front());
+    // The budget is respected and the parents are always selected.
+    selection = octree.SelectNodes(projection, view, 1000.0f, 10000, 0.0f);
+    std::uint64_t point_count = 0;
+    std::set<std::uint32_t> selected;
+    for (const auto index : selection) {
+        point_count += nodes[index].point_count;
+        if (index > 0) EXPECT_TRUE(selected.count(nodes[index].parent));
+        selected.insert(index);
+    }
+    EXPECT_LE(point_count, 10000);
+    EXPECT_LT(1, selection.size());
+    // Looking away nothing is selected.
+    const glm::mat4 away = glm::lookAt(glm::vec3(5.0f, 5.0f, 40.0f), glm::vec3(5.0f, 5.0f, 80.0f),
+                                       glm::vec3(0.0f, 1.0f, 0.0f));
+    EXPECT_TRUE(octree.SelectNodes(projection, away, 1000.0f, 1000000, 0.0f).empty());
+}
+
+TEST_F(PointCloudOctreeTest, InvalidPointCloudOctreeTest) {
+    EXPECT_THROW(frame::file::PointCloudOctree octree(ply_file_name_), std::runtime_error);
+    WritePly({});
+    EXPECT_THROW(frame::file::BuildPointCloudOctree(ply_file_name_, octree_file_name_),
+                 std::runtime_error);
+}
+
+}  // End namespace test.
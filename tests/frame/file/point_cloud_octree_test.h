@@ -0,0 +1,49 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "frame/file/point_cloud_octree.h"
+
+namespace test {
+
+class PointCloudOctreeTest : public testing::Test {
+   public:
+    PointCloudOctreeTest() = default;
+    ~PointCloudOctreeTest() override {
+        std::filesystem::remove(ply_file_name_);
+        std::filesystem::remove(octree_file_name_);
+    }
+
+   protected:
+    // Write the points in a PLY file (binary little endian with colors, or ascii without).
+    void WritePly(const std::vector<frame::file::PointCloudPoint>& points, bool ascii = false) {
+        std::ofstream ofs(ply_file_name_, std::ios::binary | std::ios::trunc);
+        ofs << "ply\n" << (ascii ? "format ascii 1.0\n" : "format binary_little_endian 1.0\n");
+        ofs << "comment frame test\nelement vertex " << points.size() << "\n";
+        ofs << "property float x\nproperty float y\nproperty float z\n";
+        if (!ascii) ofs << "property uchar red\nproperty uchar green\nproperty uchar blue\n";
+        ofs << "element face 0\nproperty list uchar int vertex_indices\nend_header\n";
+        for (const auto& point : points) {
+            if (ascii) {
+                ofs << point.position.x << " " << point.position.y << " " << point.position.z
+                    << "\n";
+                continue;
+            }
+            ofs.write(reinterpret_cast<const char*>(&point.position), sizeof(point.position));
+            // Red, green and blue are the lowest bytes of the color.
+            ofs.write(reinterpret_cast<const char*>(&point.color), 3);
+        }
+    }
+
+   protected:
+    std::filesystem::path ply_file_name_ =
+        std::filesystem::temp_directory_path() / "frame_point_cloud_octree_test.ply";
+    std::filesystem::path octree_file_name_ =
+        std::filesystem::temp_directory_path() / "frame_point_cloud_octree_test.fpco";
+};
+
+}  // End namespace test.
@@ -0,0 +1,42 @@
+#include "frame/frustum_test.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "frame/camera.h"
+
+namespace test {
+
+TEST_F(FrustumTest, PlaneFrustumTest) {
+    // Orthographic box [-1, 1] on every axis.
+    frame::Frustum frustum(glm::mat4(1.0f));
+    EXPECT_EQ(glm::vec4(1, 0, 0, 1), frustum.GetPlane(0));
+    EXPECT_EQ(glm::vec4(-1, 0, 0, 1), frustum.GetPlane(1));
+    EXPECT_EQ(glm::vec4(0, 0, -1, 1), frustum.GetPlane(5));
+    EXPECT_THROW(frustum.GetPlane(6), std::runtime_error);
+}
+
+TEST_F(FrustumTest, VisibleFrustumTest) {
+    // Camera at the origin looking toward -z.
+    frame::Camera camera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+                         glm::vec3(0.0f, 1.0f, 0.0f), 90.0f, 1.0f, 0.1f, 100.0f);
+    frame::Frustum frustum(camera.ComputeProjection() * camera.ComputeView());
+    auto unit_box = frame::ComputeBoundingVolume({ -1, -1, -1, 1, 1, 1 });
+    auto at       = [&unit_box](glm::vec3 position) {
+        return frame::TransformBoundingVolume(unit_box,
+                                              glm::translate(glm::mat4(1.0f), position));
+    };
+    // In front, behind, too far, beyond the sides and crossing a plane.
+    EXPECT_TRUE(frustum.IsVisible(at(glm::vec3(0, 0, -10))));
+    EXPECT_FALSE(frustum.IsVisible(at(glm::vec3(0, 0, 10))));
+    EXPECT_FALSE(frustum.IsVisible(at(glm::vec3(0, 0, -200))));
+    EXPECT_FALSE(frustum.IsVisible(at(glm::vec3(20, 0, -10))));
+    EXPECT_FALSE(frustum.IsVisible(at(glm::vec3(0, -20, -10))));
+    EXPECT_TRUE(frustum.IsVisible(at(glm::vec3(10.5f, 0, -10))));
+    EXPECT_TRUE(frustum.IsVisible(at(glm::vec3(0, 0, 0))));
+    // Empty volumes are never culled.
+    EXPECT_TRUE(frustum.IsVisible(frame::BoundingVolume{}));
+    EXPECT_TRUE(frustum.IsBoxVisible(glm::vec3(-1, -1, -11), glm::vec3(1, 1, -9)));
+    EXPECT_FALSE(frustum.IsBoxVisible(glm::vec3(-1, -1, 9), glm::vec3(1, 1, 11)));
+}
+
+}  // End namespace test.
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/frustum.h"
+
+namespace test {
+
+class FrustumTest : public testing::Test {
+   public:
+    FrustumTest() = default;
+};
+
+}  // End namespace test.
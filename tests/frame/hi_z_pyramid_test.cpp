@@ -0,0 +1,74 @@
+#include "frame/hi_z_pyramid_test.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "frame/camera.h"
+
+namespace test {
+
+namespace {
+
+// Window depth of a point in front of the camera.
+float GetWindowDepth(const glm::mat4& view_projection, glm::vec3 point) {
+    const glm::vec4 clip = view_projection * glm::vec4(point, 1.0f);
+    return clip.z / clip.w * 0.5f + 0.5f;
+}
+
+// Unit box around a position.
+frame::BoundingVolume MakeBox(glm::vec3 position) {
+    return frame::ComputeBoundingVolume({ position.x - 0.5f, position.y - 0.5f, position.z - 0.5f,
+                                          position.x + 0.5f, position.y + 0.5f,
+                                          position.z + 0.5f });
+}
+
+}  // End namespace.
+
+TEST_F(HiZPyramidTest, BuildHiZPyramidTest) {
+    EXPECT_FALSE(hi_z_pyramid_.IsValid());
+    // 5 x 3 image with the column index as depth (in tenth).
+    std::vector<float> depths;
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 5; ++x) depths.push_back(x * 0.1f + y * 0.01f);
+    }
+    hi_z_pyramid_.Build(depths, glm::uvec2(5, 3));
+    ASSERT_EQ(3, hi_z_pyramid_.GetLevelCount());
+    EXPECT_EQ(glm::uvec2(2, 1), hi_z_pyramid_.GetLevelSize(1));
+    EXPECT_EQ(glm::uvec2(1, 1), hi_z_pyramid_.GetLevelSize(2));
+    // The last texel of an odd level covers the extra column and row.
+    EXPECT_FLOAT_EQ(0.12f, hi_z_pyramid_.GetDepth(1, glm::uvec2(0, 0)));
+    EXPECT_FLOAT_EQ(0.42f, hi_z_pyramid_.GetDepth(1, glm::uvec2(1, 0)));
+    EXPECT_FLOAT_EQ(0.42f, hi_z_pyramid_.GetDepth(2, glm::uvec2(0, 0)));
+    EXPECT_THROW(hi_z_pyramid_.GetDepth(1, glm::uvec2(2, 0)), std::runtime_error);
+    EXPECT_THROW(hi_z_pyramid_.Build({ 1.0f }, glm::uvec2(2, 2)), std::runtime_error);
+}
+
+TEST_F(HiZPyramidTest, OccludedHiZPyramidTest) {
+    // Camera at the origin looking toward -z.
+    frame::Camera camera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+                         glm::vec3(0.0f, 1.0f, 0.0f), 90.0f, 1.0f, 0.1f, 100.0f);
+    const glm::mat4 view_projection = camera.ComputeProjection() * camera.ComputeView();
+    // A wall at 10 units on the left half of the screen, nothing on the right half.
+    const float wall_depth = GetWindowDepth(view_projection, glm::vec3(0.0f, 0.0f, -10.0f));
+    std::vector<float> depths;
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) depths.push_back((x < 32) ? wall_depth : 1.0f);
+    }
+    hi_z_pyramid_.Build(depths, glm::uvec2(64, 64));
+    // Behind the wall, in front of the wall, behind but on the empty half.
+    EXPECT_TRUE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(-8.0f, 0.0f, -20.0f)),
+                                         view_projection));
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(-3.0f, 0.0f, -5.0f)),
+                                          view_projection));
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(8.0f, 0.0f, -20.0f)),
+                                          view_projection));
+    // Behind the wall but overlapping the empty half.
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(0.0f, 0.0f, -20.0f)),
+                                          view_projection));
+    // Crossing the near plane or behind the camera.
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(0.0f)), view_projection));
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(MakeBox(glm::vec3(-8.0f, 0.0f, 20.0f)),
+                                          view_projection));
+    EXPECT_FALSE(hi_z_pyramid_.IsOccluded(frame::BoundingVolume{}, view_projection));
+}
+
+}  // End namespace test.
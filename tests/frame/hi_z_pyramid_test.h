@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/hi_z_pyramid.h"
+
+namespace test {
+
+class HiZPyramidTest : public testing::Test {
+   public:
+    HiZPyramidTest() = default;
+
+   protected:
+    frame::HiZPyramid hi_z_pyramid_ = {};
+};
+
+}  // End namespace test.
@@ -1,5 +1,8 @@
 #include "frame/opengl/device_test.h"
 
+#include <chrono>
+#include <filesystem>
+
 #include "frame/file/file_system.h"
 #include "frame/json/parse_level.h"
 #include "frame/plugin_mock.h"
@@ -71,4 +74,23 @@ TEST_F(DeviceTest, AddManyDifferentPluginTest) {
     EXPECT_EQ(0, device.GetPluginPtrs().size());
 }
 
+TEST_F(DeviceTest, ScreenShotAsyncDeviceTest) {
+    EXPECT_TRUE(window_);
+    window_->GetDevice().Startup(std::move(level_));
+    auto& device = window_->GetDevice();
+    device.Display();
+    const auto file = std::filesystem::temp_directory_path() / "device_test_screen_shot.png";
+    std::filesystem::remove(file);
+    auto future = device.ScreenShotAsync(file.string());
+    // The pixels are read back at one of the next frames.
+    for (int i = 0; i < 100; ++i) {
+        if (future.wait_for(std::chrono::milliseconds(10)) == std::future_status::ready) break;
+        device.Display();
+    }
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_NO_THROW(future.get());
+    EXPECT_TRUE(std::filesystem::exists(file));
+    std::filesystem::remove(file);
+}
+
 }  // End namespace test.
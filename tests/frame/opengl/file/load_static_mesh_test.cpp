@@ -1,6 +1,7 @@
 #include "frame/opengl/file/load_static_mesh_test.h"
 
 #include "frame/file/file_system.h"
+#include "frame/file/mesh_cache.h"
 #include "frame/level.h"
 #include "frame/opengl/file/load_static_mesh.h"
 
@@ -60,4 +61,44 @@ TEST_F(LoadStaticMeshTest, CreateSceneFromFileTest) {
     }
 }
 
+TEST_F(LoadStaticMeshTest, CreateInterleavedStaticMeshFromObjFileTest) {
+    auto level = std::make_unique<frame::Level>();
+    ASSERT_TRUE(level);
+    auto node_vec = frame::opengl::file::LoadStaticMeshesFromFile(
+        *level.get(), frame::file::FindFile("asset/model/monkey.obj"), "Monkey", "", true);
+    ASSERT_TRUE(!node_vec.empty());
+    EXPECT_EQ(1, node_vec.size());
+    auto& node        = level->GetSceneNodeFromId(node_vec.at(0));
+    auto& static_mesh = level->GetStaticMeshFromId(node.GetLocalMesh());
+    EXPECT_EQ(frame::NullId, static_mesh.GetPointBufferId());
+    const auto vertex_id      = static_mesh.GetVertexBufferId();
+    const auto& vertex_buffer = level->GetBufferFromId(vertex_id);
+    EXPECT_LT(0, vertex_buffer.GetSize());
+    // Monkey has less than 65536 vertices so the indices are 16 bit.
+    EXPECT_EQ(sizeof(std::uint16_t), static_mesh.GetIndexElementSize());
+    EXPECT_LT(0, static_mesh.GetIndexSize());
+}
+
+TEST_F(LoadStaticMeshTest, CreateCompiledStaticMeshFromPlyFileTest) {
+    const auto file          = frame::file::FindFile("asset/model/apple.ply");
+    const auto compiled_path = frame::file::GetCompiledMeshPath(file, frame::file::HashFile(file));
+    std::filesystem::remove(compiled_path);
+    std::vector<std::size_t> index_sizes;
+    // First load compile the mesh, the second one map the compiled file.
+    for (int i = 0; i < 2; ++i) {
+        auto level    = std::make_unique<frame::Level>();
+        auto node_vec = frame::opengl::file::LoadStaticMeshesFromFile(*level.get(), file, "Apple",
+                                                                      "", false, false, true);
+        ASSERT_EQ(1, node_vec.size());
+        EXPECT_TRUE(std::filesystem::exists(compiled_path));
+        auto& node        = level->GetSceneNodeFromId(node_vec.at(0));
+        auto& static_mesh = level->GetStaticMeshFromId(node.GetLocalMesh());
+        EXPECT_NE(frame::NullId, static_mesh.GetVertexBufferId());
+        index_sizes.push_back(static_mesh.GetIndexSize());
+    }
+    EXPECT_LT(0, index_sizes[0]);
+    EXPECT_EQ(index_sizes[0], index_sizes[1]);
+    std::filesystem::remove(compiled_path);
+}
+
 }  // End namespace test.
@@ -0,0 +1,92 @@
+#include "frame/opengl/frame_graph_test.h"
+
+namespace test {
+
+TEST_F(FrameGraphTest, ScheduleFrameGraphTest) {
+    // node, mesh, material, program, output, input.
+    // The first pass read the output of the second one, it has to move after it.
+    frame_graph_.Compile({ { 1, 10, 20, 30, { 100 }, { 101 } },
+                           { 2, 11, 21, 31, { 101 }, {} },
+                           { 3, 12, 21, 31, { 101 }, {} } },
+                         { 100 });
+    const auto& draw_items = frame_graph_.GetDrawItems();
+    ASSERT_EQ(3, draw_items.size());
+    EXPECT_EQ(2, draw_items[0].node_id);
+    EXPECT_EQ(3, draw_items[1].node_id);
+    EXPECT_EQ(1, draw_items[2].node_id);
+    EXPECT_EQ(0, frame_graph_.GetCulledCount());
+}
+
+TEST_F(FrameGraphTest, CycleFrameGraphTest) {
+    // The two first passes read each other output, the cycle is broken in submission order.
+    frame_graph_.Compile({ { 1, 10, 20, 30, { 101 }, { 102 } },
+                           { 2, 11, 21, 31, { 102 }, { 101 } },
+                           { 3, 12, 22, 32, { 100 }, { 101, 102 } } },
+                         { 100 });
+    const auto& draw_items = frame_graph_.GetDrawItems();
+    ASSERT_EQ(3, draw_items.size());
+    EXPECT_EQ(1, draw_items[0].node_id);
+    EXPECT_EQ(2, draw_items[1].node_id);
+    EXPECT_EQ(3, draw_items[2].node_id);
+}
+
+TEST_F(FrameGraphTest, GroupStateFrameGraphTest) {
+    // Independent passes with the same state are drawn in a row.
+    frame_graph_.Compile({ { 1, 10, 20, 31, { 100 }, {} },
+                           { 2, 11, 21, 30, { 100 }, {} },
+                           { 3, 12, 20, 31, { 100 }, {} },
+                           { 4, frame::NullId, frame::NullId, frame::NullId, {}, {} },
+                           { 5, 13, 21, 30, { 100 }, {} } },
+                         { 100 });
+    const auto& draw_items = frame_graph_.GetDrawItems();
+    ASSERT_EQ(5, draw_items.size());
+    EXPECT_EQ(1, draw_items[0].node_id);
+    EXPECT_EQ(2, draw_items[1].node_id);
+    EXPECT_EQ(3, draw_items[2].node_id);
+    // Clear event is a barrier.
+    EXPECT_EQ(4, draw_items[3].node_id);
+    EXPECT_EQ(5, draw_items[4].node_id);
+}
+
+TEST_F(FrameGraphTest, CullFrameGraphTest) {
+    // Texture 102 is never read by a pass contributing to 100.
+    frame_graph_.Compile({ { 1, 10, 20, 30, { 101 }, {} },
+                           { 2, 11, 21, 31, { 102 }, { 101 } },
+                           { 3, 12, 22, 32, { 100 }, { 101 } } },
+                         { 100 });
+    const auto& draw_items = frame_graph_.GetDrawItems();
+    ASSERT_EQ(2, draw_items.size());
+    EXPECT_EQ(1, draw_items[0].node_id);
+    EXPECT_EQ(3, draw_items[1].node_id);
+    EXPECT_EQ(1, frame_graph_.GetCulledCount());
+}
+
+TEST_F(FrameGraphTest, AliasFrameGraphTest) {
+    // 101 is dead once 102 is written so 103 can reuse its memory, 102 cannot (live together).
+    frame_graph_.Compile({ { 1, 10, 20, 30, { 101 }, {} },
+                           { 2, 11, 21, 31, { 102 }, { 101 } },
+                           { 3, 12, 22, 32, { 103 }, { 102 } },
+                           { 4, 13, 23, 33, { 100 }, { 103 } } },
+                         { 100 }, { { 100, 0 }, { 101, 0 }, { 102, 0 }, { 103, 0 } });
+    const auto& texture_slots = frame_graph_.GetTextureSlots();
+    ASSERT_EQ(3, texture_slots.size());
+    EXPECT_EQ(0, texture_slots.count(100));
+    EXPECT_EQ(texture_slots.at(101), texture_slots.at(103));
+    EXPECT_NE(texture_slots.at(101), texture_slots.at(102));
+    EXPECT_EQ(2, frame_graph_.GetSlotClasses().size());
+}
+
+TEST_F(FrameGraphTest, AliasClassFrameGraphTest) {
+    // Textures of different classes never share a slot.
+    frame_graph_.Compile({ { 1, 10, 20, 30, { 101 }, {} },
+                           { 2, 11, 21, 31, { 102 }, { 101 } },
+                           { 3, 12, 22, 32, { 103 }, { 102 } },
+                           { 4, 13, 23, 33, { 100 }, { 103 } } },
+                         { 100 }, { { 101, 0 }, { 102, 0 }, { 103, 1 } });
+    const auto& texture_slots = frame_graph_.GetTextureSlots();
+    ASSERT_EQ(3, texture_slots.size());
+    EXPECT_NE(texture_slots.at(101), texture_slots.at(103));
+    EXPECT_EQ(3, frame_graph_.GetSlotClasses().size());
+}
+
+}  // End namespace test.
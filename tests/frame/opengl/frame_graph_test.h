@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/opengl/frame_graph.h"
+
+namespace test {
+
+class FrameGraphTest : public testing::Test {
+   public:
+    FrameGraphTest() = default;
+
+   protected:
+    frame::opengl::FrameGraph frame_graph_ = {};
+};
+
+}  // End namespace test.
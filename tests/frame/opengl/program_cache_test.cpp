@@ -0,0 +1,14 @@
+#include "frame/opengl/program_cache_test.h"
+
+namespace test {
+
+TEST_F(ProgramCacheTest, ReadWriteProgramCacheTest) {
+    frame::opengl::ProgramBinary program_binary = {};
+    EXPECT_FALSE(frame::opengl::ReadProgramCacheFile(file_name_, 1, program_binary));
+    frame::opengl::WriteProgramCacheFile(file_name_, 1, { 42, { 1, 2, 3, 4 } });
+    ASSERT_TRUE(frame::opengl::ReadProgramCacheFile(file_name_, 1, program_binary));
+    EXPECT_EQ(42, program_binary.format);
+    EXPECT_EQ(std::vector<std::uint8_t>({ 1, 2, 3, 4 }), program_binary.data);
+}
+
+}  // End namespace test.
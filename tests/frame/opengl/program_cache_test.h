@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "frame/opengl/program_cache.h"
+
+namespace test {
+
+class ProgramCacheTest : public testing::Test {
+   public:
+    ProgramCacheTest() = default;
+    ~ProgramCacheTest() override { std::filesystem::remove(file_name_); }
+
+   protected:
+    const std::filesystem::path file_name_ =
+        std::filesystem::temp_directory_path() / "frame_program_cache_test.fprog";
+};
+
+}  // End namespace test.
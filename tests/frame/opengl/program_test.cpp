@@ -62,6 +62,54 @@ TEST_F(ProgramTest, UniformTest) {
     EXPECT_TRUE(program_);
 }
 
+TEST_F(ProgramTest, CachedProgramTest) {
+    // The second program is linked from the binary cached by the first one (when supported).
+    for (int i = 0; i < 2; ++i) {
+        std::istringstream iss_vertex(GetVertexSource());
+        std::istringstream iss_fragment(GetFragmentSource());
+        auto program = frame::opengl::CreateProgram("cached_test", iss_vertex, iss_fragment);
+        ASSERT_TRUE(program);
+        EXPECT_EQ(4, program->GetUniformNameList().size());
+        EXPECT_TRUE(program->HasUniform("Color"));
+    }
+}
+
+TEST_F(ProgramTest, CreateProgramsTest) {
+    // The programs of a batch are returned in the order of their sources.
+    frame::opengl::ProgramSource program_source = {};
+    program_source.vertex                       = GetVertexSource();
+    program_source.fragment                     = GetFragmentSource();
+    std::vector<frame::opengl::ProgramSource> program_sources;
+    for (const auto& name : { "first", "second", "third" }) {
+        program_source.name = name;
+        program_sources.push_back(program_source);
+    }
+    auto programs = frame::opengl::CreatePrograms(program_sources);
+    ASSERT_EQ(3, programs.size());
+    for (std::size_t i = 0; i < programs.size(); ++i) {
+        ASSERT_TRUE(programs[i]);
+        EXPECT_EQ(program_sources[i].name, programs[i]->GetName());
+        EXPECT_TRUE(programs[i]->HasUniform("Color"));
+    }
+}
+
+TEST_F(ProgramTest, UniformSlotTest) {
+    std::istringstream iss_vertex(GetVertexSource());
+    std::istringstream iss_fragment(GetFragmentSource());
+    auto program = frame::opengl::CreateProgram("test", iss_vertex, iss_fragment);
+    ASSERT_TRUE(program);
+    auto& gl_program = dynamic_cast<frame::opengl::Program&>(*program);
+    // The per draw uniforms are reflected at link time.
+    EXPECT_NE(-1, gl_program.GetUniformLocation(frame::opengl::UniformSlotEnum::PROJECTION));
+    EXPECT_NE(-1, gl_program.GetUniformLocation(frame::opengl::UniformSlotEnum::VIEW));
+    EXPECT_NE(-1, gl_program.GetUniformLocation(frame::opengl::UniformSlotEnum::MODEL));
+    EXPECT_EQ(-1,
+              gl_program.GetUniformLocation(frame::opengl::UniformSlotEnum::ENVIRONMENT_MODEL));
+    EXPECT_EQ(-1, gl_program.GetUniformLocation(frame::opengl::UniformSlotEnum::TIME_S));
+    EXPECT_TRUE(gl_program.HasUniform("Color"));
+    EXPECT_FALSE(gl_program.HasUniform("time_s"));
+}
+
 const std::string ProgramTest::GetVertexSource() const {
     return R"vert(
 #version 330 core
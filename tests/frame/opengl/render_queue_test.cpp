@@ -0,0 +1,59 @@
+#include "frame/opengl/render_queue_test.h"
+
+namespace test {
+
+TEST_F(RenderQueueTest, CreateRenderQueueTest) {
+    EXPECT_TRUE(render_queue_.Empty());
+    render_queue_.Push({ 1, 2, 3, 4, { 5 }, {} });
+    EXPECT_FALSE(render_queue_.Empty());
+    render_queue_.Clear();
+    EXPECT_TRUE(render_queue_.Empty());
+}
+
+TEST_F(RenderQueueTest, SortByStateRenderQueueTest) {
+    // node, mesh, material, program, output, input.
+    render_queue_.Push({ 1, 10, 20, 31, { 100 }, {} });
+    render_queue_.Push({ 2, 11, 21, 30, { 100 }, {} });
+    render_queue_.Push({ 3, 12, 20, 31, { 100 }, {} });
+    render_queue_.Push({ 4, 13, 21, 30, { 100 }, {} });
+    render_queue_.Sort();
+    const auto& draw_items = render_queue_.GetDrawItems();
+    ASSERT_EQ(4, draw_items.size());
+    EXPECT_EQ(2, draw_items[0].node_id);
+    EXPECT_EQ(4, draw_items[1].node_id);
+    EXPECT_EQ(1, draw_items[2].node_id);
+    EXPECT_EQ(3, draw_items[3].node_id);
+}
+
+TEST_F(RenderQueueTest, OcclusionTestLastRenderQueueTest) {
+    // The items re-tested against the depth are drawn after the others of the same target.
+    render_queue_.Push({ 1, 10, 20, 30, { 100 }, {}, true });
+    render_queue_.Push({ 2, 11, 21, 31, { 100 }, {} });
+    render_queue_.Push({ 3, 12, 20, 30, { 100 }, {} });
+    render_queue_.Sort();
+    const auto& draw_items = render_queue_.GetDrawItems();
+    ASSERT_EQ(3, draw_items.size());
+    EXPECT_EQ(3, draw_items[0].node_id);
+    EXPECT_EQ(2, draw_items[1].node_id);
+    EXPECT_EQ(1, draw_items[2].node_id);
+}
+
+TEST_F(RenderQueueTest, KeepDependenciesRenderQueueTest) {
+    // The second pass read the output of the first one, it cannot move before it.
+    render_queue_.Push({ 1, 10, 20, 31, { 100 }, {} });
+    render_queue_.Push({ 2, 11, 21, 30, { 101 }, { 100 } });
+    // Clear event is a barrier.
+    render_queue_.Push({ 3, frame::NullId, frame::NullId, frame::NullId, {}, {} });
+    render_queue_.Push({ 4, 12, 20, 31, { 101 }, {} });
+    render_queue_.Push({ 5, 13, 21, 30, { 101 }, {} });
+    render_queue_.Sort();
+    const auto& draw_items = render_queue_.GetDrawItems();
+    ASSERT_EQ(5, draw_items.size());
+    EXPECT_EQ(1, draw_items[0].node_id);
+    EXPECT_EQ(2, draw_items[1].node_id);
+    EXPECT_EQ(3, draw_items[2].node_id);
+    EXPECT_EQ(5, draw_items[3].node_id);
+    EXPECT_EQ(4, draw_items[4].node_id);
+}
+
+}  // End namespace test.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/opengl/render_queue.h"
+
+namespace test {
+
+class RenderQueueTest : public testing::Test {
+   public:
+    RenderQueueTest() = default;
+
+   protected:
+    frame::opengl::RenderQueue render_queue_ = {};
+};
+
+}  // End namespace test.
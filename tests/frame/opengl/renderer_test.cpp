@@ -21,4 +21,18 @@ TEST_F(RendererTest, RenderingDisplayTest) {
     renderer_->Display();
 }
 
+TEST_F(RendererTest, RenderingOcclusionCullingTest) {
+    ASSERT_FALSE(renderer_);
+    ASSERT_TRUE(LoadDefaultLevel());
+    renderer_ = std::make_unique<frame::opengl::Renderer>(
+        *level_.get(), glm::uvec4(0, 0, window_->GetSize().x, window_->GetSize().y));
+    renderer_->SetOcclusionCulling(true);
+    // The first frame has no pyramid yet, nothing can be occluded.
+    renderer_->RenderAllMeshes(glm::mat4(1.0f), glm::mat4(1.0f));
+    EXPECT_EQ(0, renderer_->GetOccludedCount());
+    EXPECT_EQ(renderer_->GetVisibleCount(), renderer_->GetDrawnCount());
+    renderer_->RenderAllMeshes(glm::mat4(1.0f), glm::mat4(1.0f));
+    EXPECT_LE(renderer_->GetOccludedCount(), renderer_->GetVisibleCount());
+}
+
 }  // End namespace test.
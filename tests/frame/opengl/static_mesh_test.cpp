@@ -53,6 +53,37 @@ TEST_F(StaticMeshTest, CreateTorusMeshObjTest) {
     EXPECT_GE(13824, index_buffer.GetSize());
 }
 
+TEST_F(StaticMeshTest, CreateTorusLevelOfDetailMeshObjTest) {
+    EXPECT_TRUE(window_);
+    auto level    = std::make_unique<frame::Level>();
+    auto mesh_vec = frame::opengl::file::LoadStaticMeshesFromFile(
+        *level.get(), frame::file::FindFile("asset/model/torus.obj"), "torus", "", false, false,
+        false, 3);
+    ASSERT_EQ(1, mesh_vec.size());
+    auto& node        = level->GetSceneNodeFromId(mesh_vec.at(0));
+    auto& static_mesh = level->GetStaticMeshFromId(node.GetLocalMesh());
+    ASSERT_EQ(3, static_mesh.GetLevelOfDetailCount());
+    // All the levels are in the index buffer one after the other.
+    const auto [first0, count0] = static_mesh.GetLevelOfDetailIndexRange(0);
+    const auto [first1, count1] = static_mesh.GetLevelOfDetailIndexRange(1);
+    const auto [first2, count2] = static_mesh.GetLevelOfDetailIndexRange(2);
+    EXPECT_EQ(0, first0);
+    EXPECT_EQ(count0, first1);
+    EXPECT_EQ(first1 + count1, first2);
+    EXPECT_LE(count1 * 2, count0);
+    EXPECT_LE(count2 * 2, count1);
+    EXPECT_EQ(static_mesh.GetIndexSize(), (first2 + count2) * static_mesh.GetIndexElementSize());
+    // Default screen sizes halve at every level.
+    EXPECT_EQ(0, static_mesh.SelectLevelOfDetail(1.0f));
+    EXPECT_EQ(1, static_mesh.SelectLevelOfDetail(0.3f));
+    EXPECT_EQ(2, static_mesh.SelectLevelOfDetail(0.1f));
+    // The levels without a screen size are never used.
+    static_mesh.SetLevelOfDetailScreenSizes({ 0.2f });
+    EXPECT_EQ(0, static_mesh.SelectLevelOfDetail(0.3f));
+    EXPECT_EQ(1, static_mesh.SelectLevelOfDetail(0.1f));
+    EXPECT_THROW(static_mesh.GetLevelOfDetailIndexRange(3), std::runtime_error);
+}
+
 TEST_F(StaticMeshTest, CreateAppleMeshPlyTest) {
     EXPECT_TRUE(window_);
     auto level    = std::make_unique<frame::Level>();
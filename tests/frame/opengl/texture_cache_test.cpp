@@ -0,0 +1,45 @@
+#include "frame/opengl/texture_cache_test.h"
+
+namespace test {
+
+TEST_F(TextureCacheTest, TextureCacheFaceSizeTest) {
+    frame::opengl::TextureCacheData texture_cache_data = {};
+    texture_cache_data.pixel_element_size              = frame::proto::PixelElementSize::HALF;
+    texture_cache_data.pixel_structure                 = frame::proto::PixelStructure::RGB;
+    texture_cache_data.size                            = { 8, 4 };
+    // Half are stored as float.
+    EXPECT_EQ(8 * 4 * 3 * 4, frame::opengl::GetTextureCacheFaceSize(texture_cache_data, 0));
+    EXPECT_EQ(4 * 2 * 3 * 4, frame::opengl::GetTextureCacheFaceSize(texture_cache_data, 1));
+    // The smallest side stays at 1.
+    EXPECT_EQ(1 * 1 * 3 * 4, frame::opengl::GetTextureCacheFaceSize(texture_cache_data, 3));
+    texture_cache_data.pixel_element_size = frame::proto::PixelElementSize::BYTE;
+    texture_cache_data.pixel_structure    = frame::proto::PixelStructure::GREY_ALPHA;
+    EXPECT_EQ(8 * 4 * 2, frame::opengl::GetTextureCacheFaceSize(texture_cache_data, 0));
+}
+
+TEST_F(TextureCacheTest, ReadWriteTextureCacheTest) {
+    frame::opengl::TextureCacheData texture_cache_data = {};
+    // A cube map of 2x2 bytes with 2 mip levels.
+    frame::opengl::TextureCacheData written_data = {
+        frame::proto::PixelElementSize::BYTE, frame::proto::PixelStructure::GREY, { 2, 2 }, 6, 2
+    };
+    written_data.data.resize((4 + 1) * 6);
+    for (std::size_t i = 0; i < written_data.data.size(); ++i) {
+        written_data.data[i] = static_cast<std::uint8_t>(i);
+    }
+    frame::opengl::WriteTextureCacheFile(file_name_, 1, written_data);
+    ASSERT_TRUE(frame::opengl::ReadTextureCacheFile(file_name_, 1, texture_cache_data));
+    EXPECT_EQ(frame::proto::PixelElementSize::BYTE, texture_cache_data.pixel_element_size);
+    EXPECT_EQ(frame::proto::PixelStructure::GREY, texture_cache_data.pixel_structure);
+    EXPECT_EQ(2, texture_cache_data.size.x);
+    EXPECT_EQ(2, texture_cache_data.size.y);
+    EXPECT_EQ(6, texture_cache_data.face_count);
+    EXPECT_EQ(2, texture_cache_data.mip_count);
+    EXPECT_EQ(written_data.data, texture_cache_data.data);
+    // A content that doesn't match the mip chain is never used.
+    written_data.data.pop_back();
+    frame::opengl::WriteTextureCacheFile(file_name_, 1, written_data);
+    EXPECT_FALSE(frame::opengl::ReadTextureCacheFile(file_name_, 1, texture_cache_data));
+}
+
+}  // End namespace test.
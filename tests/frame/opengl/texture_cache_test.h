@@ -0,0 +1,21 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "frame/opengl/texture_cache.h"
+
+namespace test {
+
+class TextureCacheTest : public testing::Test {
+   public:
+    TextureCacheTest() = default;
+    ~TextureCacheTest() override { std::filesystem::remove(file_name_); }
+
+   protected:
+    const std::filesystem::path file_name_ =
+        std::filesystem::temp_directory_path() / "frame_texture_cache_test.ftex";
+};
+
+}  // End namespace test.
@@ -74,4 +74,25 @@ TEST_F(TextureTest, CreateHDRTextureFloatTest) {
     EXPECT_FLOAT_EQ(20.625f, *p.second);
 }
 
+TEST_F(TextureTest, UpdateTextureTest) {
+    frame::TextureParameter texture_parameter = {};
+    texture_parameter.pixel_element_size      = frame::proto::PixelElementSize_BYTE();
+    texture_parameter.pixel_structure         = frame::proto::PixelStructure_RGB_ALPHA();
+    texture_parameter.size                    = glm::uvec2(16, 8);
+    auto texture = std::make_unique<frame::opengl::Texture>(texture_parameter);
+    // Same size (go through the stream) then a bigger one (reallocate).
+    for (const auto size : { glm::uvec2(16, 8), glm::uvec2(16, 8), glm::uvec2(32, 16) }) {
+        std::vector<std::uint8_t> pixels(size.x * size.y * 4);
+        for (std::size_t i = 0; i < pixels.size(); ++i) {
+            pixels[i] = static_cast<std::uint8_t>(i + size.y);
+        }
+        auto expected = pixels;
+        texture->Update(std::move(pixels), size, 4);
+        // The update only land in the texture at the flush.
+        texture->FlushUpdate();
+        EXPECT_EQ(size, texture->GetSize());
+        EXPECT_EQ(expected, texture->GetTextureByte());
+    }
+}
+
 }  // End namespace test.
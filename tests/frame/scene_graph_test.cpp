@@ -0,0 +1,57 @@
+#include "frame/scene_graph_test.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "frame/node_matrix.h"
+
+namespace test {
+
+TEST_F(SceneGraphTest, BuildSceneGraphTest) {
+    frame::NodeMatrix root(glm::mat4(1.0f));
+    frame::NodeMatrix child(glm::mat4(1.0f));
+    frame::NodeMatrix grand_child(glm::mat4(1.0f));
+    // Children are given before their parents.
+    scene_graph_.Build({ { 3, 2, &grand_child }, { 2, 1, &child }, { 1, frame::NullId, &root } });
+    EXPECT_EQ(3, scene_graph_.GetSize());
+    EXPECT_TRUE(scene_graph_.HasNode(1));
+    EXPECT_FALSE(scene_graph_.HasNode(4));
+    EXPECT_EQ(frame::NullId, scene_graph_.GetParentId(1));
+    EXPECT_EQ(1, scene_graph_.GetParentId(2));
+    EXPECT_EQ(2, scene_graph_.GetParentId(3));
+    EXPECT_EQ(std::vector<frame::EntityId>{ 2 }, scene_graph_.GetChildList(1));
+    EXPECT_TRUE(scene_graph_.GetChildList(3).empty());
+}
+
+TEST_F(SceneGraphTest, WorldModelSceneGraphTest) {
+    const glm::mat4 root_matrix  = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    const glm::mat4 child_matrix = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 2.0f, 0.0f));
+    frame::NodeMatrix root(root_matrix);
+    frame::NodeMatrix child(child_matrix);
+    scene_graph_.Build({ { 1, frame::NullId, &root }, { 2, 1, &child } });
+    EXPECT_EQ(2, scene_graph_.Update(0.0));
+    EXPECT_EQ(root_matrix, scene_graph_.GetWorldModel(1));
+    EXPECT_EQ(root_matrix * child_matrix, scene_graph_.GetWorldModel(2));
+    // Nothing changed so nothing is recomputed.
+    EXPECT_EQ(0, scene_graph_.Update(1.0));
+    // Moving the root move the child.
+    root.SetMatrix(glm::mat4(1.0f));
+    EXPECT_EQ(2, scene_graph_.Update(2.0));
+    EXPECT_EQ(child_matrix, scene_graph_.GetWorldModel(2));
+    // Moving the child doesn't touch the root.
+    child.SetMatrix(glm::mat4(1.0f));
+    EXPECT_EQ(1, scene_graph_.Update(3.0));
+    EXPECT_EQ(std::vector<frame::EntityId>{ 2 }, scene_graph_.GetUpdatedIds());
+    EXPECT_EQ(glm::mat4(1.0f), scene_graph_.GetWorldModel(2));
+}
+
+TEST_F(SceneGraphTest, InvalidSceneGraphTest) {
+    frame::NodeMatrix first(glm::mat4(1.0f));
+    frame::NodeMatrix second(glm::mat4(1.0f));
+    // Missing parent.
+    EXPECT_THROW(scene_graph_.Build({ { 1, 3, &first } }), std::runtime_error);
+    // Cycle.
+    EXPECT_THROW(scene_graph_.Build({ { 1, 2, &first }, { 2, 1, &second } }), std::runtime_error);
+    EXPECT_THROW(scene_graph_.GetWorldModel(1), std::runtime_error);
+}
+
+}  // End namespace test.
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/scene_graph.h"
+
+namespace test {
+
+class SceneGraphTest : public testing::Test {
+   public:
+    SceneGraphTest() = default;
+
+   protected:
+    frame::SceneGraph scene_graph_ = {};
+};
+
+}  // End namespace test.
@@ -0,0 +1,59 @@
+#include "frame/slot_map_test.h"
+
+namespace test {
+
+TEST_F(SlotMapTest, AllocateIdSlotMapTest) {
+    // First generation ids are the same as a counter.
+    EXPECT_EQ(1, id_allocator_.Allocate());
+    EXPECT_EQ(2, id_allocator_.Allocate());
+    EXPECT_TRUE(id_allocator_.IsAlive(1));
+    EXPECT_FALSE(id_allocator_.IsAlive(frame::NullId));
+    id_allocator_.Free(1);
+    EXPECT_FALSE(id_allocator_.IsAlive(1));
+    EXPECT_THROW(id_allocator_.Free(1), std::out_of_range);
+    // The slot is reused with a new generation.
+    auto id = id_allocator_.Allocate();
+    EXPECT_NE(1, id);
+    EXPECT_EQ(frame::GetEntityIndex(1), frame::GetEntityIndex(id));
+    EXPECT_EQ(1, frame::GetEntityGeneration(id));
+    EXPECT_GT(id, frame::NullId);
+}
+
+TEST_F(SlotMapTest, InsertEraseSlotMapTest) {
+    std::vector<frame::EntityId> ids;
+    for (int i = 0; i < 4; ++i) {
+        ids.push_back(id_allocator_.Allocate());
+        slot_map_.Insert(ids.back(), std::make_unique<int>(i));
+    }
+    EXPECT_EQ(4, slot_map_.Size());
+    EXPECT_THROW(slot_map_.Insert(ids[0], std::make_unique<int>(0)), std::runtime_error);
+    // Erase in the middle move the last one in place.
+    slot_map_.Erase(ids[1]);
+    EXPECT_EQ(3, slot_map_.Size());
+    EXPECT_FALSE(slot_map_.Contains(ids[1]));
+    EXPECT_THROW(slot_map_.At(ids[1]), std::out_of_range);
+    EXPECT_EQ(0, *slot_map_.At(ids[0]));
+    EXPECT_EQ(2, *slot_map_.At(ids[2]));
+    EXPECT_EQ(3, *slot_map_.At(ids[3]));
+    EXPECT_EQ(ids[3], slot_map_.GetIds()[1]);
+    EXPECT_EQ(3, *slot_map_.GetValues()[1]);
+    slot_map_.Clear();
+    EXPECT_EQ(0, slot_map_.Size());
+    EXPECT_FALSE(slot_map_.Contains(ids[0]));
+}
+
+TEST_F(SlotMapTest, StaleIdSlotMapTest) {
+    auto old_id = id_allocator_.Allocate();
+    slot_map_.Insert(old_id, std::make_unique<int>(1));
+    slot_map_.Erase(old_id);
+    id_allocator_.Free(old_id);
+    auto new_id = id_allocator_.Allocate();
+    slot_map_.Insert(new_id, std::make_unique<int>(2));
+    // Same slot but the old id is detected as stale.
+    EXPECT_TRUE(slot_map_.Contains(new_id));
+    EXPECT_FALSE(slot_map_.Contains(old_id));
+    EXPECT_THROW(slot_map_.At(old_id), std::out_of_range);
+    EXPECT_EQ(2, *slot_map_.At(new_id));
+}
+
+}  // End namespace test.
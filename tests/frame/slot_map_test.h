@@ -0,0 +1,20 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "frame/slot_map.h"
+
+namespace test {
+
+class SlotMapTest : public testing::Test {
+   public:
+    SlotMapTest() = default;
+
+   protected:
+    frame::EntityIdAllocator id_allocator_        = {};
+    frame::SlotMap<std::unique_ptr<int>> slot_map_ = {};
+};
+
+}  // End namespace test.
@@ -0,0 +1,43 @@
+#include "frame/task_pool_test.h"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace test {
+
+TEST_F(TaskPoolTest, CreateTaskPoolTest) {
+    EXPECT_EQ(4, task_pool_.GetThreadCount());
+    EXPECT_EQ(1, frame::TaskPool(0).GetThreadCount());
+}
+
+TEST_F(TaskPoolTest, SubmitTaskPoolTest) {
+    std::atomic<int> counter = { 0 };
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(task_pool_.Submit([&counter, i]() {
+            counter++;
+            return i * i;
+        }));
+    }
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(i * i, futures[i].get());
+    EXPECT_EQ(100, counter.load());
+}
+
+TEST_F(TaskPoolTest, ExceptionTaskPoolTest) {
+    auto future = task_pool_.Submit([]() -> int { throw std::runtime_error("error"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+    // The worker is still alive after the exception.
+    EXPECT_EQ(42, task_pool_.Submit([]() { return 42; }).get());
+}
+
+TEST_F(TaskPoolTest, DestroyTaskPoolTest) {
+    std::atomic<int> counter = { 0 };
+    {
+        frame::TaskPool task_pool(1);
+        for (int i = 0; i < 10; ++i) task_pool.Submit([&counter]() { counter++; });
+    }
+    // All the submitted tasks are done before the destructor returns.
+    EXPECT_EQ(10, counter.load());
+}
+
+}  // End namespace test.
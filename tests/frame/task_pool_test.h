@@ -0,0 +1,17 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/task_pool.h"
+
+namespace test {
+
+class TaskPoolTest : public testing::Test {
+   public:
+    TaskPoolTest() = default;
+
+   protected:
+    frame::TaskPool task_pool_{ 4 };
+};
+
+}  // End namespace test.
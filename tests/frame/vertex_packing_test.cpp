@@ -0,0 +1,53 @@
+#include "frame/vertex_packing_test.h"
+
+#include <cstring>
+
+namespace test {
+
+TEST_F(VertexPackingTest, HalfFloatVertexPackingTest) {
+    for (const float value : { 0.0f, 0.5f, 1.0f, -2.0f, 0.25f, 65504.0f }) {
+        EXPECT_EQ(value, frame::UnpackHalfFloat(frame::PackHalfFloat(value)));
+    }
+    EXPECT_EQ(0x3c00, frame::PackHalfFloat(1.0f));
+    EXPECT_EQ(0x7c00, frame::PackHalfFloat(1e10f));
+    // Smallest denormal.
+    EXPECT_FLOAT_EQ(5.9604645e-8f, frame::UnpackHalfFloat(frame::PackHalfFloat(5.9604645e-8f)));
+    EXPECT_NEAR(0.1f, frame::UnpackHalfFloat(frame::PackHalfFloat(0.1f)), 1e-4f);
+}
+
+TEST_F(VertexPackingTest, NormalVertexPackingTest) {
+    const glm::vec3 normal = frame::UnpackNormal(frame::PackNormal(glm::vec3(0.0f, -1.0f, 0.6f)));
+    EXPECT_NEAR(0.0f, normal.x, 1e-3f);
+    EXPECT_NEAR(-1.0f, normal.y, 1e-3f);
+    EXPECT_NEAR(0.6f, normal.z, 1e-3f);
+}
+
+TEST_F(VertexPackingTest, InterleaveVertexPackingTest) {
+    const std::vector<float> points              = { 0, 0, 0, 1, 0, 0, 0, 1, 0 };
+    const std::vector<float> normals             = { 0, 0, 1, 0, 0, 1, 0, 0, 1 };
+    const std::vector<float> texture_coordinates = { 0, 0, 1, 0, 0, 1 };
+    const std::vector<std::uint32_t> indices     = { 0, 1, 2 };
+    auto interleaved = frame::InterleaveVertices(points, {}, normals, texture_coordinates, indices);
+    // Point (12) + packed normal (4) + half float texture coordinates (4).
+    EXPECT_EQ(20, interleaved.vertex_stride);
+    EXPECT_EQ(3 * 20, interleaved.vertices.size());
+    ASSERT_EQ(3, interleaved.vertex_attributes.size());
+    EXPECT_EQ(2, interleaved.vertex_attributes[2].location);
+    EXPECT_EQ(16, interleaved.vertex_attributes[2].offset);
+    EXPECT_EQ(frame::VertexAttributeFormatEnum::HALF_FLOAT,
+              interleaved.vertex_attributes[2].format);
+    float x = 0.0f;
+    std::memcpy(&x, interleaved.vertices.data() + 20, sizeof(float));
+    EXPECT_EQ(1.0f, x);
+    EXPECT_EQ(sizeof(std::uint16_t), interleaved.index_element_size);
+    EXPECT_EQ(3 * sizeof(std::uint16_t), interleaved.indices.size());
+    // Without packing.
+    frame::VertexPackingParameter parameter = { false, false, false };
+    interleaved =
+        frame::InterleaveVertices(points, {}, normals, texture_coordinates, indices, parameter);
+    EXPECT_EQ(32, interleaved.vertex_stride);
+    EXPECT_EQ(sizeof(std::uint32_t), interleaved.index_element_size);
+    EXPECT_THROW(frame::InterleaveVertices(points, {}, { 1.0f }, {}, indices), std::runtime_error);
+}
+
+}  // End namespace test.
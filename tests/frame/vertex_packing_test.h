@@ -0,0 +1,14 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "frame/vertex_packing.h"
+
+namespace test {
+
+class VertexPackingTest : public testing::Test {
+   public:
+    VertexPackingTest() = default;
+};
+
+}  // End namespace test.
@@ -0,0 +1,109 @@
+#include <absl/flags/flag.h>
+#include <absl/flags/parse.h>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "frame/file/block_compression.h"
+#include "frame/file/compressed_image.h"
+#include "frame/file/image.h"
+#include "frame/file/image_stb.h"
+
+ABSL_FLAG(std::string, format, "bc1", "Compressed format (bc1, bc3, bc4 or bc5).");
+ABSL_FLAG(bool, mipmaps, true, "Generate the mip chain down to 1x1.");
+
+namespace {
+
+frame::file::CompressedFormatEnum ParseFormat(std::string format) {
+    std::transform(format.begin(), format.end(), format.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (format == "bc1") return frame::file::CompressedFormatEnum::BC1;
+    if (format == "bc3") return frame::file::CompressedFormatEnum::BC3;
+    if (format == "bc4") return frame::file::CompressedFormatEnum::BC4;
+    if (format == "bc5") return frame::file::CompressedFormatEnum::BC5;
+    throw std::runtime_error(fmt::format("Unsupported format [{}].", format));
+}
+
+bool IsSourceImage(const std::filesystem::path& file) {
+    std::string extension = file.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".jpg" || extension == ".jpeg" || extension == ".png";
+}
+
+// Peak signal to noise ratio of the first level over the channels kept by the format.
+double ComputePSNR(const std::uint8_t* source, const std::vector<std::uint8_t>& result,
+                   frame::file::CompressedFormatEnum format) {
+    const int channel_count =
+        static_cast<int>(frame::file::GetCompressedPixelStructure(format).value());
+    double error      = 0.0;
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        if (static_cast<int>(i % 4) >= channel_count) continue;
+        const double delta = static_cast<double>(source[i]) - static_cast<double>(result[i]);
+        error += delta * delta;
+        ++count;
+    }
+    if (error == 0.0) return std::numeric_limits<double>::infinity();
+    return 10.0 * std::log10(255.0 * 255.0 * count / error);
+}
+
+void CompressFile(const std::filesystem::path& input, const std::filesystem::path& output,
+                  frame::file::CompressedFormatEnum format, bool mipmaps) {
+    // Files are stored top down, the loader flips them (as for the other images).
+    frame::file::Image image(input, frame::proto::PixelElementSize_BYTE(),
+                             frame::proto::PixelStructure_RGB_ALPHA(), false);
+    const auto* rgba = static_cast<const std::uint8_t*>(image.Data());
+    const auto size  = image.GetSize();
+    frame::file::CompressedImage compressed =
+        mipmaps ? frame::file::CompressImageWithMipmaps(rgba, size, format)
+                : frame::file::CompressedImage(format, size,
+                                               { frame::file::CompressImage(rgba, size, format) });
+    if (output.has_parent_path()) std::filesystem::create_directories(output.parent_path());
+    compressed.SaveToDdsFile(output);
+    const auto result = frame::file::DecompressImage(compressed.GetLevel(0).data(), size, format);
+    std::cout << fmt::format("{} -> {} ({}x{}, {} levels, PSNR {:.2f} dB)", input.string(),
+                             output.string(), size.x, size.y, compressed.GetMipCount(),
+                             ComputePSNR(rgba, result, format))
+              << std::endl;
+}
+
+}  // End namespace.
+
+// Convert JPG/PNG images to block compressed DDS files:
+//   TextureCompressor --format=bc1 input.png output.dds
+//   TextureCompressor --format=bc3 input_directory output_directory
+int main(int ac, char** av) try {
+    const auto arguments = absl::ParseCommandLine(ac, av);
+    if (arguments.size() != 3) {
+        std::cerr << "Usage: " << av[0] << " [--format=bc1|bc3|bc4|bc5] [--nomipmaps] "
+                  << "<input image or directory> <output dds or directory>" << std::endl;
+        return -1;
+    }
+    const auto format  = ParseFormat(absl::GetFlag(FLAGS_format));
+    const bool mipmaps = absl::GetFlag(FLAGS_mipmaps);
+    const std::filesystem::path input(arguments[1]);
+    const std::filesystem::path output(arguments[2]);
+    if (!std::filesystem::is_directory(input)) {
+        CompressFile(input, output, format, mipmaps);
+        return 0;
+    }
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+        if (!entry.is_regular_file() || !IsSourceImage(entry.path())) continue;
+        auto output_file = output / std::filesystem::relative(entry.path(), input);
+        output_file.replace_extension(".dds");
+        CompressFile(entry.path(), output_file, format, mipmaps);
+    }
+    return 0;
+} catch (std::exception& ex) {
+    std::cerr << "Error: " << ex.what() << std::endl;
+    return -2;
+}